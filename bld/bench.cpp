@@ -0,0 +1,278 @@
+#include "../src/driver.h"
+
+#include "../src/globalDefs.h"
+#include "../src/constantDefs.h"
+
+#include "../src/outputOperators.h"
+
+#include "../src/lexer.h"
+#include "../src/parser.h"
+
+// stand-ins for the driver's global variables, since the benchmark links against the compiler modules without the driver itself
+
+int driverErrorCode;
+
+int optimizationLevel = DEFAULT_OPTIMIZATION_LEVEL;
+bool verboseOutput = false;
+bool silentMode = SILENT_MODE_DEFAULT;
+bool codedOutput = CODED_OUTPUT_DEFAULT;
+int tabModulus = TAB_MODULUS_DEFAULT;
+bool eventuallyGiveUp = EVENTUALLY_GIVE_UP_DEFAULT;
+int numJobs = JOBS_DEFAULT;
+string cacheDirectory(CACHE_DIRECTORY_DEFAULT);
+int parserProfileMode = PARSER_PROFILE_DEFAULT;
+
+vector<string> inFileNames; // source file name vector
+vector<SourceBuffer *> inFiles; // source file contents vector
+
+unsigned int nextUniqueInt = 0;
+unsigned int getUniqueInt() {
+	return (nextUniqueInt++);
+}
+string getUniqueId() {
+	string acc(UNIQUE_ID_PREFIX);
+	acc += getUniqueInt();
+	return acc;
+}
+
+#ifdef LEXER_DIRECT_CODED
+#define LEXER_BACKEND_STRING "direct"
+#else
+#define LEXER_BACKEND_STRING "table"
+#endif
+
+#ifdef PARSER_DIRECT_CODED
+#define PARSER_BACKEND_STRING "direct"
+#else
+#define PARSER_BACKEND_STRING "table"
+#endif
+
+#define DEFAULT_ITERATIONS 100
+#define DEFAULT_EDITS 20 /* per file */
+
+// returns the current wall clock time, in seconds
+double getTime() {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec/1000000.0);
+}
+
+// returns the number of reductions that went into building the given parse tree (i.e. its number of nonterminal nodes)
+unsigned long long countReductions(Tree *root) {
+	unsigned long long reductions = 0;
+	vector<Tree *> nodeStack;
+	if (root != NULL) {
+		nodeStack.push_back(root);
+	}
+	while (!nodeStack.empty()) {
+		Tree *cur = nodeStack.back();
+		nodeStack.pop_back();
+		if (cur->tokenType >= NUM_TOKENS) {
+			reductions++;
+		}
+		if (cur->next != NULL) {
+			nodeStack.push_back(cur->next);
+		}
+		if (cur->child != NULL) {
+			nodeStack.push_back(cur->child);
+		}
+	}
+	return reductions;
+}
+
+// returns whether the two given parse trees have the same shape, token types, positions, and text
+bool sameTree(Tree *a, Tree *b) {
+	vector<pair<Tree *, Tree *> > nodeStack;
+	nodeStack.push_back(make_pair(a, b));
+	while (!nodeStack.empty()) {
+		Tree *x = nodeStack.back().first;
+		Tree *y = nodeStack.back().second;
+		nodeStack.pop_back();
+		if (x == NULL || y == NULL) {
+			if (x != y) {
+				return false;
+			}
+			continue;
+		}
+		Token tx = x->t();
+		Token ty = y->t();
+		if (tx.tokenType != ty.tokenType || tx.offset != ty.offset || tx.len != ty.len || memcmp(tx.str, ty.str, tx.len) != 0 ||
+				(x->back == NULL) != (y->back == NULL) || (x->parent == NULL) != (y->parent == NULL)) {
+			return false;
+		}
+		nodeStack.push_back(make_pair(x->next, y->next));
+		nodeStack.push_back(make_pair(x->child, y->child));
+	}
+	return true;
+}
+
+// returns which bytes of the given source are plain code, as opposed to being part of a comment or a quoted literal (including the newline that ends a // comment)
+vector<bool> getCodeMask(const string &s) {
+	vector<bool> code(s.length(), false);
+	size_t i = 0;
+	while (i < s.length()) {
+		if (s.compare(i, 2, "//") == 0) { // regular comment
+			size_t lineEnd = s.find('\n', i);
+			i = (lineEnd != string::npos) ? lineEnd+1 : s.length();
+		} else if (s.compare(i, 2, "/*") == 0) { // star comment
+			size_t commentEnd = s.find("*/", i+2);
+			i = (commentEnd != string::npos) ? commentEnd+2 : s.length();
+		} else if (s[i] == '\"' || s[i] == '\'') { // quoted literal
+			char termChar = s[i++];
+			while (i < s.length() && s[i] != termChar) {
+				i += (s[i] == '\\') ? 2 : 1;
+			}
+			i++;
+		} else { // code
+			code[i++] = true;
+		}
+	}
+	return code;
+}
+
+// returns the position of the first code byte at or after pos that's one of the given characters, or string::npos if there isn't one
+size_t findCode(const string &s, const vector<bool> &code, const char *chars, size_t pos) {
+	for (pos = s.find_first_of(chars, pos); pos != string::npos && !code[pos]; pos = s.find_first_of(chars, pos+1));
+	return pos;
+}
+
+// picks a small random edit of the given source that keeps it lexically valid; the edit replaces the bytes in [editStart, editOldEnd) with text
+// edits only ever touch code, since a space in a character literal or a deleted newline after a // comment would change how the source lexes
+void pickEdit(SourceBuffer *in, unsigned int &editStart, unsigned int &editOldEnd, string &text) {
+	string s(in->data, in->size);
+	vector<bool> code(getCodeMask(s));
+	unsigned int pos = (in->size != 0) ? rand() % in->size : 0;
+	size_t digit = findCode(s, code, "0123456789", pos);
+	size_t space = findCode(s, code, " \t\n", pos);
+	if (rand() % 2 == 0 && digit != string::npos) { // change a digit
+		editStart = digit;
+		editOldEnd = digit + 1;
+		char newDigit = '0' + (s[digit] - '0' + 1) % 10;
+		bool leading = (digit == 0 || s[digit-1] < '0' || s[digit-1] > '9');
+		if (newDigit == '0' && leading && digit+1 < s.length() && s[digit+1] >= '0' && s[digit+1] <= '9') { // a number can't start with a 0, so skip over it
+			newDigit = '1';
+		}
+		text = string(1, newDigit);
+	} else if (space != string::npos && space+1 < s.length() && code[space+1] && (s[space+1] == ' ' || s[space+1] == '\t' || s[space+1] == '\n') && rand() % 2 == 0) { // delete a redundant whitespace character
+		editStart = space;
+		editOldEnd = space + 1;
+		text = "";
+	} else { // insert a space
+		editStart = editOldEnd = (space != string::npos) ? space : s.length();
+		text = " ";
+	}
+}
+
+// times the lexer, the parser, and incremental reparsing over the given files; usage: bench [-n iterations] [-e edits] file...
+int main(int argc, char **argv) {
+	// parse the arguments
+	unsigned int iterations = DEFAULT_ITERATIONS;
+	unsigned int numEdits = DEFAULT_EDITS;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-n") == 0 && i+1 < argc) {
+			iterations = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-e") == 0 && i+1 < argc) {
+			numEdits = atoi(argv[++i]);
+		} else {
+			SourceBuffer *inFile = new SourceBuffer();
+			if (!inFile->load(argv[i])) {
+				cerr << "bench: cannot open input file '" << argv[i] << "'\n";
+				return 1;
+			}
+			inFiles.push_back(inFile);
+			inFileNames.push_back(argv[i]);
+		}
+	}
+	if (inFiles.empty()) {
+		cerr << "bench: no input files\n";
+		return 1;
+	}
+	// lex all of the files repeatedly, timing the whole run
+	unsigned long long bytes = 0;
+	unsigned long long tokens = 0;
+	double lexTime = 0.0;
+	for (unsigned int iteration = 0; iteration < iterations; iteration++) {
+		for (unsigned int i = 0; i < inFiles.size(); i++) {
+			double startTime = getTime();
+			TokenStream *lexeme = lex(inFiles[i], i);
+			lexTime += getTime() - startTime;
+			if (lexeme == NULL) {
+				cerr << "bench: lexing failed on '" << inFileNames[i] << "'\n";
+				return 1;
+			}
+			bytes += inFiles[i]->size;
+			tokens += lexeme->size();
+			delete lexeme;
+		}
+	}
+	// parse all of the files repeatedly; the parser pulls its tokens from the lexer, so this times both together
+	unsigned long long reductions = 0;
+	unsigned long long nodes = 0;
+	unsigned long long treeBytes = 0;
+	double parseTime = 0.0;
+	for (unsigned int iteration = 0; iteration < iterations; iteration++) {
+		for (unsigned int i = 0; i < inFiles.size(); i++) {
+			double startTime = getTime();
+			Lexer lexer(inFiles[i], i);
+			TreeArena *arena = new TreeArena(i);
+			Tree *parseme = NULL;
+			int parseError = parse(lexer, parseme, *arena);
+			parseTime += getTime() - startTime;
+			if (parseError) {
+				cerr << "bench: parsing failed on '" << inFileNames[i] << "'\n";
+				return 1;
+			}
+			reductions += countReductions(parseme);
+			nodes += arena->numNodes();
+			treeBytes += arena->bytes();
+			delete arena;
+		}
+	}
+	// apply random edits to each file, timing the incremental reparses and checking each one against a full parse of the edited file
+	unsigned long long edits = 0;
+	unsigned long long incrementalEdits = 0;
+	unsigned long long mismatches = 0;
+	double reparseTime = 0.0;
+	for (unsigned int i = 0; i < inFiles.size(); i++) {
+		Lexer lexer(inFiles[i], i);
+		TreeArena *arena = new TreeArena(i);
+		Tree *parseme = NULL;
+		parse(lexer, parseme, *arena);
+		lowerTree(parseme, *arena);
+		ReparseState state(parseme);
+		for (unsigned int edit = 0; edit < numEdits; edit++) {
+			unsigned int editStart, editOldEnd;
+			string text;
+			pickEdit(inFiles[i], editStart, editOldEnd, text);
+			bool incremental;
+			double startTime = getTime();
+			int parseError = reparse(inFiles[i], editStart, editOldEnd, text, state, *arena, cout, cerr, &incremental);
+			reparseTime += getTime() - startTime;
+			if (parseError) {
+				cerr << "bench: reparsing failed on '" << inFileNames[i] << "'\n";
+				return 1;
+			}
+			edits++;
+			incrementalEdits += incremental;
+			// check the result
+			Lexer checkLexer(inFiles[i], i);
+			TreeArena checkArena(i);
+			Tree *check = NULL;
+			parse(checkLexer, check, checkArena);
+			mismatches += !sameTree(state.parseme, check);
+		}
+		delete arena;
+	}
+	// report the results
+	printf("lexer (%s): %llu bytes, %llu tokens in %.3f s -- %.2f MB/s, %.2f Mtokens/s\n",
+		LEXER_BACKEND_STRING, bytes, tokens, lexTime, (bytes/1000000.0)/lexTime, (tokens/1000000.0)/lexTime);
+	printf("parser (%s, %s lexer): %llu bytes, %llu reductions in %.3f s -- %.2f MB/s, %.2f Mreductions/s\n",
+		PARSER_BACKEND_STRING, LEXER_BACKEND_STRING, bytes, reductions, parseTime, (bytes/1000000.0)/parseTime, (reductions/1000000.0)/parseTime);
+	printf("parse tree: %llu nodes, %.1f bytes/node (%u bytes inline, %u bytes of source text per node; semantic data adds %u bytes/node when used)\n",
+		nodes, (double)treeBytes/nodes, (unsigned int)sizeof(Tree), (unsigned int)sizeof(TreeText), (unsigned int)sizeof(TreeSemantics));
+	if (edits > 0) {
+		printf("reparser: %llu edits (%llu incremental) in %.3f s -- %.3f ms/edit, vs %.3f ms/file for a full parse; %llu mismatches against full parses\n",
+			edits, incrementalEdits, reparseTime, 1000.0*reparseTime/edits, 1000.0*parseTime/(iterations*inFiles.size()), mismatches);
+	}
+	return ((mismatches == 0) ? 0 : 1);
+}
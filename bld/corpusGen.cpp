@@ -0,0 +1,342 @@
+#include "../src/globalDefs.h"
+#include "../src/constantDefs.h"
+
+// generates a large, syntactically valid ANI program for benchmarking the front end; usage: corpusGen [-s kilobytes] [-d depth] [-r seed] [-p pipes] [-b groups] [-i links] [-e operands]
+// with -p, instead generates exactly the given number of simple, semantically valid top-level pipes, for scaling tests of the whole compiler
+// with -b, instead generates the given number of semantically valid groups of blocks nested to the given depth, whose innermost pipes refer to names from every enclosing scope, for scaling tests of name resolution
+// with -i, instead generates a chain of the given number of imports, each of which depends on the one after it, for scaling tests of import resolution
+// with -e, instead generates a single expression with the given number of operands, for scaling tests of expression typing on deeply nested infix trees
+
+#define DEFAULT_SIZE 1024 /* in kilobytes */
+#define DEFAULT_DEPTH 6
+#define DEFAULT_SEED 1
+#define PIPES_PER_GROUP 64 /* top-level pipes are grouped into blocks of this many, so the trunk of the parse tree stays shallow */
+
+unsigned int nextId = 0; // counter for generating unique identifiers
+
+// returns a random number in [0, n)
+unsigned int randBelow(unsigned int n) {
+	return (unsigned int)(rand() % n);
+}
+
+// returns a fresh identifier with the given prefix
+string genId(const char *prefix) {
+	char buf[MAX_INT_STRING_LENGTH];
+	sprintf(buf, "%u", nextId++);
+	return string(prefix) + buf;
+}
+
+string genInt() {
+	char buf[MAX_INT_STRING_LENGTH];
+	sprintf(buf, "%u", randBelow(100000));
+	return string(buf);
+}
+
+string genFloat() {
+	char buf[MAX_STRING_LENGTH];
+	switch (randBelow(3)) {
+		case 0:
+			sprintf(buf, "%u.%u", randBelow(1000), randBelow(1000));
+			break;
+		case 1:
+			sprintf(buf, "%u.%ue-%u", randBelow(10), randBelow(1000), randBelow(20));
+			break;
+		default:
+			sprintf(buf, "%ue+%u", 1 + randBelow(9), randBelow(20));
+			break;
+	}
+	return string(buf);
+}
+
+// returns a string literal of roughly the given length, including some escape sequences
+string genString(unsigned int length) {
+	static const char *words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "pipe", "filter", "stream", "latch", "node"};
+	string acc("\"");
+	while (acc.length() < length) {
+		acc += words[randBelow(10)];
+		unsigned int sep = randBelow(16);
+		acc += (sep == 0) ? "\\t" : ((sep == 1) ? "\\n" : ((sep == 2) ? "\\\"" : " "));
+	}
+	acc += '\"';
+	return acc;
+}
+
+// returns a random arithmetic/logical expression of the given nesting depth
+string genExp(unsigned int depth) {
+	static const char *ops[] = {" + ", " - ", " * ", " / ", " % ", " << ", " >> ", " == ", " != ", " < ", " >= ", " & ", " | ", " && ", " || "};
+	if (depth == 0) {
+		switch (randBelow(4)) {
+			case 0:
+				return genFloat();
+			case 1:
+				return "-" + genInt();
+			default:
+				return genInt();
+		}
+	}
+	string acc("(");
+	unsigned int numTerms = 2 + randBelow(3);
+	for (unsigned int i = 0; i < numTerms; i++) {
+		if (i != 0) {
+			acc += ops[randBelow(15)];
+		}
+		acc += (randBelow(2) == 0) ? genExp(depth-1) : genExp(0);
+	}
+	acc += ")";
+	return acc;
+}
+
+// returns the given number of tabs
+string indent(unsigned int level) {
+	return string(level, '\t');
+}
+
+// returns one random pipe (a declaration, statement, or comment), modeled on the constructs in tst/debug.ani
+string genPipe(unsigned int depth, unsigned int level) {
+	string acc;
+	switch (randBelow(10)) {
+		case 0: { // line comment
+			acc += indent(level) + "// " + genString(20 + randBelow(80)) + "\n";
+			break;
+		}
+		case 1: { // block comment followed by a declaration
+			acc += indent(level) + "/* " + genString(40 + randBelow(200)) + "\n" + indent(level) + "   " + genString(40) + " */\n";
+			acc += indent(level) + genId("var") + " = [int](" + genInt() + ");\n";
+			break;
+		}
+		case 2: { // typed declaration with an expression
+			acc += indent(level) + genId("exp") + " = [float](" + genExp(depth) + ");\n";
+			break;
+		}
+		case 3: { // big string literal
+			acc += indent(level) + genId("str") + " = [string](" + genString(40 + randBelow(400)) + ");\n";
+			break;
+		}
+		case 4: { // big array literal
+			acc += indent(level) + genId("pool") + " = [float]{";
+			unsigned int numElements = 8 + randBelow(64);
+			for (unsigned int i = 0; i < numElements; i++) {
+				acc += (i != 0) ? "," : "";
+				acc += (randBelow(2) == 0) ? genInt() : genFloat();
+			}
+			acc += "};\n";
+			break;
+		}
+		case 5: { // long pipe through compound operators into a latch
+			string latch = genId("latch");
+			acc += indent(level) + latch + " = [int](" + genInt() + ");\n";
+			acc += indent(level) + genInt();
+			unsigned int numStages = 4 + randBelow(16);
+			for (unsigned int i = 0; i < numStages; i++) {
+				switch (randBelow(4)) {
+					case 0:
+						acc += ", " + genInt() + " +";
+						break;
+					case 1:
+						acc += ", " + genInt() + " *";
+						break;
+					case 2:
+						acc += " ++";
+						break;
+					default:
+						acc += " >> 1 << 1";
+						break;
+				}
+			}
+			acc += " ->" + latch + ";\n";
+			break;
+		}
+		case 6: { // filter applied to a pair of values
+			string x = genId("x");
+			string y = genId("y");
+			acc += indent(level) + genInt() + ", " + genExp(depth/2) + " [int " + x + ", float " + y + " --> float\\] {\n";
+			acc += indent(level+1) + x + " * " + y + " + " + genExp(depth/2) + " -->;\n";
+			acc += indent(level) + "} ->std.out;\n";
+			break;
+		}
+		case 7: { // object definition
+			string name = genId("obj");
+			string param = genId("p");
+			acc += indent(level) + name + " = []{\n";
+			acc += indent(level+1) + "=;\n";
+			acc += indent(level+1) + "=[int\\ " + param + "] {\\" + param + " ->std.out;}\n";
+			acc += indent(level+1) + "=[--> string] {" + genString(20) + " -->};\n";
+			acc += indent(level+1) + genId("mem") + " = " + genInt() + ";\n";
+			acc += indent(level) + "};\n";
+			break;
+		}
+		case 8: { // conditional
+			acc += indent(level) + genExp(depth/2) + " ? (" + genExp(depth/2) + ") : (" + genExp(depth/2) + ");\n";
+			break;
+		}
+		default: { // nested blocks
+			unsigned int nesting = 1 + randBelow(depth+1);
+			for (unsigned int i = 0; i < nesting; i++) {
+				acc += indent(level+i) + "{\n";
+			}
+			acc += indent(level+nesting) + genId("inner") + " = [int](" + genExp(depth/2) + ");\n";
+			acc += indent(level+nesting) + genInt() + " [int " + genId("v") + "] {" + genInt() + " ->std.out;};\n";
+			for (unsigned int i = nesting; i > 0; i--) {
+				acc += indent(level+i-1) + "};\n";
+			}
+			break;
+		}
+	}
+	return acc;
+}
+
+// returns one simple pipe that passes semantic analysis; n is the pipe's index in the program
+string genSimplePipe(unsigned long n) {
+	char buf[MAX_STRING_LENGTH];
+	switch (n % 4) {
+		case 0: // latch declaration
+			sprintf(buf, "v%lu = [int](%lu);\n", n, n);
+			break;
+		case 1: // pipe into the previous latch
+			sprintf(buf, "%lu, %u + ->v%lu;\n", n, randBelow(100000), n-1);
+			break;
+		case 2: // string declaration
+			sprintf(buf, "s%lu = [string](\"s%lu\");\n", n, n);
+			break;
+		default: // filter applied to a value
+			sprintf(buf, "%lu [int x] {x ->std.out;};\n", n);
+			break;
+	}
+	return string(buf);
+}
+
+// returns one group of blocks nested to the given depth; each level declares a latch, and the innermost level pipes into and out of all of them
+string genBindingGroup(unsigned long n, unsigned int depth) {
+	char buf[MAX_STRING_LENGTH];
+	string acc;
+	for (unsigned int level = 0; level <= depth; level++) {
+		if (level != 0) {
+			acc += indent(level-1) + "{\n";
+		}
+		sprintf(buf, "g%lul%u = [int](%u);\n", n, level, randBelow(100000));
+		acc += indent(level) + buf;
+	}
+	for (unsigned int level = 0; level <= depth; level++) {
+		sprintf(buf, "%u, g%lul%u + ->g%lul%u;\n", randBelow(100000), n, depth-level, n, level);
+		acc += indent(depth) + buf;
+		sprintf(buf, "g%lul%u ->std.out;\n", n, level);
+		acc += indent(depth) + buf;
+	}
+	for (unsigned int level = depth; level > 0; level--) {
+		acc += indent(level-1) + "};\n";
+	}
+	return acc;
+}
+
+// returns a chain of the given number of imports; each import is nested in a block inside the scope of the next one, and imports a member of the object that the next one imports
+string genImportChain(unsigned long links) {
+	char buf[MAX_STRING_LENGTH];
+	string acc;
+	// the objects nest like a0 = []{ =; a1 = []{ =; ... }; };
+	for (unsigned long link = 0; link <= links; link++) {
+		sprintf(buf, "a%lu = []{\n", link);
+		acc += indent(link) + buf + indent(link+1) + "=;\n";
+	}
+	acc += indent(links+1) + "v = [int](" + genInt() + ");\n";
+	for (unsigned long link = links+1; link > 0; link--) {
+		acc += indent(link-1) + "};\n";
+	}
+	// the import of a(k-1).ak sits in the k-th nested block, after the block that holds the import of ak.a(k+1)
+	for (unsigned long link = 0; link < links; link++) {
+		acc += indent(link) + "{\n";
+	}
+	for (unsigned long link = links; link > 0; link--) {
+		sprintf(buf, "@a%lu.a%lu;\n", link-1, link);
+		acc += indent(link) + buf + indent(link-1) + "};\n";
+	}
+	return acc;
+}
+
+// returns a latch declaration initialized by one long infix expression with the given number of operands, followed by a pipe that uses it
+string genDeepExp(unsigned long operands) {
+	static const char *ops[] = {" + ", " - ", " * "};
+	string acc("x = [int](");
+	for (unsigned long n = 0; n < operands; n++) {
+		if (n != 0) {
+			acc += ops[randBelow(3)];
+		}
+		acc += genInt();
+	}
+	acc += ");\nx ->std.out;\n";
+	return acc;
+}
+
+int main(int argc, char **argv) {
+	// parse the arguments
+	unsigned long size = DEFAULT_SIZE;
+	unsigned int depth = DEFAULT_DEPTH;
+	unsigned int seed = DEFAULT_SEED;
+	unsigned long pipes = 0;
+	unsigned long groups = 0;
+	unsigned long links = 0;
+	unsigned long operands = 0;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-s") == 0 && i+1 < argc) {
+			size = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-d") == 0 && i+1 < argc) {
+			depth = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-r") == 0 && i+1 < argc) {
+			seed = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-p") == 0 && i+1 < argc) {
+			pipes = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-b") == 0 && i+1 < argc) {
+			groups = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-i") == 0 && i+1 < argc) {
+			links = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-e") == 0 && i+1 < argc) {
+			operands = strtoul(argv[++i], NULL, 10);
+		} else {
+			cerr << "usage: corpusGen [-s kilobytes] [-d depth] [-r seed] [-p pipes] [-b groups] [-i links] [-e operands]\n";
+			return 1;
+		}
+	}
+	srand(seed);
+	// if a pipe count was given, generate that many simple pipes directly at the top level, so the trunk of the parse tree is as long as possible
+	if (pipes > 0) {
+		cout << "// generated by bld/corpusGen.cpp -- whole compiler scaling corpus\n\n@std;\n\n";
+		for (unsigned long n = 0; n < pipes; n++) {
+			cout << genSimplePipe(n);
+		}
+		return 0;
+	}
+	// if a group count was given, generate that many nested binding groups at the top level
+	if (groups > 0) {
+		cout << "// generated by bld/corpusGen.cpp -- name resolution scaling corpus\n\n@std;\n\n";
+		for (unsigned long n = 0; n < groups; n++) {
+			cout << genBindingGroup(n, depth);
+		}
+		return 0;
+	}
+	// if a link count was given, generate an import chain of that length
+	if (links > 0) {
+		cout << "// generated by bld/corpusGen.cpp -- import resolution scaling corpus\n\n@std;\n\n";
+		cout << genImportChain(links);
+		return 0;
+	}
+	// if an operand count was given, generate an expression with that many operands
+	if (operands > 0) {
+		cout << "// generated by bld/corpusGen.cpp -- expression depth scaling corpus\n\n@std;\n\n";
+		cout << genDeepExp(operands);
+		return 0;
+	}
+	// generate groups of pipes until we've reached the requested size
+	unsigned long bytes = 0;
+	string header("// generated by bld/corpusGen.cpp -- front end benchmark corpus\n\n@std;\n\n");
+	cout << header;
+	bytes += header.length();
+	while (bytes < size*1024) {
+		string group("{\n");
+		for (unsigned int i = 0; i < PIPES_PER_GROUP; i++) {
+			group += genPipe(depth, 1);
+		}
+		group += "};\n\n";
+		cout << group;
+		bytes += group.length();
+	}
+	return 0;
+}
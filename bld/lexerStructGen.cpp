@@ -16,6 +16,42 @@ int mapToken(string s) {
 	}
 }
 
+// returns the name of the token with the given id
+string tokenName(int tokenType) {
+	for (map<string,int>::iterator queryBuf = tokenMap.begin(); queryBuf != tokenMap.end(); queryBuf++) {
+		if (queryBuf->second == tokenType) {
+			return ("TOKEN_" + queryBuf->first);
+		}
+	}
+	return "-1";
+}
+
+// returns a C++ case label expression for the given character
+string caseLabel(int c) {
+	char buf[MAX_STRING_LENGTH];
+	if (c >= 0x20 && c < 0x7F && c != '\'' && c != '\\') {
+		sprintf(buf, "'%c'", (char)c);
+	} else {
+		sprintf(buf, "%d", c);
+	}
+	return string(buf);
+}
+
+// returns whether the given token type is a plain transition that simply extends the current token
+bool isRegularTransition(int tokenType) {
+	static const char *specialTokens[] = { "FAIL", "REGCOMMENT", "STARCOMMENT", "CQUOTE", "SQUOTE", NULL };
+	if (tokenType == -1) {
+		return false;
+	}
+	for (unsigned int i = 0; specialTokens[i] != NULL; i++) {
+		map<string,int>::iterator queryBuf = tokenMap.find(specialTokens[i]);
+		if (queryBuf != tokenMap.end() && queryBuf->second == tokenType) {
+			return false;
+		}
+	}
+	return true;
+}
+
 // parses the lexer table into an includable .h file with the appropriate struct representation
 int main() {
 	// input file
@@ -40,15 +76,22 @@ int main() {
 	if (lnr == NULL) { // if file open failed, return an error
 		return -1;
 	}
+	FILE *lcr;
+	lcr = fopen("./tmp/lexerCodeRaw.h","w");
+	if (lcr == NULL) { // if file open failed, return an error
+		return -1;
+	}
 
 	// print the necessary prologue into the .cpp
 	fprintf(out2, "#include \"lexerStruct.h\"\n\n");
 
-	// create the lexer node array
-	LexerNode lexerNode[256][256];
+	// create the full (state x character) transition arrays
+	int nodeTokenType[256][256];
+	int nodeToState[256][256];
 	for (int i = 0; i<256; i++) {
 		for (int j = 0; j<256; j++) {
-			lexerNode[i][j] = (LexerNode){ -1, 0 }; // -1 tokenType indicates an invalid node
+			nodeTokenType[i][j] = -1; // -1 tokenType indicates an invalid node
+			nodeToState[i][j] = 0;
 		}
 	}
 	// now, process the input file
@@ -58,6 +101,8 @@ int main() {
 	unsigned char c;
 	char tokenTypeCString[MAX_STRING_LENGTH];
 	int toState;
+	// the number of states used by the table
+	int numStates = 0;
 	// read the lexer data
 	for(;;) {
 		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
@@ -70,10 +115,56 @@ int main() {
 		if (retVal2 >= 0 && retVal2 <= 3) { // if it was a blank/incomplete line, skip it
 			continue;
 		} else if (retVal2 == 4) { // else if it was a valid data line, process it normally
+			if (fromState < 0 || fromState >= 256 || toState >= 256) { // if the state doesn't fit in the raw table, bail out before indexing it
+				fprintf(stderr, "lexerStructGen: lexer table too large for narrow LexerNode (transition %d -> %d)\n", fromState, toState);
+				return -1;
+			}
 			int tokenType = mapToken(tokenTypeString); // get the token mapping
-			lexerNode[fromState][c] = (LexerNode){ tokenType, toState };
+			nodeTokenType[fromState][c] = tokenType;
+			nodeToState[fromState][c] = toState;
+			if (fromState >= numStates) {
+				numStates = fromState + 1;
+			}
+			if (toState >= numStates) {
+				numStates = toState + 1;
+			}
 		}
 	}
+	// verify that the compressed table, including the dead state added below, fits into the narrow LexerNode fields
+	if (numStates + 1 > 256 || (tokenMap.size() + 2) > 128) {
+		fprintf(stderr, "lexerStructGen: lexer table too large for narrow LexerNode (%d states, %u tokens)\n", numStates + 1, (unsigned int)tokenMap.size());
+		return -1;
+	}
+	// a toState of -1 means the token can't be extended any further, so give it a dead state with no valid transitions out of it
+	int deadState = numStates;
+	numStates++;
+	for (int i = 0; i<numStates; i++) {
+		for (int j = 0; j<256; j++) {
+			if (nodeToState[i][j] == -1) {
+				nodeToState[i][j] = deadState;
+			}
+		}
+	}
+	// partition the characters into equivalence classes; characters with identical transitions out of every state share a class
+	map<vector<pair<int,int> >, int> classMap;
+	int classOf[256];
+	int classRep[256]; // a representative character for each class
+	for (int j = 0; j<256; j++) {
+		vector<pair<int,int> > column;
+		for (int i = 0; i<numStates; i++) {
+			column.push_back(make_pair(nodeTokenType[i][j], nodeToState[i][j]));
+		}
+		map<vector<pair<int,int> >, int>::iterator classFind = classMap.find(column);
+		if (classFind != classMap.end()) { // if we've seen this column before, reuse its class
+			classOf[j] = classFind->second;
+		} else { // else if this is a new column, allocate a new class for it
+			int newClass = classMap.size();
+			classMap.insert( make_pair(column, newClass) );
+			classOf[j] = newClass;
+			classRep[newClass] = j;
+		}
+	}
+	int numClasses = classMap.size();
 
 	// print out the header notice to the .cpp
 	fprintf(out2, "/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */\n\n");
@@ -128,17 +219,121 @@ int main() {
 	fprintf(out, "unsigned int string2TokenType(string s);\n\n");
 	fprintf(out, "#endif\n");
 
-	// print out the lexer node struct array
-	fprintf(lnr, "const LexerNode lexerNode[256][256] = {\n");
-	for (unsigned int i=0; i < 256; i++) {
+	// print out the character class array and the compressed lexer node struct array
+	fprintf(lnr, "/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */\n\n");
+	fprintf(lnr, "#define LEXER_NUM_STATES %d\n", numStates);
+	fprintf(lnr, "#define LEXER_NUM_CLASSES %d\n\n", numClasses);
+	fprintf(lnr, "static const unsigned char lexerClassOf[256] = {\n");
+	for (unsigned int j=0; j < 256; j++) {
+		fprintf(lnr, "\t%d,\n", classOf[j]);
+	}
+	fprintf(lnr, "};\n\n");
+	fprintf(lnr, "static const LexerNode lexerNode[LEXER_NUM_STATES][LEXER_NUM_CLASSES] = {\n");
+	for (int i=0; i < numStates; i++) {
 		fprintf(lnr, "\t{\n");
-		for (unsigned int j=0; j < 256; j++) {
-			fprintf(lnr, "\t\t{ %d, %d },\n", lexerNode[i][j].tokenType, lexerNode[i][j].toState);
+		for (int k=0; k < numClasses; k++) {
+			fprintf(lnr, "\t\t{ %d, %d },\n", nodeTokenType[i][classRep[k]], nodeToState[i][classRep[k]]);
 		}
 		fprintf(lnr, "\t},\n");
 	}
 	fprintf(lnr, "};\n");
 
+	// print out the direct-coded lexer; this encodes the same DFA as the table above, but as code with the transitions baked in
+	fprintf(lcr, "/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */\n\n");
+	// the general transition function, as a switch over the states and the character classes' members
+	fprintf(lcr, "// returns the transition out of the given state on the given character\n");
+	fprintf(lcr, "inline LexerNode lexerTransition(int state, unsigned char c) {\n");
+	fprintf(lcr, "\tswitch (state) {\n");
+	for (int i=0; i < numStates; i++) {
+		bool stateLogged = false;
+		for (int k=0; k < numClasses; k++) {
+			if (nodeTokenType[i][classRep[k]] == -1) { // invalid transitions fall through to the default
+				continue;
+			}
+			if (!stateLogged) {
+				fprintf(lcr, "\t\tcase %d:\n", i);
+				fprintf(lcr, "\t\t\tswitch (c) {\n");
+				stateLogged = true;
+			}
+			for (int j=0; j < 256; j++) {
+				if (classOf[j] == k) {
+					fprintf(lcr, "\t\t\t\tcase %s:\n", caseLabel(j).c_str());
+				}
+			}
+			fprintf(lcr, "\t\t\t\t\treturn (LexerNode){ %s, %d };\n", tokenName(nodeTokenType[i][classRep[k]]).c_str(), nodeToState[i][classRep[k]]);
+		}
+		if (stateLogged) {
+			fprintf(lcr, "\t\t\t\tdefault:\n");
+			fprintf(lcr, "\t\t\t\t\tbreak;\n");
+			fprintf(lcr, "\t\t\t}\n");
+			fprintf(lcr, "\t\t\tbreak;\n");
+		}
+	}
+	fprintf(lcr, "\t}\n");
+	fprintf(lcr, "\treturn (LexerNode){ -1, 0 };\n");
+	fprintf(lcr, "}\n\n");
+	// the token extension function, as a goto state machine over the regular transitions
+	// if every regular transition into a state carries the same token type, that type is only stored on the way out of the state
+	int stateTokenType[256]; // -1 if there are no regular transitions into the state, -2 if they carry differing token types
+	for (int i=0; i < numStates; i++) {
+		stateTokenType[i] = -1;
+	}
+	for (int i=0; i < numStates; i++) {
+		for (int j=0; j < 256; j++) {
+			if (isRegularTransition(nodeTokenType[i][j])) {
+				int toState = nodeToState[i][j];
+				if (stateTokenType[toState] == -1) {
+					stateTokenType[toState] = nodeTokenType[i][j];
+				} else if (stateTokenType[toState] != nodeTokenType[i][j]) {
+					stateTokenType[toState] = -2;
+				}
+			}
+		}
+	}
+	fprintf(lcr, "// consumes the characters in [cur, limit) that extend the current token through regular transitions, updating state and tokenType\n");
+	fprintf(lcr, "inline void lexerStep(const char *&cur, const char *limit, int &state, int &tokenType) {\n");
+	fprintf(lcr, "\tconst char *p = cur;\n");
+	fprintf(lcr, "\tswitch (state) {\n");
+	for (int i=0; i < numStates; i++) {
+		fprintf(lcr, "\t\tcase %d:\n", i);
+		fprintf(lcr, "\t\t\tgoto lexerState%d;\n", i);
+	}
+	fprintf(lcr, "\t\tdefault:\n");
+	fprintf(lcr, "\t\t\treturn;\n");
+	fprintf(lcr, "\t}\n");
+	for (int i=0; i < numStates; i++) {
+		fprintf(lcr, "lexerState%d:\n", i);
+		// the exit sequence for this state
+		string tokenTypeCode((stateTokenType[i] >= 0) ? ("tokenType = " + tokenName(stateTokenType[i]) + "; ") : "");
+		fprintf(lcr, "\tif (p == limit) {\n");
+		fprintf(lcr, "\t\tstate = %d; %sgoto lexerStepDone;\n", i, tokenTypeCode.c_str());
+		fprintf(lcr, "\t}\n");
+		fprintf(lcr, "\tswitch ((unsigned char)*p) {\n");
+		// group the characters by the transition that they take
+		map<pair<int,int>, vector<int> > transitionGroups;
+		for (int j=0; j < 256; j++) {
+			if (isRegularTransition(nodeTokenType[i][j]) && j != ' ' && j != '\t' && j != '\n' && j != '\r') { // non-regular transitions and whitespace are left to the caller
+				transitionGroups[make_pair(nodeToState[i][j], nodeTokenType[i][j])].push_back(j);
+			}
+		}
+		for (map<pair<int,int>, vector<int> >::iterator groupIter = transitionGroups.begin(); groupIter != transitionGroups.end(); groupIter++) {
+			for (vector<int>::iterator charIter = groupIter->second.begin(); charIter != groupIter->second.end(); charIter++) {
+				fprintf(lcr, "\t\tcase %s:\n", caseLabel(*charIter).c_str());
+			}
+			fprintf(lcr, "\t\t\tp++;\n");
+			if (stateTokenType[groupIter->first.first] < 0) { // if the target state doesn't imply the token type, store it now
+				fprintf(lcr, "\t\t\ttokenType = %s;\n", tokenName(groupIter->first.second).c_str());
+			}
+			fprintf(lcr, "\t\t\tgoto lexerState%d;\n", groupIter->first.first);
+		}
+		fprintf(lcr, "\t\tdefault:\n");
+		fprintf(lcr, "\t\t\tstate = %d; %sgoto lexerStepDone;\n", i, tokenTypeCode.c_str());
+		fprintf(lcr, "\t}\n");
+	}
+	fprintf(lcr, "lexerStepDone:\n");
+	fprintf(lcr, "\tcur = p;\n");
+	fprintf(lcr, "}\n");
+
 	// finally, return normally
 	return 0;
 }
@@ -25,6 +25,11 @@ int main() {
 	if (pnr == NULL) { // if file open failed, return an error
 		return -1;
 	}
+	FILE *pcr;
+	pcr = fopen("./tmp/parserCodeRaw.h","w");
+	if (pcr == NULL) { // if file open failed, return an error
+		return -1;
+	}
 	FILE *rltt;
 	rltt = fopen("./tmp/ruleLhsTokenTypeRaw.h","w");
 	if (rltt == NULL) { // if file open failed, return an error
@@ -40,6 +45,11 @@ int main() {
 	if (rrl == NULL) { // if file open failed, return an error
 		return -1;
 	}
+	FILE *rs;
+	rs = fopen("./tmp/ruleStringRaw.h","w");
+	if (rs == NULL) { // if file open failed, return an error
+		return -1;
+	}
 	
 	// print out the header notice to the .h
 	fprintf(header, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
@@ -142,14 +152,16 @@ int main() {
 		return -1;
 	}
 
-	// print out the ruleLhsTokenType, ruleLshTokenString, and ruleRhsLength header notices
+	// print out the ruleLhsTokenType, ruleLshTokenString, ruleRhsLength, and ruleString header notices
 	fprintf(rltt, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
 	fprintf(rlts, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
 	fprintf(rrl, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
-	// print out the ruleLhsTokenType, ruleLshTokenString, and ruleRhsLength array initializers
-	fprintf(rltt, "const int ruleLhsTokenType[NUM_RULES] = {\n");
-	fprintf(rlts, "const char *ruleLhsTokenString[NUM_RULES] = {\n");
-	fprintf(rrl, "const unsigned int ruleRhsLength[NUM_RULES] = {\n");
+	fprintf(rs, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
+	// print out the ruleLhsTokenType, ruleLshTokenString, ruleRhsLength, and ruleString array initializers
+	fprintf(rltt, "static const unsigned char ruleLhsTokenType[NUM_RULES] = {\n");
+	fprintf(rlts, "static const char *const ruleLhsTokenString[NUM_RULES] = {\n");
+	fprintf(rrl, "static const unsigned char ruleRhsLength[NUM_RULES] = {\n");
+	fprintf(rs, "static const char *const ruleString[NUM_RULES] = {\n");
 	// get rule lengths
 	for (unsigned int i=0; true; i++) { // per-rule line loop
 		// read in a line
@@ -183,12 +195,15 @@ int main() {
 		while (lbCur[0] == ' ' || lbCur[0] == 't') {
 			lbCur++;
 		}
-		// now, count the number of elements on the RHS
+		// now, count the number of elements on the RHS, logging them into the rule's printable form as we go
 		int rhsElements = 0;
+		string ruleText = lhs + " ->";
 		for(;;) {
 			if (sscanf(lbCur, "%s", junk) < 1 || junk[0] == '(') { // break wif we reach the end of the line
 				break;
 			}
+			ruleText += " ";
+			ruleText += junk;
 			// scan over to the next token
 			lbCur += strlen(junk);
 			while (lbCur[0] == ' ' || lbCur[0] == 't') {
@@ -205,10 +220,12 @@ int main() {
 			fprintf(rlts, "\t\"\",\n");
 		}
 		fprintf(rrl, "\t%d,\n", rhsElements);
+		fprintf(rs, "\t\"%s\",\n", ruleText.c_str());
 	}
 	fprintf(rltt, "};\n");
 	fprintf(rlts, "};\n");
 	fprintf(rrl, "};\n");
+	fprintf(rs, "};\n");
 
 	// now, scan ahead to the parse table
 	tableFound = false;
@@ -232,6 +249,7 @@ int main() {
 	}
 
 	// finally, process the raw parse table actions
+	unsigned int numStates = 0; // one more than the highest state number in the table
 	ParserNode parserNode[NUM_RULES][NUM_TOKENS + nonTermCount];
 	for (unsigned int i=0; i < NUM_RULES; i++) {
 		for (unsigned int j=0; j < (NUM_TOKENS + nonTermCount); j++) {
@@ -256,6 +274,9 @@ int main() {
 		}
 		// parse out the state number from the string
 		fromState = atoi(junk);
+		if ((unsigned int)fromState >= numStates) {
+			numStates = fromState+1;
+		}
 		// now, read all of the transitions for this state
 		for(unsigned int i=0; i<tokenOrder.size(); i++) {
 			sscanf(lbCur, "%s", junk); // read a transition
@@ -278,26 +299,150 @@ int main() {
 		}
 	}
 
-	// print out the parserNode array initializer
-	fprintf(pnr, "const ParserNode parserNode[NUM_RULES][NUM_LABELS] = {\n");
-	// per-rule loop
-	for (unsigned int i=0; i < NUM_RULES; i++) {
-		fprintf(pnr, "\t{\n");
-		// per-label loop
-		for (unsigned int j=0; j < (NUM_TOKENS + nonTermCount); j++) {
-			string actionString = (
-				parserNode[i][j].action == ACTION_SHIFT ? "ACTION_SHIFT" :
-				parserNode[i][j].action == ACTION_REDUCE ? "ACTION_REDUCE" :
-				parserNode[i][j].action == ACTION_ACCEPT ? "ACTION_ACCEPT" :
-				parserNode[i][j].action == ACTION_GOTO ? "ACTION_GOTO" :
-				parserNode[i][j].action == ACTION_ERROR ? "ACTION_ERROR" :
-				""
-			);
-			fprintf(pnr, "\t\t{ %s, %u }, /* [%u][%u] */\n", actionString.c_str(), parserNode[i][j].n, i, j);
-		}
-		fprintf(pnr, "\t},\n");
+	// now, compress the table; the labels of all states are overlaid into one comb vector, with each state's row placed at a displacement
+	// where its explicit entries don't collide with those of the rows placed before it, and with a per-state default action for everything else
+	unsigned int numLabels = NUM_TOKENS + nonTermCount;
+	if (numStates > PARSER_CHECK_EMPTY || numLabels > UCHAR_MAX+1) { // if the states or labels won't fit into the narrow table types, return an error
+		return -1;
+	}
+	// first, pick each state's default action: its most common reduction, if it has any, or an error otherwise
+	// (defaulting error entries to a reduction only delays the detection of a syntax error until the next shift would take place, which never happens)
+	vector<unsigned short> parserDefault(numStates);
+	for (unsigned int i=0; i < numStates; i++) {
+		map<unsigned int, unsigned int> reductionCounts;
+		for (unsigned int j=0; j < NUM_TOKENS; j++) {
+			if (parserNode[i][j].action == ACTION_REDUCE) {
+				reductionCounts[parserNode[i][j].n]++;
+			}
+		}
+		parserDefault[i] = PARSER_ENTRY(ACTION_ERROR, 0);
+		unsigned int bestCount = 0;
+		for (map<unsigned int, unsigned int>::iterator iter = reductionCounts.begin(); iter != reductionCounts.end(); iter++) {
+			if (iter->second > bestCount) {
+				parserDefault[i] = PARSER_ENTRY(ACTION_REDUCE, iter->first);
+				bestCount = iter->second;
+			}
+		}
+	}
+	// next, collect the explicit entries of each state (everything that's neither an error nor the default action)
+	vector<vector<pair<unsigned int, unsigned short> > > rows(numStates);
+	for (unsigned int i=0; i < numStates; i++) {
+		for (unsigned int j=0; j < numLabels; j++) {
+			if (parserNode[i][j].action == ACTION_ERROR) {
+				continue;
+			}
+			if (parserNode[i][j].n > PARSER_ENTRY_N_MASK) { // if the target won't fit into an entry, return an error
+				return -1;
+			}
+			unsigned short entry = PARSER_ENTRY(parserNode[i][j].action, parserNode[i][j].n);
+			if (entry != parserDefault[i]) {
+				rows[i].push_back(make_pair(j, entry));
+			}
+		}
+	}
+	// place the rows into the comb vector, densest first, at the lowest displacement that fits
+	vector<pair<unsigned int, unsigned int> > rowOrder; // (explicit entry count, state)
+	for (unsigned int i=0; i < numStates; i++) {
+		rowOrder.push_back(make_pair(rows[i].size(), i));
+	}
+	sort(rowOrder.rbegin(), rowOrder.rend());
+	vector<unsigned int> parserBase(numStates, 0);
+	vector<unsigned short> parserCheck;
+	vector<unsigned short> parserNext;
+	for (unsigned int k=0; k < rowOrder.size(); k++) {
+		unsigned int state = rowOrder[k].second;
+		vector<pair<unsigned int, unsigned short> > &row = rows[state];
+		unsigned int base = 0;
+		for(;;) {
+			bool fits = true;
+			for (unsigned int e=0; e < row.size(); e++) {
+				unsigned int slot = base + row[e].first;
+				if (slot < parserCheck.size() && parserCheck[slot] != PARSER_CHECK_EMPTY) {
+					fits = false;
+					break;
+				}
+			}
+			if (fits) {
+				break;
+			}
+			base++;
+		}
+		parserBase[state] = base;
+		// make sure that any label looked up from this row stays in bounds
+		if (parserCheck.size() < base + numLabels) {
+			parserCheck.resize(base + numLabels, PARSER_CHECK_EMPTY);
+			parserNext.resize(base + numLabels, PARSER_ENTRY(ACTION_ERROR, 0));
+		}
+		for (unsigned int e=0; e < row.size(); e++) {
+			parserCheck[base + row[e].first] = state;
+			parserNext[base + row[e].first] = row[e].second;
+		}
+	}
+	if (parserCheck.size() > USHRT_MAX) { // if the displacements won't fit into the narrow table type, return an error
+		return -1;
+	}
+
+	// print out the compressed table initializers
+	fprintf(pnr, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
+	fprintf(pnr, "#define NUM_STATES %u\n", numStates);
+	fprintf(pnr, "#define PARSER_TABLE_SIZE %u\n\n", (unsigned int)parserCheck.size());
+	fprintf(pnr, "static const unsigned short parserDefault[NUM_STATES] = {\n");
+	for (unsigned int i=0; i < numStates; i++) {
+		fprintf(pnr, "\t%u, /* [%u] */\n", parserDefault[i], i);
+	}
+	fprintf(pnr, "};\n\n");
+	fprintf(pnr, "static const unsigned short parserBase[NUM_STATES] = {\n");
+	for (unsigned int i=0; i < numStates; i++) {
+		fprintf(pnr, "\t%u, /* [%u] */\n", parserBase[i], i);
+	}
+	fprintf(pnr, "};\n\n");
+	fprintf(pnr, "static const unsigned short parserCheck[PARSER_TABLE_SIZE] = {");
+	for (unsigned int i=0; i < parserCheck.size(); i++) {
+		fprintf(pnr, "%s%u,", (i % 16 == 0) ? "\n\t" : " ", parserCheck[i]);
+	}
+	fprintf(pnr, "\n};\n\n");
+	fprintf(pnr, "static const unsigned short parserNext[PARSER_TABLE_SIZE] = {");
+	for (unsigned int i=0; i < parserNext.size(); i++) {
+		fprintf(pnr, "%s%u,", (i % 16 == 0) ? "\n\t" : " ", parserNext[i]);
+	}
+	fprintf(pnr, "\n};\n");
+
+	// print out the direct-coded parser; this encodes the same automaton as the tables above, but with each state's row compiled into a switch
+	vector<string> labelName(numLabels);
+	for (map<string, unsigned int>::iterator iter = tokenClassifier.begin(); iter != tokenClassifier.end(); iter++) {
+		labelName[iter->second] = iter->first;
+	}
+	static const char *actionName[] = {"", "ACTION_SHIFT", "ACTION_REDUCE", "ACTION_ACCEPT", "ACTION_GOTO", "ACTION_ERROR"}; // indexed by the ACTION_ defines
+	fprintf(pcr, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
+	fprintf(pcr, "#define NUM_STATES %u\n\n", numStates);
+	fprintf(pcr, "// returns the parse table entry for the given state and label\n");
+	fprintf(pcr, "inline ParserNode parserTransition(unsigned int state, unsigned int label) {\n");
+	fprintf(pcr, "\tswitch (state) {\n");
+	for (unsigned int i=0; i < numStates; i++) {
+		fprintf(pcr, "\t\tcase %u:\n", i);
+		// group the state's explicit entries by action, so that each distinct action is emitted once
+		map<unsigned short, vector<unsigned int> > entryLabels;
+		for (unsigned int e=0; e < rows[i].size(); e++) {
+			entryLabels[rows[i][e].second].push_back(rows[i][e].first);
+		}
+		if (!entryLabels.empty()) {
+			fprintf(pcr, "\t\t\tswitch (label) {\n");
+			for (map<unsigned short, vector<unsigned int> >::iterator iter = entryLabels.begin(); iter != entryLabels.end(); iter++) {
+				for (unsigned int k=0; k < iter->second.size(); k++) {
+					fprintf(pcr, "\t\t\t\tcase %s:\n", labelName[iter->second[k]].c_str());
+				}
+				fprintf(pcr, "\t\t\t\t\treturn (ParserNode){ %s, %u };\n", actionName[PARSER_ENTRY_ACTION(iter->first)], PARSER_ENTRY_N(iter->first));
+			}
+			fprintf(pcr, "\t\t\t\tdefault:\n");
+			fprintf(pcr, "\t\t\t\t\tbreak;\n");
+			fprintf(pcr, "\t\t\t}\n");
+		}
+		fprintf(pcr, "\t\t\treturn (ParserNode){ %s, %u };\n", actionName[PARSER_ENTRY_ACTION(parserDefault[i])], PARSER_ENTRY_N(parserDefault[i]));
 	}
-	fprintf(pnr, "};\n");
+	fprintf(pcr, "\t\tdefault:\n");
+	fprintf(pcr, "\t\t\treturn (ParserNode){ ACTION_ERROR, 0 };\n");
+	fprintf(pcr, "\t}\n");
+	fprintf(pcr, "}\n");
 
 	// finally, return normally
 	return 0;
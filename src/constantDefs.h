@@ -15,6 +15,17 @@
 #define MAX_TAB_MODULUS 80
 #define TAB_MODULUS_DEFAULT 4
 
+#define MIN_JOBS 1
+#define MAX_JOBS 256
+#define JOBS_DEFAULT 1
+
+#define CACHE_DIRECTORY_DEFAULT "" /* no parse cache */
+
+#define PARSER_PROFILE_NONE 0
+#define PARSER_PROFILE_TEXT 1
+#define PARSER_PROFILE_JSON 2
+#define PARSER_PROFILE_DEFAULT PARSER_PROFILE_NONE
+
 #define TOLERABLE_ERROR_LIMIT 256
 
 #define MAX_STRING_LENGTH (sizeof(char)*4096)
@@ -30,6 +41,24 @@
 #define STANDARD_LIBRARY_FILE_INDEX UINT_MAX
 #define STANDARD_LIBRARY_FILE_NAME "<stdlib>"
 
+#define NO_SOURCE_OFFSET UINT_MAX
+
+#define TREE_ARENA_BLOCK_SIZE (64*1024) /* must be a power of two; blocks are aligned to their size, so a node can find its arena from its own address */
+#define TREE_ARENA_ALIGNMENT 8
+
+#define PARSER_STATE_STACK_RESERVE 4096
+
+#define ATOM_TABLE_INITIAL_SIZE 4096 /* must be a power of two */
+#define ATOM_MAP_INITIAL_SIZE 4 /* must be a power of two */
+#define ATOM_MAP_HASH_MULTIPLIER 2654435761U /* odd, so that atoms map to slots one-to-one modulo any power of two */
+#define BINDING_CACHE_SIZE 4096 /* in entries; must be a power of two */
+#define TYPE_TABLE_INITIAL_SIZE 256 /* must be a power of two */
+
+#define PARSE_CACHE_MAGIC "ANIPTC2" /* 8 bytes, including the terminator; bump the digit whenever the cache file layout changes */
+#define PARSE_CACHE_CHECKSUM_SEED 14695981039346656037ULL /* the FNV-1a offset basis */
+#define PARSE_CACHE_SUFFIX ".ptc"
+#define PARSE_CACHE_MAX_SOURCE_SIZE 0x80000000U /* sources this big aren't cached, so that their offsets always fit in a signed delta */
+
 #define BLOCK_NODE_STRING "{}"
 #define FILTER_NODE_STRING "[Tx]"
 #define OBJECT_NODE_STRING "[]"
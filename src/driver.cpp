@@ -20,8 +20,12 @@ bool silentMode = SILENT_MODE_DEFAULT;
 bool codedOutput = CODED_OUTPUT_DEFAULT;
 int tabModulus = TAB_MODULUS_DEFAULT;
 bool eventuallyGiveUp = EVENTUALLY_GIVE_UP_DEFAULT;
+int numJobs = JOBS_DEFAULT;
+string cacheDirectory(CACHE_DIRECTORY_DEFAULT); // where parse trees are cached, or empty if they aren't
+int parserProfileMode = PARSER_PROFILE_DEFAULT;
 
 vector<string> inFileNames; // source file name vector
+vector<SourceBuffer *> inFiles; // source file contents vector
 
 // header print functions
 
@@ -78,6 +82,101 @@ int containsString(vector<string> inFileNames, string &s) {
 	return 0;
 }
 
+// per-file front end jobs
+
+// the front end state of a single source file; files are lexed and parsed independently of each other, so each keeps its own results and error flags
+class FileJob {
+	public:
+		// data members
+		unsigned int fileIndex;
+		TreeArena arena; // the storage for the parse tree; it lives for the rest of the compilation, since the tree is latched into the trunk
+		Tree *parseme; // the output of the parser
+		int parseError; // the number of lexical and syntax errors in the file
+		ParserProfile profile; // the parser statistics for the file, if we're profiling
+		ostringstream out, err; // buffered output, for when the file is processed on a worker thread
+		// allocators/deallocators
+		FileJob(unsigned int fileIndex) : fileIndex(fileIndex), arena(fileIndex), parseme(NULL), parseError(0) {}
+};
+
+// returns the parse cache key of the given source; a 64-bit FNV-1a hash of the compiler's version stamp and the source contents
+uint64_t getCacheKey(SourceBuffer *in) {
+	static const char versionStamp[] = VERSION_STRING "." VERSION_STAMP;
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned int i=0; i < sizeof(versionStamp); i++) { // including the terminator, to separate the stamp from the contents
+		hash = (hash ^ (unsigned char)versionStamp[i]) * 1099511628211ULL;
+	}
+	for (size_t i=0; i < in->size; i++) {
+		hash = (hash ^ (unsigned char)(in->data[i])) * 1099511628211ULL;
+	}
+	return hash;
+}
+
+// lexes and parses the job's file in one pass; the parser pulls tokens out of the lexer as it needs them
+// if there's a parse cache, the tree is loaded from it instead whenever possible, and saved to it otherwise
+void runJob(FileJob *job, ostream &outStream, ostream &errorStream) {
+	SourceBuffer *in = inFiles[job->fileIndex];
+	uint64_t cacheKey = 0;
+	string cacheFileName;
+	if (!cacheDirectory.empty()) {
+		cacheKey = getCacheKey(in);
+		char keyString[MAX_INT_STRING_LENGTH];
+		sprintf(keyString, "%016llx", (unsigned long long)cacheKey);
+		cacheFileName = cacheDirectory + "/" + keyString + PARSE_CACHE_SUFFIX;
+		job->parseme = loadTree(job->arena, in, cacheKey, cacheFileName);
+		if (job->parseme != NULL) { // if we got the tree out of the cache, we're done with the front end
+			VERBOSE( outStream << PROGRAM_STRING << ": loaded cached parse tree of file \'" << inFileNames[job->fileIndex] << "\'.\n"; )
+			lowerTree(job->parseme, job->arena);
+			return;
+		}
+	}
+	Lexer lexer(in, job->fileIndex, errorStream);
+	job->parseError = parse(lexer, job->parseme, job->arena, outStream, errorStream, (parserProfileMode != PARSER_PROFILE_NONE) ? &(job->profile) : NULL);
+	if (!(job->parseError)) { // if parsing succeeded, cache the tree and lower its Terms for the semmer
+		if (!cacheDirectory.empty()) {
+			saveTree(job->parseme, job->arena, in, cacheKey, cacheFileName);
+		}
+		lowerTree(job->parseme, job->arena);
+	}
+}
+
+vector<FileJob *> jobs; // per-file jobs, in command-line order
+unsigned int nextJob = 0; // the index of the next job that a worker thread should claim
+pthread_mutex_t nextJobMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// worker thread body; keeps claiming unprocessed files, lexing and parsing each one into its own output buffers
+void *jobWorker(void *) {
+	for(;;) {
+		// claim the next job
+		pthread_mutex_lock(&nextJobMutex);
+		unsigned int i = nextJob++;
+		pthread_mutex_unlock(&nextJobMutex);
+		if (i >= jobs.size()) { // if there are no more jobs, we're done
+			break;
+		}
+		// process the job
+		FileJob *job = jobs[i];
+		runJob(job, job->out, job->err);
+	}
+	return NULL;
+}
+
+// runs all of the jobs on a pool of numJobs threads (including the calling one), returning once they are all done
+void runJobs() {
+	vector<pthread_t> threads;
+	for (int i=1; i < numJobs && (unsigned int)i < jobs.size(); i++) {
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, jobWorker, NULL) == 0) { // if we managed to start the thread, log it
+			threads.push_back(thread);
+		} // else if we couldn't start the thread, the remaining threads simply pick up its share of the work
+	}
+	// pitch in on the calling thread
+	jobWorker(NULL);
+	// wait for the other threads to finish
+	for (unsigned int i=0; i < threads.size(); i++) {
+		pthread_join(threads[i], NULL);
+	}
+}
+
 // main driver function
 
 int main(int argc, char **argv) {
@@ -93,7 +192,6 @@ int main(int argc, char **argv) {
 	}
 	
 	// parse the command-line arguments
-	vector<ifstream *> inFiles; // source file vector
 	string outFileName(OUTPUT_FILE_DEFAULT); // initialize the output file name
 	// handled flags for each option
 	bool oHandled = false;
@@ -103,6 +201,9 @@ int main(int argc, char **argv) {
 	bool cHandled = false;
 	bool tHandled = false;
 	bool eHandled = false;
+	bool jHandled = false;
+	bool dHandled = false;
+	bool rHandled = false;
 	for (int i=1; i<argc; i++) {
 		if (argv[i][0] == '-' && argv[i][1] != '\0') { // option argument
 			if (argv[i][1] == 'o' && argv[i][2] == '\0' && !oHandled) { // output file name
@@ -171,6 +272,52 @@ int main(int argc, char **argv) {
 				eventuallyGiveUp = false;
 				// flag this option as handled
 				eHandled = true;
+			} else if (argv[i][1] == 'j' && argv[i][2] == '\0' && !jHandled) {
+				if (++i >= argc) { // jump to the next argument, test if it doesn't exist
+					printError("-j expected job count argument");
+					die();
+				}
+				int n;
+				if (sscanf(argv[i], "%d", &n) < 1) { // unsuccessful attempt to extract a number out of the argument
+					printError("-j got illegal job count '" << argv[i] << "'");
+					die();
+				} else { // else attempt was successful
+					if (n >= MIN_JOBS && n <= MAX_JOBS) {
+						numJobs = n;
+					} else {
+						printError("-j got out-of-bounds job count " << n);
+						die();
+					}
+				}
+				// flag this option as handled
+				jHandled = true;
+			} else if (argv[i][1] == 'd' && argv[i][2] == '\0' && !dHandled) { // parse cache option
+				if (++i >= argc) { // jump to the next argument, test if it doesn't exist
+					printError("-d expected cache directory argument");
+					die();
+				}
+				cacheDirectory = argv[i];
+				if (mkdir(cacheDirectory.c_str(), 0777) != 0 && errno != EEXIST) { // if we can't create the directory, carry on without the cache
+					printWarning("cannot create cache directory '" << cacheDirectory << "', not caching parse trees");
+					cacheDirectory = CACHE_DIRECTORY_DEFAULT;
+				}
+				// flag this option as handled
+				dHandled = true;
+			} else if (argv[i][1] == 'r' && argv[i][2] == '\0' && !rHandled) { // parser profiling option
+				if (++i >= argc) { // jump to the next argument, test if it doesn't exist
+					printError("-r expected profile format argument");
+					die();
+				}
+				if (strcmp(argv[i], "text") == 0) {
+					parserProfileMode = PARSER_PROFILE_TEXT;
+				} else if (strcmp(argv[i], "json") == 0) {
+					parserProfileMode = PARSER_PROFILE_JSON;
+				} else {
+					printError("-r got illegal profile format '" << argv[i] << "'");
+					die();
+				}
+				// flag this option as handled
+				rHandled = true;
 			} else if (argv[i][1] == 'h' && argv[i][2] == '\0' && argc == 2) {
 				// test to see if a command interpreter is available
 				int systemRetVal = system(NULL);
@@ -196,9 +343,10 @@ int main(int argc, char **argv) {
 				printWarning("including file '" << fileName << "' multiple times");
 				continue;
 			}
-			ifstream *inFile = (fileName == STD_IN_FILE_NAME) ? NULL : new ifstream(fileName.c_str()); // create a stream for this file
-			if (inFile != NULL && !inFile->good()) { // if file open failed
+			SourceBuffer *inFile = new SourceBuffer(); // map in the contents of this file
+			if (!inFile->load(fileName)) { // if file open failed
 				printError("cannot open input file '" << fileName << "'");
+				delete inFile;
 			} else { // else if file open succeeded, add the file and its name to the appropriate vectors
 				inFiles.push_back(inFile);
 				inFileNames.push_back(fileName);
@@ -214,55 +362,32 @@ int main(int argc, char **argv) {
 		die();
 	}
 
-	// lex files
-	int lexerError = 0; // error flag
-	vector<vector<Token> *> lexemes; // per-file vector of the lexemes that the lexer is about to generate
+	// set up the per-file jobs
 	for (unsigned int i=0; i<inFiles.size(); i++) {
-		// check file arguments
-		string fileName(inFileNames[i]);
-		if (fileName == "-") {
-			fileName = STD_IN_FILE_NAME;
-		}
-		VERBOSE(
-			printNotice("lexing file \'" << fileName << "\'...");
-		)
-		// do the actual lexing
-		int thisLexError = 0; // one-shot error flag
-		vector<Token> *lexeme = lex(inFiles[i], i);
-		if (lexeme == NULL) { // if lexing failed with an error, log the error condition
-			thisLexError = 1;
-		} else { // else if lexing was successful, log the lexeme to the vector
-			lexemes.push_back(lexeme);
-		}
-		// print out the tokens if we're in verbose mode
-		VERBOSE(
-			if (!thisLexError) {
-				printNotice(COLOREXP(SET_TERM(GREEN_CODE)) << "successfully lexed file \'" << fileName << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
-			} else {
-				printNotice(COLOREXP(SET_TERM(RED_CODE)) << "failed to lex file \'" << fileName << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
-			}
-			print(""); // new line
-		)
-		// log the highest error code that occured
-		if (thisLexError > lexerError) {
-			lexerError = thisLexError;
-		}
+		jobs.push_back(new FileJob(i));
 	}
-	// now, check if lexing failed and if so, kill the system as appropriate
-	if (lexerError) {
-		die(1);
+	// if we're allowed multiple jobs, lex and parse all of the files up front on a thread pool; the loop below then replays each file's buffered output in command-line order
+	if (numJobs > 1) {
+		runJobs();
 	}
 
-	// parse lexemes
+	// lex and parse files
 	int parserError = 0; // error flag
+	ParserProfile parserProfile; // the sum of the files' parser statistics
 	Tree *treeRoot = NULL; // the root parseme of the parse tree
 	Tree *treeCur = NULL; // the tail of the linked list of parsemes
-	unsigned int fileIndex = 0; // current lexeme's file name index
-	for (vector<vector<Token> *>::iterator lexemeIter = lexemes.begin(); lexemeIter != lexemes.end(); lexemeIter++) {
+	for (unsigned int fileIndex = 0; fileIndex < jobs.size(); fileIndex++) {
 		VERBOSE(printNotice("parsing file \'" << inFileNames[fileIndex] << "\'...");)
-		// do the actual parsing
-		Tree *thisParseme;
-		int thisParseError = parse(*lexemeIter, thisParseme, fileIndex);
+		// do the actual parsing, or replay its output if it was already done on the thread pool
+		FileJob *job = jobs[fileIndex];
+		if (numJobs > 1) {
+			cout << job->out.str();
+			cerr << job->err.str();
+		} else {
+			runJob(job, cout, cerr);
+		}
+		Tree *thisParseme = job->parseme;
+		int thisParseError = job->parseError;
 		if (thisParseError) { // if parsing failed with an error, log the error condition
 			VERBOSE(
 				printNotice(COLOREXP(SET_TERM(RED_CODE)) << "failed to parse file \'" << inFileNames[fileIndex] << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
@@ -282,6 +407,9 @@ int main(int argc, char **argv) {
 			}
 			VERBOSE(
 				printNotice(COLOREXP(SET_TERM(GREEN_CODE)) << "successfully parsed file \'" << inFileNames[fileIndex] << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
+				char bytesString[MAX_STRING_LENGTH];
+				sprintf(bytesString, "%.1f", (double)(job->arena.bytes())/job->arena.numNodes());
+				printNotice("parse tree: " << job->arena.numNodes() << " nodes, " << bytesString << " bytes/node");
 				print(""); // new line
 			)
 		}
@@ -289,8 +417,11 @@ int main(int argc, char **argv) {
 		if (thisParseError > parserError) {
 			parserError = thisParseError;
 		}
-		// advance the file index
-		fileIndex++;
+		parserProfile += job->profile;
+	}
+	// if we're profiling the parser, report on it
+	if (parserProfileMode != PARSER_PROFILE_NONE && !silentMode) {
+		parserProfile.report(cout, parserProfileMode);
 	}
 	// now, check if parsing failed and if so, kill the system as appropriate
 	if (parserError) {
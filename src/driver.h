@@ -33,7 +33,7 @@
 #define WARNING_STRING COLOREXP(SET_TERM(BRIGHT_CODE AND YELLOW_CODE))<<"WARNING"<<COLOREXP(SET_TERM(RESET_CODE))
 
 #define HEADER_LITERAL PROGRAM_STRING<<" -- "<<LANGUAGE_STRING<<" Compiler v.["<<VERSION_STRING<<"."<<VERSION_STAMP<<"] (c) "<<VERSION_YEAR<<" Kajetan Adrian Biedrzycki\n" /* compiler header */
-#define USAGE_LITERAL "\n\tusage:\t"<<PROGRAM_STRING<<" sourceFile... [-] [-o outputFile] [-p optimizationLevel]\n\t\t[-v] [-s] [-c] [-t tabWidth] [-e] [-h]\n" /* info literal */
+#define USAGE_LITERAL "\n\tusage:\t"<<PROGRAM_STRING<<" sourceFile... [-] [-o outputFile] [-p optimizationLevel]\n\t\t[-v] [-s] [-c] [-t tabWidth] [-e] [-j jobs]\n\t\t[-d cacheDirectory] [-r profileFormat] [-h]\n" /* info literal */
 #define SEE_ALSO_LITERAL "\n\tFor more information, type '"<<PROGRAM_STRING<<" -h'.\n" /* see also literal */
 #define LINK_LITERAL "\thome page: "<<HOME_PAGE<<"\n" /* link literal */
 
@@ -47,26 +47,26 @@
 
 #define GET_FILE_NAME(fi) ((fi != STANDARD_LIBRARY_FILE_INDEX) ? inFileNames[fi] : STANDARD_LIBRARY_FILE_NAME)
 
-#define lexerError(fi,r,c,str) if (!silentMode) { silentMode = true; \
-		cerr << ERROR_STRING << ": " << \
+// the lexer and parser report to the errorStream and count into the lexerErrorCode/parserErrorCode of the function using them, since files may be processed concurrently
+#define lexerError(fi,r,c,str) if (!silentMode) { \
+		errorStream << ERROR_STRING << ": " << \
 		COLOREXP(SET_TERM(CYAN_CODE)) << "LEXER" << COLOREXP(SET_TERM(RESET_CODE)) << \
-		": " << COLOREXP(SET_TERM(BRIGHT_CODE AND BLACK_CODE)) << GET_FILE_NAME(fi) << ":" << r << ":" << c << COLOREXP(SET_TERM(RESET_CODE)) << ": " << str << ".\n"; \
-		silentMode = false; } \
+		": " << COLOREXP(SET_TERM(BRIGHT_CODE AND BLACK_CODE)) << GET_FILE_NAME(fi) << ":" << r << ":" << c << COLOREXP(SET_TERM(RESET_CODE)) << ": " << str << ".\n"; } \
 	lexerErrorCode++; \
-	if (eventuallyGiveUp && lexerErrorCode >= TOLERABLE_ERROR_LIMIT) { printError("too many errors, giving up"); return NULL; }
+	if (eventuallyGiveUp && lexerErrorCode >= TOLERABLE_ERROR_LIMIT) { if (!silentMode) { errorStream << ERROR_STRING << ": too many errors, giving up.\n"; } return NULL; }
 
-#define parserError(fi,r,c,str) if (!silentMode) { silentMode = true; \
-		cerr << ERROR_STRING << ": "<< \
+#define parserError(fi,r,c,str) if (!silentMode) { \
+		errorStream << ERROR_STRING << ": "<< \
 		COLOREXP(SET_TERM(CYAN_CODE)) << "PARSER" << COLOREXP(SET_TERM(RESET_CODE)) << \
-		": " << COLOREXP(SET_TERM(BRIGHT_CODE AND BLACK_CODE)) << GET_FILE_NAME(fi) << ":" << r << ":" << c << COLOREXP(SET_TERM(RESET_CODE)) << ": " << str << ".\n"; \
-		silentMode = false; } \
+		": " << COLOREXP(SET_TERM(BRIGHT_CODE AND BLACK_CODE)) << GET_FILE_NAME(fi) << ":" << r << ":" << c << COLOREXP(SET_TERM(RESET_CODE)) << ": " << str << ".\n"; } \
 	parserErrorCode++;
 
-#define semmerError(fi,r,c,str) if (!silentMode) { silentMode = true; \
-		cerr << ERROR_STRING << ": "<< \
+// the semmer reports to the semmerErrorStream and counts into the semmerErrorCode of the current thread, suppressing any errors raised while building the message itself
+#define semmerError(fi,r,c,str) if (!silentMode && !semmerErrorNested) { semmerErrorNested = true; \
+		*semmerErrorStream << ERROR_STRING << ": "<< \
 		COLOREXP(SET_TERM(CYAN_CODE)) << "SEMMER" << COLOREXP(SET_TERM(RESET_CODE)) << \
 		": " << COLOREXP(SET_TERM(BRIGHT_CODE AND BLACK_CODE)) << GET_FILE_NAME(fi) << ":" << r << ":" << c << COLOREXP(SET_TERM(RESET_CODE)) << ": " << str << ".\n"; \
-		silentMode = false; } \
+		semmerErrorNested = false; } \
 	semmerErrorCode++;
 
 void printHeader(void);
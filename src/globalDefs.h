@@ -5,11 +5,15 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <new>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <deque>
 #include <stack>
+#include <algorithm>
 
 #include <stdlib.h>
 #include <unistd.h>
@@ -17,6 +21,12 @@
 #include <stdint.h>
 #include <string.h>
 #include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <pthread.h>
 
 using std::cin;
 using std::cout;
@@ -25,19 +35,30 @@ using std::endl;
 using std::flush;
 using std::ifstream;
 using std::ofstream;
+using std::ostringstream;
 using std::ostream;
 using std::string;
 using std::vector;
 using std::deque;
 using std::map;
+using std::set;
 using std::stack;
 using std::pair;
 using std::make_pair;
+using std::upper_bound;
+using std::sort;
+using std::max;
+using std::min;
 
 // class forward declarations
 
+class SourceBuffer;
 class Tree;
+class TreeArena;
+class AstTerm;
 class SymbolTree;
+class AtomTable;
+class BindingCache;
 class Type;
 class TypeList;
 class StdType;
@@ -48,6 +69,7 @@ class MemberListResult;
 class MemberList;
 class ObjectType;
 class ErrorType;
+class TypeTable;
 class TypeStatus;
 class IRTree;
 	class LabelTree;
@@ -82,13 +104,17 @@ extern bool silentMode;
 extern bool codedOutput;
 extern int tabModulus;
 extern bool eventuallyGiveUp;
+extern int numJobs;
+extern string cacheDirectory;
+extern int parserProfileMode;
 
 extern vector<string> inFileNames;
+extern vector<SourceBuffer *> inFiles;
 
 extern int driverErrorCode;
-extern int lexerErrorCode;
-extern int parserErrorCode;
-extern int semmerErrorCode;
+extern __thread int semmerErrorCode; // per-thread, since independent declarations may be analyzed concurrently
+extern __thread bool semmerErrorNested;
+extern __thread ostream *semmerErrorStream;
 extern int gennerErrorCode;
 
 extern Type *nullType;
@@ -119,6 +145,9 @@ extern ObjectType *stringCompOpType;
 
 extern StdType *stdLibType;
 extern SymbolTree *stdLib;
+extern AtomTable atomTable;
+extern BindingCache bindingCache;
+extern TypeTable typeTable;
 
 extern IRTree *nopCode;
 
@@ -2,16 +2,46 @@
 
 #include "outputOperators.h"
 
-// lexer-global variables
-
-int lexerErrorCode;
+// vector instruction selection for the bulk input scanners; AVX2 is used when the compiler targets it (e.g. -march=native), SSE2 otherwise on x86
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_WIDTH 32
+typedef __m256i ScanVector;
+#define SCAN_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define SCAN_SPLAT(c) _mm256_set1_epi8(c)
+#define SCAN_EQ(a,b) _mm256_cmpeq_epi8((a),(b))
+#define SCAN_OR(a,b) _mm256_or_si256((a),(b))
+#define SCAN_AND(a,b) _mm256_and_si256((a),(b))
+#define SCAN_MASK(v) ((unsigned int)_mm256_movemask_epi8(v))
+#define SCAN_FULL_MASK 0xFFFFFFFFu
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_WIDTH 16
+typedef __m128i ScanVector;
+#define SCAN_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define SCAN_SPLAT(c) _mm_set1_epi8(c)
+#define SCAN_EQ(a,b) _mm_cmpeq_epi8((a),(b))
+#define SCAN_OR(a,b) _mm_or_si128((a),(b))
+#define SCAN_AND(a,b) _mm_and_si128((a),(b))
+#define SCAN_MASK(v) ((unsigned int)_mm_movemask_epi8(v))
+#define SCAN_FULL_MASK 0xFFFFu
+#endif
 
 // Token functions
-Token::Token(int tokenType) : tokenType(tokenType), fileIndex(STANDARD_LIBRARY_FILE_INDEX), row(0), col(0) {}
-Token::Token(int tokenType, const string &s, unsigned int fileIndex, int row, int col) : tokenType(tokenType), s(s), fileIndex(fileIndex), row(row), col(col) {}
-Token::Token(const Token &otherToken) : tokenType(otherToken.tokenType), s(otherToken.s), fileIndex(otherToken.fileIndex), row(otherToken.row), col(otherToken.col) {}
+Token::Token(int tokenType) : tokenType(tokenType), fileIndex(STANDARD_LIBRARY_FILE_INDEX), str(""), len(0), offset(NO_SOURCE_OFFSET) {}
+Token::Token(int tokenType, const char *str, unsigned int len, unsigned int fileIndex, unsigned int offset) : tokenType(tokenType), fileIndex(fileIndex), str(str), len(len), offset(offset) {}
+Token::Token(const Token &otherToken) : tokenType(otherToken.tokenType), fileIndex(otherToken.fileIndex), str(otherToken.str), len(otherToken.len), offset(otherToken.offset) {}
 Token::~Token() {}
-Token &Token::operator=(Token &otherToken) {tokenType = otherToken.tokenType; s = otherToken.s; fileIndex = otherToken.fileIndex; row = otherToken.row; col = otherToken.col; return *this;}
+string Token::s() const {
+	return string(str, len);
+}
+int Token::row() const {
+	return (fileIndex != STANDARD_LIBRARY_FILE_INDEX && offset != NO_SOURCE_OFFSET) ? inFiles[fileIndex]->row(offset) : 0;
+}
+int Token::col() const {
+	return (fileIndex != STANDARD_LIBRARY_FILE_INDEX && offset != NO_SOURCE_OFFSET) ? inFiles[fileIndex]->col(offset) : 0;
+}
+Token &Token::operator=(const Token &otherToken) {tokenType = otherToken.tokenType; str = otherToken.str; len = otherToken.len; fileIndex = otherToken.fileIndex; offset = otherToken.offset; return *this;}
 Token::operator string() const {
 	string acc("[");
 	COLOR( acc += SET_TERM(BRIGHT_CODE AND CYAN_CODE); )
@@ -19,19 +49,133 @@ Token::operator string() const {
 	COLOR( acc += SET_TERM(RESET_CODE); )
 	acc += ' ';
 	COLOR( acc += SET_TERM(BRIGHT_CODE AND WHITE_CODE); )
-	acc += s;
+	acc.append(str, len);
 	COLOR( acc += SET_TERM(RESET_CODE); )
 	acc += " (";
 	char tempBuf[MAX_INT_STRING_LENGTH];
-	sprintf(tempBuf, "%d", row);
+	sprintf(tempBuf, "%d", row());
 	acc += tempBuf;
 	acc += ',';
-	sprintf(tempBuf, "%d", col);
+	sprintf(tempBuf, "%d", col());
 	acc += tempBuf;
 	acc += ")]";
 	return acc;
 }
 
+// TokenStream functions
+TokenStream::TokenStream(unsigned int fileIndex) : fileIndex(fileIndex) {}
+TokenStream::~TokenStream() {}
+void TokenStream::add(int tokenType, const char *str, unsigned int len, unsigned int offset) {
+	tokenTypes.push_back((unsigned char)tokenType);
+	strs.push_back(str);
+	lens.push_back(len);
+	offsets.push_back(offset);
+}
+unsigned int TokenStream::size() const {
+	return tokenTypes.size();
+}
+Token TokenStream::operator[](unsigned int i) const {
+	return Token(tokenTypes[i], strs[i], lens[i], fileIndex, offsets[i]);
+}
+
+// SourceBuffer functions
+SourceBuffer::SourceBuffer() : data(NULL), size(0), mapped(false), capacity(0) {}
+SourceBuffer::~SourceBuffer() {
+	if (mapped) {
+		munmap((void *)data, size);
+	} else {
+		delete[] data;
+	}
+	for (vector<char *>::iterator iter = literals.begin(); iter != literals.end(); iter++) {
+		delete[] *iter;
+	}
+}
+bool SourceBuffer::load(const string &fileName) {
+	int fd = (fileName == STD_IN_FILE_NAME) ? STDIN_FILENO : open(fileName.c_str(), O_RDONLY);
+	if (fd < 0) { // if we couldn't open the file, return failure
+		return false;
+	}
+	// first, try to map the whole file into memory in one shot
+	struct stat fileStat;
+	if (fd != STDIN_FILENO && fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode)) { // if this is a regular file, we can map it
+		if (fileStat.st_size == 0) { // if the file is empty, there's nothing to map
+			close(fd);
+			return true;
+		}
+		void *mapping = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED) { // if the mapping succeeded, we're done
+			madvise(mapping, fileStat.st_size, MADV_SEQUENTIAL);
+			data = (const char *)mapping;
+			size = fileStat.st_size;
+			mapped = true;
+			close(fd);
+			return true;
+		}
+	}
+	// otherwise, if we can't map the input (e.g. it's a pipe), read all of it into a growing heap buffer
+	size_t capacity = 1<<16;
+	char *buf = new char[capacity];
+	for(;;) {
+		if (size == capacity) { // if the buffer is full, double its size
+			char *newBuf = new char[capacity*2];
+			memcpy(newBuf, buf, size);
+			delete[] buf;
+			buf = newBuf;
+			capacity *= 2;
+		}
+		ssize_t retVal = read(fd, buf + size, capacity - size);
+		if (retVal > 0) { // if we got some data, log it and keep reading
+			size += retVal;
+		} else if (retVal == 0) { // else if we hit EOF, we're done
+			break;
+		} else if (errno != EINTR) { // else if reading failed, return failure
+			delete[] buf;
+			size = 0;
+			if (fd != STDIN_FILENO) {
+				close(fd);
+			}
+			return false;
+		}
+	}
+	data = buf;
+	this->capacity = capacity;
+	if (fd != STDIN_FILENO) {
+		close(fd);
+	}
+	return true;
+}
+const char *SourceBuffer::addLiteral(const string &s) {
+	char *literal = new char[s.size()];
+	memcpy(literal, s.data(), s.size());
+	literals.push_back(literal);
+	return literal;
+}
+bool SourceBuffer::replace(unsigned int start, unsigned int oldEnd, const string &text) {
+	size_t newSize = size - (oldEnd - start) + text.length();
+	char *buf = (char *)data;
+	bool moved = (mapped || newSize > capacity);
+	if (moved) { // if the edit doesn't fit in place, move the contents to a heap buffer with room to grow, so that later edits usually won't have to
+		size_t newCapacity = (newSize*2 > (1<<16)) ? newSize*2 : (1<<16);
+		buf = new char[newCapacity];
+		memcpy(buf, data, start);
+		memcpy(buf + start + text.length(), data + oldEnd, size - oldEnd);
+		if (mapped) {
+			munmap((void *)data, size);
+		} else {
+			delete[] data;
+		}
+		mapped = false;
+		capacity = newCapacity;
+	} else { // else if it fits, just slide the bytes after the edit over
+		memmove(buf + start + text.length(), buf + oldEnd, size - oldEnd);
+	}
+	memcpy(buf + start, text.data(), text.length());
+	data = buf;
+	size = newSize;
+	lineStarts.clear(); // the lines will be reindexed on the next position query
+	return moved;
+}
+
 // main lexing functions
 
 int isWhiteSpace(unsigned char c) {
@@ -46,22 +190,21 @@ int isTab(unsigned char c) {
 	return (c == '\t');
 }
 
-void resetState(string &s, int &state, int &tokenType) {
+void resetState(unsigned int &len, int &state, int &tokenType) {
 	// reset the state variables
-	s.clear(); // clear the raw token buffer
+	len = 0; // clear the raw token length
 	state = 0;
 	tokenType = -1;
 	// return normally
 	return;
 }
 
-void commitToken(string &s, int &state, int &tokenType, unsigned int fileIndex, int rowStart, int colStart, vector<Token> *outputVector, char c) {
-	// first, build up the token
-	Token t(tokenType, s, fileIndex, rowStart, colStart);
-	// now, commit it to the output vector
-	outputVector->push_back(t);
+void commitToken(const char *str, unsigned int &len, int &state, int &tokenType, unsigned int fileIndex, unsigned int offset, Token &outputToken, bool &tokenReady) {
+	// hand the token off to the output slot
+	outputToken = Token(tokenType, str, len, fileIndex, offset);
+	tokenReady = true;
 	// finally, reset our state back to the default
-	resetState(s, state, tokenType);
+	resetState(len, state, tokenType);
 	// finally, return normally
 	return;
 }
@@ -74,19 +217,20 @@ string hex(unsigned char c) {
 	return retVal;
 }
 
+// gets the next character of input out of the source buffer, returning false on EOF
+inline bool getChar(const char *&cur, const char *end, char &c) {
+	if (cur != end) {
+		c = *cur++;
+		return true;
+	} else {
+		return false;
+	}
+}
+
 // discard input up until the end of the current token
-void discardToken(ifstream *in, char c, int &row, int &col, bool &done) {
+void discardToken(const char *&cur, const char *end, char c, bool &done) {
 	for(;;) {
-		bool retVal = (in == NULL ? cin.get(c) : in->get(c));
-		// handle newline cursor logging properly
-		if (isNewLine(c)) {
-			row++;
-			col = 0;
-		} else if (isTab(c)) {
-			col = (col - (col % tabModulus) + tabModulus);
-		} else {
-			col++;
-		}
+		bool retVal = getChar(cur, end, c);
 		if (!retVal) { // if we hit the end of the file, flag the fact that we're done and continue lexing
 			done = true;
 			return;
@@ -96,39 +240,203 @@ void discardToken(ifstream *in, char c, int &row, int &col, bool &done) {
 	}
 }
 
-vector<Token> *lex(ifstream *in, unsigned int fileIndex) {
+// bulk input scanners; each one processes SCAN_WIDTH bytes at a time where vector instructions are available, and finishes with a scalar loop
+
+// returns a pointer to the first occurrence of any of a, b, or c in [cur, end), or end if there is none
+inline const char *scanToAny(const char *cur, const char *end, char a, char b, char c) {
+#ifdef SCAN_WIDTH
+	ScanVector va = SCAN_SPLAT(a);
+	ScanVector vb = SCAN_SPLAT(b);
+	ScanVector vc = SCAN_SPLAT(c);
+	for (; end - cur >= SCAN_WIDTH; cur += SCAN_WIDTH) {
+		ScanVector block = SCAN_LOAD(cur);
+		unsigned int mask = SCAN_MASK(SCAN_OR(SCAN_OR(SCAN_EQ(block, va), SCAN_EQ(block, vb)), SCAN_EQ(block, vc)));
+		if (mask) {
+			return (cur + __builtin_ctz(mask));
+		}
+	}
+#endif
+	for (; cur != end; cur++) {
+		if (*cur == a || *cur == b || *cur == c) {
+			break;
+		}
+	}
+	return cur;
+}
+
+// returns a pointer to the first non-whitespace character in [cur, end), or end if there is none
+inline const char *scanPastWhiteSpace(const char *cur, const char *end) {
+#ifdef SCAN_WIDTH
+	ScanVector vSpace = SCAN_SPLAT(' ');
+	ScanVector vTab = SCAN_SPLAT('\t');
+	ScanVector vNewLine = SCAN_SPLAT('\n');
+	ScanVector vReturn = SCAN_SPLAT('\r');
+	for (; end - cur >= SCAN_WIDTH; cur += SCAN_WIDTH) {
+		ScanVector block = SCAN_LOAD(cur);
+		unsigned int mask = SCAN_MASK(SCAN_OR(SCAN_OR(SCAN_EQ(block, vSpace), SCAN_EQ(block, vTab)), SCAN_OR(SCAN_EQ(block, vNewLine), SCAN_EQ(block, vReturn))));
+		if (mask != SCAN_FULL_MASK) {
+			return (cur + __builtin_ctz(~mask));
+		}
+	}
+#endif
+	for (; cur != end; cur++) {
+		if (!isWhiteSpace(*cur)) {
+			break;
+		}
+	}
+	return cur;
+}
 
-	// initialize local error code
-	lexerErrorCode = 0;
+// returns a pointer to the '*' of the first * / pair in [cur, end), or end if there is none
+inline const char *scanToStarCommentEnd(const char *cur, const char *end) {
+#ifdef SCAN_WIDTH
+	ScanVector vStar = SCAN_SPLAT('*');
+	ScanVector vSlash = SCAN_SPLAT('/');
+	for (; end - cur > SCAN_WIDTH; cur += SCAN_WIDTH) { // strictly greater, since we also look one byte ahead
+		unsigned int mask = SCAN_MASK(SCAN_AND(SCAN_EQ(SCAN_LOAD(cur), vStar), SCAN_EQ(SCAN_LOAD(cur+1), vSlash)));
+		if (mask) {
+			return (cur + __builtin_ctz(mask));
+		}
+	}
+#endif
+	for (; end - cur >= 2; cur++) {
+		if (cur[0] == '*' && cur[1] == '/') {
+			return cur;
+		}
+	}
+	return end;
+}
 
-	// declare and initialize lexer structure
+// appends the offset (relative to base) of the character after each newline in [cur, end) to lineStarts
+inline void findLineStarts(const char *base, const char *cur, const char *end, vector<unsigned int> &lineStarts) {
+#ifdef SCAN_WIDTH
+	ScanVector vNewLine = SCAN_SPLAT('\n');
+	for (; end - cur >= SCAN_WIDTH; cur += SCAN_WIDTH) {
+		unsigned int mask = SCAN_MASK(SCAN_EQ(SCAN_LOAD(cur), vNewLine));
+		while (mask) { // log the position of each newline in this block
+			lineStarts.push_back((cur - base) + __builtin_ctz(mask) + 1);
+			mask &= mask - 1;
+		}
+	}
+#endif
+	for (; cur != end; cur++) {
+		if (isNewLine(*cur)) {
+			lineStarts.push_back((cur - base) + 1);
+		}
+	}
+}
+
+// returns the column reached by advancing from col over the (newline-free) characters in [cur, end)
+inline int advanceCol(int col, const char *cur, const char *end) {
+	for(;;) {
+		const char *tab = scanToAny(cur, end, '\t', '\t', '\t');
+		col += (tab - cur);
+		if (tab == end) {
+			break;
+		}
+		col = (col - (col % tabModulus) + tabModulus);
+		cur = tab + 1;
+	}
+	return col;
+}
+
+// SourceBuffer position functions
+void SourceBuffer::indexLines() {
+	if (lineStarts.empty()) { // if we haven't indexed the lines of this file yet, do so now
+		lineStarts.push_back(0);
+		findLineStarts(data, data, data + size, lineStarts);
+	}
+}
+int SourceBuffer::row(unsigned int offset) {
+	indexLines();
+	return (upper_bound(lineStarts.begin(), lineStarts.end(), offset) - lineStarts.begin());
+}
+int SourceBuffer::col(unsigned int offset) {
+	unsigned int lineStart = lineStarts[row(offset) - 1];
+	const char *posEnd = (offset < size) ? (data + offset + 1) : (data + size); // columns are 1-based, so include the character itself
+	return advanceCol(0, data + lineStart, posEnd);
+}
+
+// lexer DFA backends; both provide lexerTransition(), the transition out of a state on a character, and lexerStep(), which greedily extends the current token
+
+// returns whether the given transition token type simply extends the current token (as opposed to being invalid, a failure, or switching lexing modes)
+inline bool isRegularTransition(int tokenType) {
+	return (tokenType != -1 && tokenType != TOKEN_FAIL && tokenType != TOKEN_REGCOMMENT && tokenType != TOKEN_STARCOMMENT && tokenType != TOKEN_CQUOTE && tokenType != TOKEN_SQUOTE);
+}
+
+#ifdef LEXER_DIRECT_CODED
+// direct-coded backend; the DFA is compiled into switch/goto code by lexerStructGen
+#include "../tmp/lexerCodeRaw.h"
+#else
+// table-driven backend; the DFA is a character-class-compressed transition table generated by lexerStructGen
 #include "../tmp/lexerNodeRaw.h"
-	// declare output vector
-	vector<Token> *outputVector = new vector<Token>();
-	// input character buffers
+
+inline LexerNode lexerTransition(int state, unsigned char c) {
+	return lexerNode[state][lexerClassOf[c]];
+}
+
+inline void lexerStep(const char *&cur, const char *limit, int &state, int &tokenType) {
+	for (; cur != limit && !isWhiteSpace(*cur); cur++) {
+		LexerNode transition = lexerNode[state][lexerClassOf[(unsigned char)*cur]];
+		if (!isRegularTransition(transition.tokenType)) {
+			break;
+		}
+		tokenType = transition.tokenType;
+		state = transition.toState;
+	}
+}
+#endif
+
+// Lexer functions
+
+Lexer::Lexer(SourceBuffer *in, unsigned int fileIndex, ostream &errorStream) : in(in), fileIndex(fileIndex), errorStream(errorStream), lexerErrorCode(0),
+	cur(in->data), end(in->data + in->size), carryOver('\0'), tokenStart(NULL), len(0), state(0), tokenType(-1), tokenOffset(0), done(false), finished(false) {}
+Lexer::Lexer(SourceBuffer *in, unsigned int fileIndex, unsigned int startOffset, unsigned int endOffset, ostream &errorStream) : in(in), fileIndex(fileIndex), errorStream(errorStream), lexerErrorCode(0),
+	cur(in->data + startOffset), end(in->data + endOffset), carryOver('\0'), tokenStart(NULL), len(0), state(0), tokenType(-1), tokenOffset(0), done(false), finished(false) {}
+Lexer::~Lexer() {}
+
+Token *Lexer::next() {
+
+	// if we've already run off the end of the input or given up on it, there's nothing more to return
+	if (finished || (eventuallyGiveUp && lexerErrorCode >= TOLERABLE_ERROR_LIMIT)) {
+		return NULL;
+	}
+
+	// work on local copies of the lexing state, so that it can stay in registers for the duration of the call
+	const char *cur = this->cur;
+	const char *end = this->end;
+	char carryOver = this->carryOver;
+	const char *tokenStart = this->tokenStart;
+	unsigned int len = this->len;
+	int state = this->state;
+	int tokenType = this->tokenType;
+	unsigned int tokenOffset = this->tokenOffset;
+	bool done = this->done;
+	// input character buffer
 	char c;
-	char carryOver = '\0';
-	// output character buffer
-	string s;
-	// state variables
-	int state = 0;
-	int tokenType = -1;
-	// the position in the file we're currently in
-	int row = 1;
-	int col = 0;
-	int rowStart = -1;
-	int colStart = -1;
-	// loop flags
-	bool done = false;
+	// whether the last round committed a token
+	bool tokenReady = false;
 	for(;;) { // per-character loop
 
 lexerLoopTop: ;
+		// if the last round committed a token, save our state and hand the token to the caller; we'll pick up where we left off on the next call
+		if (tokenReady) {
+			this->cur = cur;
+			this->carryOver = carryOver;
+			this->tokenStart = tokenStart;
+			this->len = len;
+			this->state = state;
+			this->tokenType = tokenType;
+			this->tokenOffset = tokenOffset;
+			this->done = done;
+			return &outputToken;
+		}
 		// get a new character
 		if (carryOver != '\0') { // if there is a character to carry over, use it
 			c = carryOver;
 			carryOver = '\0';
 		} else { // otherwise, grab a character from the input
-			if ( !(in == NULL ? cin.get(c) : in->get(c)) ) { // if getting a character fails, flag the fact that we're done now
+			if (!getChar(cur, end, c)) { // if getting a character fails, flag the fact that we're done now
 				if (done) { // if this is the second time we're trying to read EOF, break out of the loop
 					break;
 				}
@@ -136,43 +444,35 @@ lexerLoopTop: ;
 				// pretend that there's a newline at the end of the file so the last token can be processed nominally
 				c = '\n';
 			}
-			// either way, we just got a character, so advance the column count
-			if (isTab(c)) {
-				col = (col - (col % tabModulus) + tabModulus);
-			} else {
-				col++;
-			}
 		}
 		// now, process the character we just got
 		// first, check it it was a special character
 		if (isWhiteSpace(c)) { // whitespace?
 			if (tokenType == TOKEN_ERROR) { // if we got whitespace space while in error mode,
-				lexerError(fileIndex,rowStart,colStart,"whitespace-truncated token");
+				lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"whitespace-truncated token");
 				// throw away this token and continue parsing
-				resetState(s, state, tokenType);
+				resetState(len, state, tokenType);
 				carryOver = c;
 			} else if (tokenType != -1) { // else if we were in a commitable state, commit this token to the output vector
-				commitToken(s, state, tokenType, fileIndex, rowStart, colStart, outputVector, c);
+				commitToken(tokenStart, len, state, tokenType, fileIndex, tokenOffset, outputToken, tokenReady);
 			}
-			if (isNewLine(c)) { // newline?
-				// bump up the row count and carriage return the column
-				row++;
-				col = 0;
+			if (carryOver == '\0') { // if we're not going to reprocess this character, skip the rest of the whitespace run in bulk
+				cur = scanPastWhiteSpace(cur, end);
 			}
 		} else { // else if it was a non-whitepace character, check if there is a valid transition for this state
-			LexerNode transition = state == -1 ? lexerNode[255][(unsigned char)c] : lexerNode[state][(unsigned char)c];
+			LexerNode transition = lexerTransition(state, (unsigned char)c);
 			if (transition.tokenType != -1) { // if the transition is valid
-				// first, set rowStart amd colStart if we're coming from the core state
+				// first, log the start of the token if we're coming from the core state
 				if (state == 0) {
-					rowStart = row;
-					colStart = col;
+					tokenStart = cur-1; // whether it was just read or carried over, c is always the previous character in the input
+					tokenOffset = tokenStart - in->data;
 				}
 				// second, check if we're jumping into a failure state
 				if(transition.tokenType == TOKEN_FAIL) { // if it's a failure state, print an error, reset, and continue
 					// print the error message
-					lexerError(fileIndex,row,col,"token mangled by stray character 0x"<<hex(c));
+					lexerError(fileIndex,in->row((cur-1) - in->data),in->col((cur-1) - in->data),"token mangled by stray character 0x"<<hex(c));
 					// also, reset state
-					resetState(s, state, tokenType);
+					resetState(len, state, tokenType);
 					// however, carry over the faulting character, as it might be useful for later debugging
 					carryOver = c;
 					// finally, continue from the top of the loop
@@ -181,66 +481,56 @@ lexerLoopTop: ;
 				// now, branch based on the type of transition it was
 				if (transition.tokenType == TOKEN_REGCOMMENT) { // if it's a transition into regular comment mode
 					// first, reset our state
-					resetState(s, state, tokenType);
+					resetState(len, state, tokenType);
 					// finally, scan and discard characters up to and including the next newline
-					for(;;) { // scan until we hit either EOF or a newline
-						bool retVal = (in == NULL ? cin.get(c) : in->get(c));
-						if (!retVal) { // if we hit EOF, flag the fact that we're done and jump to the top of the loop
-							done = true;
-							goto lexerLoopTop;
-						} else if (isNewLine(c)) { // if we hit a newline, break out of this loop and continue normally
-							row++;
-							col = 0;
-							break;
-						} else if (isTab(c)) {
-							col = (col - (col % tabModulus) + tabModulus);
-						} else {
-							col++;
-						}
+					cur = scanToAny(cur, end, '\n', '\n', '\n');
+					if (cur == end) { // if we hit EOF, flag the fact that we're done and jump to the top of the loop
+						done = true;
+						goto lexerLoopTop;
 					}
+					// otherwise, we hit a newline, so consume it and continue normally
+					cur++;
 				} else if (transition.tokenType == TOKEN_STARCOMMENT) { // else if it's a transition into star comment mode
 					// first, reset our state
-					resetState(s, state, tokenType);
+					resetState(len, state, tokenType);
 					// next, scan and discard characters up to and including the next * /
-					char lastChar = '\0';
-					for(;;) { // scan until we hit either EOF or a * /
-						bool retVal = (in == NULL ? cin.get(c) : in->get(c));
-						if (isTab(c)) {
-							col = (col - (col % tabModulus) + tabModulus);
-						} else {
-							col++;
-						}
-						if (!retVal) { // if we hit EOF, flag a critical comment truncation error and signal that we're done
-							lexerError(fileIndex,rowStart,colStart,"/* comment truncated by EOF");
-							done = true;
-							goto lexerLoopTop;
-						} else if (isNewLine(c)) { // if we hit a newline, update the row and col as necessary
-							row++;
-							col = 0;
-						} else if (lastChar == '*' && c == '/') { // else if we've found the end of the comment, simply break out of the loop
-							break;
-						}
-						lastChar = c;
+					const char *commentEnd = scanToStarCommentEnd(cur, end);
+					if (commentEnd == end) { // if we hit EOF, flag a critical comment truncation error and signal that we're done
+						cur = end;
+						lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"/* comment truncated by EOF");
+						done = true;
+						goto lexerLoopTop;
 					}
+					// otherwise, we've found the end of the comment, so skip past it
+					cur = commentEnd+2;
 				} else if (transition.tokenType == TOKEN_CQUOTE || transition.tokenType == TOKEN_SQUOTE) { // else if it's a transition into a quoting mode
 					// log the type of transition we're making
 					tokenType = transition.tokenType;
 					// pre-decide the terminal that should signal the end of the quote
 					char termChar = (tokenType == TOKEN_CQUOTE) ? '\'' : '\"';
+					// the literal's text starts after the opening quote, and stays a span of the input unless we see an escape
+					tokenStart = cur;
+					bool escaped = false;
 					// whether the last character seen was the escape character
 					bool lastCharWasEsc = false;
 					for(;;) { // scan until we hit either EOF or the termChar
-						bool retVal = (in == NULL ? cin.get(c) : in->get(c));
-						if (isTab(c)) {
-							col = (col - (col % tabModulus) + tabModulus);
-						} else {
-							col++;
+						if (!lastCharWasEsc) { // if we're not in the middle of an escape sequence, skip over the run of plain characters in bulk
+							const char *runEnd = scanToAny(cur, end, termChar, ESCAPE_CHARACTER, '\n');
+							if ((unsigned int)(runEnd - cur) > (MAX_TOKEN_LENGTH-1) - len) { // leave any overflow to the character-wise path below
+								runEnd = cur + ((MAX_TOKEN_LENGTH-1) - len);
+							}
+							if (escaped) {
+								s.append(cur, runEnd - cur);
+							}
+							len += (runEnd - cur);
+							cur = runEnd;
 						}
+						bool retVal = getChar(cur, end, c);
 						if (!retVal) { // if we hit EOF, flag a critical comment truncation error and signal that we're done
 							if (termChar == '\'') {
-								lexerError(fileIndex,rowStart,colStart,"character literal truncated by EOF");
+								lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"character literal truncated by EOF");
 							} else {
-								lexerError(fileIndex,rowStart,colStart,"string literal truncated by EOF");
+								lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"string literal truncated by EOF");
 							}
 							done = true;
 							goto lexerLoopTop;
@@ -248,6 +538,10 @@ lexerLoopTop: ;
 						// escape character handling
 						if (c == ESCAPE_CHARACTER && !lastCharWasEsc) { // if it's the escape character and not a double, log this and wait for the next character
 							lastCharWasEsc = true;
+							if (!escaped) { // if this is the first escape, switch to accumulating the literal's text in the owned buffer
+								s.assign(tokenStart, len);
+								escaped = true;
+							}
 							// continue so the character isn't logged, and the condition is unflagged
 							continue;
 						} else if (lastCharWasEsc) { // else if the last character was an escape character, specially handle this one
@@ -275,14 +569,12 @@ lexerLoopTop: ;
 							} else if (c == ESCAPE_CHARACTER) { // escape-escape
 								// nothing, the below code will properly process it
 							} else if (c == '\n') { // newline escape
-								row++;
-								col = 0;
 								// unflag the condition
 								lastCharWasEsc = false;
 								// continue so the character isn't logged
 								continue;
 							} else { // else if it's an unrecognized escape sequence, throw an error and discard the character
-								lexerError(fileIndex,row,col-1,"unrecognized escape sequence "<<ESCAPE_CHARACTER<<"0x"<<hex(c));
+								lexerError(fileIndex,in->row((cur-1) - in->data),in->col((cur-1) - in->data)-1,"unrecognized escape sequence "<<ESCAPE_CHARACTER<<"0x"<<hex(c));
 								// unflag the condition
 								lastCharWasEsc = false;
 								// continue so the character isn't logged
@@ -293,19 +585,17 @@ lexerLoopTop: ;
 						if (!lastCharWasEsc) { // if we don't need special forced commiting of this character due to escaping
 							if (isNewLine(c)) { // if we hit a newline, throw a quote truncation error
 								if (termChar == '\'') {
-									lexerError(fileIndex,rowStart,colStart,"character literal truncated by end of line");
+									lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"character literal truncated by end of line");
 								} else {
-									lexerError(fileIndex,rowStart,colStart,"string literal truncated by end of line");
+									lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"string literal truncated by end of line");
 								}
-								row++;
-								col = 0;
 								goto lexerLoopTop;
 							} else if (c == termChar) { // else if we've found the end of the quote
-								if (termChar == '\'' && s.size() > 1) { // if this is an overflowing CQUOTE, throw a CQUOTE overflow error
-									lexerError(fileIndex,rowStart,colStart,"character literal overflow");
+								if (termChar == '\'' && len > 1) { // if this is an overflowing CQUOTE, throw a CQUOTE overflow error
+									lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"character literal overflow");
 								}
 								// either way, commit the token and continue with processing
-								commitToken(s, state, tokenType, fileIndex, rowStart, colStart, outputVector, c);
+								commitToken((escaped ? in->addLiteral(s) : tokenStart), len, state, tokenType, fileIndex, tokenOffset, outputToken, tokenReady);
 								break;
 							}
 						} else { // else if we *do* need to force the character to commit due to escaping
@@ -314,45 +604,53 @@ lexerLoopTop: ;
 						}
 
 						// character logging
-						if (s.size() < (MAX_TOKEN_LENGTH-1)) { // else if there is room in the buffer for this character, log it
-							s += c;
+						if (len < (MAX_TOKEN_LENGTH-1)) { // else if there is room in the buffer for this character, log it
+							if (escaped) {
+								s += c;
+							}
+							len++;
 						} else { // else if there is no more room in the buffer for this character, discard the token with an error
-							lexerError(fileIndex,rowStart,colStart,"quoted literal overflow");
+							lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"quoted literal overflow");
 							// also, reset state and scan to the end of this token
-							resetState(s, state, tokenType);
-							discardToken(in, c, row, col, done);
+							resetState(len, state, tokenType);
+							discardToken(cur, end, c, done);
 							// finally, break out of the quote loop
 							break;
 						} // if there is room in the buffer
 					} // for (;;)
 				} else { // else if it's any other regular valid transition
-					if (s.size() < (MAX_TOKEN_LENGTH-1)) { // if there is room in the buffer for this character, log it
-						s += c;
+					if (len < (MAX_TOKEN_LENGTH-1)) { // if there is room in the buffer for this character, log it
+						len++;
 						tokenType = transition.tokenType;
 						state = transition.toState;
+						// then, extend the token over as many of the following characters as we can in one go
+						const char *stepStart = cur;
+						const char *stepLimit = ((unsigned int)(end - cur) > (MAX_TOKEN_LENGTH-1) - len) ? (cur + ((MAX_TOKEN_LENGTH-1) - len)) : end;
+						lexerStep(cur, stepLimit, state, tokenType);
+						len += (cur - stepStart);
 					} else { // else if there is no more room in the buffer for this character, discard the token with an error
-						lexerError(fileIndex,rowStart,colStart,"token overflow");
+						lexerError(fileIndex,in->row(tokenOffset),in->col(tokenOffset),"token overflow");
 						// also, reset state and scan to the end of this token
-						resetState(s, state, tokenType);
-						discardToken(in, c, row, col, done);
+						resetState(len, state, tokenType);
+						discardToken(cur, end, c, done);
 					}
 				}
 			} else { // else if the transition isn't valid
 				if (tokenType == -1) { // if there were no valid characters before this junk
-					lexerError(fileIndex,row,col,"stray character 0x"<<hex(c));
+					lexerError(fileIndex,in->row((cur-1) - in->data),in->col((cur-1) - in->data),"stray character 0x"<<hex(c));
 					// now, reset the state and try to recover by eating up characters until we hit whitespace or EOF
 					// reset state
-					resetState(s, state, tokenType);
-					discardToken(in, c, row, col, done);
+					resetState(len, state, tokenType);
+					discardToken(cur, end, c, done);
 				} else if (tokenType == TOKEN_ERROR) { // else if it's an invalid transition from an error state, flag it
 					// print the error message
-					lexerError(fileIndex,row,col,"token truncated by stray character 0x"<<hex(c));
+					lexerError(fileIndex,in->row((cur-1) - in->data),in->col((cur-1) - in->data),"token truncated by stray character 0x"<<hex(c));
 					// also, reset state
-					resetState(s, state, tokenType);
+					resetState(len, state, tokenType);
 					// however, carry over the faulting character, as it might be useful for later debugging
 					carryOver = c;
 				} else { // else if there is a valid commit pending, do it and carry over this character for the next round
-					commitToken(s, state, tokenType, fileIndex, rowStart, colStart, outputVector, c);
+					commitToken(tokenStart, len, state, tokenType, fileIndex, tokenOffset, outputToken, tokenReady);
 					// also, carry over the current character to the next round
 					carryOver = c;
 				}
@@ -362,24 +660,26 @@ lexerLoopTop: ;
 
 	// per-character loop is done now
 
+	// finally, terminate the token sequence with the end token
+	finished = true;
+	outputToken = Token(TOKEN_END, "EOF", 3, fileIndex, NO_SOURCE_OFFSET);
+	return &outputToken;
+}
+
+TokenStream *lex(SourceBuffer *in, unsigned int fileIndex, ostream &errorStream) {
+	// declare output vector
+	TokenStream *outputVector = new TokenStream(fileIndex);
+	// pull all of the tokens out of the file
+	Lexer lexer(in, fileIndex, errorStream);
+	for (Token *t = lexer.next(); t != NULL; t = lexer.next()) {
+		outputVector->add(t->tokenType, t->str, t->len, t->offset);
+	}
 	// finally, test the error code to see if we should propagate it up the chain or return normally
-	if (lexerErrorCode) {
+	if (lexer.lexerErrorCode) {
 		// deallocate the output vector, since we're just going to return null
 		delete outputVector;
 		return NULL;
 	} else {
-		// augment the vector with the end token
-		string eofString("EOF");
-		Token termToken(TOKEN_END, eofString, fileIndex, 0, 0);
-		outputVector->push_back(termToken);
-		// print out the lexeme if we're in verbose mode
-		VERBOSE(
-			for (unsigned int tokenIndex = 0; tokenIndex < outputVector->size(); tokenIndex++) {
-				cout << (*outputVector)[tokenIndex] << " " ;
-			} // per-token loop
-			cout << "\n";
-		)
-		// finally, return the vector to the caller
 		return outputVector;
 	}
 }
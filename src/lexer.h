@@ -11,21 +11,94 @@ class Token {
 	public:
 		// data members
 		int tokenType;
-		string s;
 		unsigned int fileIndex;
-		int row;
-		int col;
+		const char *str; // the text of this token; points into its file's SourceBuffer, which outlives the token
+		unsigned int len; // the length of the text of this token
+		unsigned int offset; // the byte offset of the start of this token in its file, or NO_SOURCE_OFFSET if it has no position
 		// allocators/deallocators
 		Token(int tokenType = TOKEN_STD);
-		Token(int tokenType, const string &s, unsigned int fileIndex, int row, int col);
+		Token(int tokenType, const char *str, unsigned int len, unsigned int fileIndex, unsigned int offset);
 		Token(const Token &otherToken);
 		~Token();
+		// core methods
+		string s() const; // returns an owned copy of the text of this token
+		int row() const; // the line of this token, computed on demand from its offset
+		int col() const; // the column of this token, computed on demand from its offset using the current tab width
 		// operators
-		Token &operator=(Token &otherToken);
+		Token &operator=(const Token &otherToken);
 		operator string() const;
 };
 
-vector<Token> *lex(ifstream *in, unsigned int fileIndex);
+// the lexer's output; tokens are stored column-wise, so that the parser's inner loop walks a dense array of token types
+class TokenStream {
+	public:
+		// data members
+		unsigned int fileIndex; // the file that all of the tokens in this stream came from
+		vector<unsigned char> tokenTypes; // the type of each token; lexer token types always fit in a byte (see bld/lexerStructGen.cpp)
+		vector<const char *> strs; // the text of each token, as in Token::str
+		vector<unsigned int> lens; // the length of the text of each token
+		vector<unsigned int> offsets; // the byte offset of each token, as in Token::offset
+		// allocators/deallocators
+		TokenStream(unsigned int fileIndex);
+		~TokenStream();
+		// core methods
+		void add(int tokenType, const char *str, unsigned int len, unsigned int offset);
+		unsigned int size() const;
+		Token operator[](unsigned int i) const; // materializes the token at the given index
+};
+
+class SourceBuffer {
+	public:
+		// data members
+		const char *data; // the raw contents of the source file
+		size_t size; // the length of the contents, in bytes
+		bool mapped; // whether data is a memory mapping of the file (as opposed to a heap buffer)
+		size_t capacity; // the size of the heap buffer behind data, if it isn't mapped
+		vector<char *> literals; // out-of-line storage for token text that doesn't appear verbatim in the source (i.e. escaped quoted literals)
+		vector<unsigned int> lineStarts; // the byte offsets of the start of each line; built on the first position query
+		// allocators/deallocators
+		SourceBuffer();
+		~SourceBuffer();
+		// core methods
+		bool load(const string &fileName); // maps in the given file, or reads all of standard input for STD_IN_FILE_NAME
+		const char *addLiteral(const string &s); // stores a copy of s alongside the source and returns a pointer to it
+		bool replace(unsigned int start, unsigned int oldEnd, const string &text); // replaces the bytes in [start, oldEnd) with text, returning whether data had to move
+		void indexLines(); // builds lineStarts if it isn't already built; position queries do this lazily, so call it first if several threads will be querying
+		int row(unsigned int offset); // returns the line number of the given byte offset
+		int col(unsigned int offset); // returns the column number of the given byte offset
+};
+
+// pull-based lexer; produces the tokens of a file one at a time as the parser asks for them, so that the file's tokens never need to exist all at once
+class Lexer {
+	public:
+		// data members
+		SourceBuffer *in; // the file being lexed
+		unsigned int fileIndex;
+		ostream &errorStream; // where lexical errors are reported
+		int lexerErrorCode; // the number of lexical errors reported so far
+		// allocators/deallocators
+		Lexer(SourceBuffer *in, unsigned int fileIndex, ostream &errorStream = cerr);
+		Lexer(SourceBuffer *in, unsigned int fileIndex, unsigned int startOffset, unsigned int endOffset, ostream &errorStream = cerr); // lexes only the bytes in [startOffset, endOffset) of the file, as if they were all of it
+		~Lexer();
+		// core methods
+		Token *next(); // lexes and returns the next token (ending with a TOKEN_END one), or NULL once the input is exhausted or lexing was abandoned; the token is only valid until the next call
+	private:
+		// lexing state, carried across calls to next(); next() works on local copies and saves them back when it returns a token
+		const char *cur; // input range
+		const char *end;
+		char carryOver; // a character to be reprocessed at the start of the next round
+		const char *tokenStart; // regular tokens are spans of the input, so we only track where the current one starts and how long it is
+		unsigned int len;
+		string s; // owned buffer for quoted literals whose text differs from the source (i.e. ones containing escapes)
+		int state;
+		int tokenType;
+		unsigned int tokenOffset; // the offset of the start of the current token, for positioning it and its diagnostics
+		bool done; // whether we've hit the end of the input
+		bool finished; // whether the end token has been returned
+		Token outputToken; // the most recently committed token
+};
+
+TokenStream *lex(SourceBuffer *in, unsigned int fileIndex, ostream &errorStream = cerr); // lexes an entire file at once; returns NULL on error
 
 // post-includes
 
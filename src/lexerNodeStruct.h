@@ -2,8 +2,8 @@
 #define LEXER_STRUCT_NODE_H
 
 struct lexerNodeStruct {
-	int tokenType;
-	int toState;
+	signed char tokenType; // -1 indicates an invalid transition
+	unsigned char toState;
 };
 typedef struct lexerNodeStruct LexerNode;
 
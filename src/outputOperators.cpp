@@ -2,7 +2,7 @@
 
 // operator definitions
 
-ostream &operator<< (ostream &os, Token &t) {
+ostream &operator<< (ostream &os, const Token &t) {
 	os << ((string)(t));
 	return os;
 }
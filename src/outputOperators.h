@@ -9,7 +9,7 @@
 #include "semmer.h"
 
 // string vector streaming operator overloads
-ostream &operator<< (ostream &os, Token &t);
+ostream &operator<< (ostream &os, const Token &t);
 ostream &operator<< (ostream &os, Tree *&tree);
 ostream &operator<< (ostream &os, SymbolTree *st);
 ostream &operator<< (ostream &os, Type *type);
@@ -2,44 +2,157 @@
 
 #include "outputOperators.h"
 
-// parser-global variables
+// parser tables
 
-int parserErrorCode;
+#include "../tmp/ruleRhsLengthRaw.h"
+#include "../tmp/ruleLhsTokenTypeRaw.h"
+#include "../tmp/ruleLhsTokenStringRaw.h"
+#include "../tmp/ruleStringRaw.h"
+
+// parser automaton backends; both provide parserTransition(), the parse table entry for a state and a label
+
+#ifdef PARSER_DIRECT_CODED
+// direct-coded backend; each state's row is compiled into a switch by parserStructGen
+#include "../tmp/parserCodeRaw.h"
+#else
+// table-driven backend; the rows are overlaid into a comb vector generated by parserStructGen
+#include "../tmp/parserNodeRaw.h"
+
+// returns the parse table entry for the given state and label; labels without an explicit entry in the state's row of the comb vector take the state's default action
+inline ParserNode parserTransition(unsigned int state, unsigned int label) {
+	unsigned int slot = parserBase[state] + label;
+	unsigned short entry = (parserCheck[slot] == state) ? parserNext[slot] : parserDefault[state];
+	ParserNode retVal = { PARSER_ENTRY_ACTION(entry), PARSER_ENTRY_N(entry) };
+	return retVal;
+}
+#endif
+
+// TreeArena functions
+
+TreeArena::TreeArena(unsigned int fileIndex) : fileIndex(fileIndex), cur(NULL), end(NULL) {}
+TreeArena::~TreeArena() {
+	for (unsigned int i=0; i < blocks.size(); i++) {
+		free(blocks[i]);
+	}
+}
+void *TreeArena::alloc(size_t size) {
+	size = (size + (TREE_ARENA_ALIGNMENT-1)) & ~((size_t)(TREE_ARENA_ALIGNMENT-1));
+	if ((size_t)(end - cur) < size) { // if the current block is exhausted, start a new one
+		size_t blockSize = (size + TREE_ARENA_ALIGNMENT > TREE_ARENA_BLOCK_SIZE) ? size + TREE_ARENA_ALIGNMENT : TREE_ARENA_BLOCK_SIZE;
+		void *block;
+		if (posix_memalign(&block, TREE_ARENA_BLOCK_SIZE, blockSize) != 0) {
+			throw std::bad_alloc();
+		}
+		// stamp the block with its owning arena, so that nodes can find their side tables (see Tree::arena())
+		*((TreeArena **)block) = this;
+		cur = (char *)block + TREE_ARENA_ALIGNMENT;
+		end = (char *)block + blockSize;
+		blocks.push_back((char *)block);
+	}
+	void *retVal = cur;
+	cur += size;
+	return retVal;
+}
+TreeSemantics &TreeArena::sem(unsigned int id) {
+	if (id >= semantics.size()) { // if the table hasn't caught up with the nodes yet, extend it
+		semantics.resize(texts.size());
+	}
+	return semantics[id];
+}
+void TreeArena::clear() {
+	for (unsigned int i=0; i < blocks.size(); i++) {
+		free(blocks[i]);
+	}
+	blocks.clear();
+	cur = end = NULL;
+	texts.clear();
+	semantics.clear();
+	asts.clear();
+}
+unsigned int TreeArena::numNodes() const {
+	return texts.size();
+}
+size_t TreeArena::bytes() const {
+	// a map entry costs its value plus a color word and three links
+	return (blocks.size()*TREE_ARENA_BLOCK_SIZE + texts.size()*sizeof(TreeText) + semantics.size()*sizeof(TreeSemantics) +
+		asts.size()*(sizeof(pair<const unsigned int, AstTerm *>) + 4*sizeof(void *)));
+}
+
+void *operator new(size_t size, TreeArena &arena) {
+	return arena.alloc(size);
+}
+void operator delete(void *p, TreeArena &arena) {}
+
+// TreeSemantics functions
+
+TreeSemantics::TreeSemantics() : env(NULL) {}
 
 // Tree functions
 
-// constructors
-Tree::Tree(const Token &t) : t(t), next(NULL), back(NULL), child(NULL), parent(NULL), status(TypeStatus()) {}
-Tree::Tree(const Token &t, Tree *next, Tree *back, Tree *child, Tree *parent) : t(t), next(next), back(back), child(child), parent(parent), status(TypeStatus()) {}
-Tree::Tree(const TypeStatus &status) : next(NULL), back(NULL), child(NULL), parent(NULL), status(status) {}
-Tree::Tree(deque<unsigned int> *depthList) : t(TOKEN_RAW_VECTOR), next((Tree *)depthList) {}
+// constructors; each logs the new node's cold data in the arena's side tables
+Tree::Tree(TreeArena &arena, const Token &t) : tokenType(t.tokenType), id(arena.numNodes()), next(NULL), back(NULL), child(NULL), parent(NULL) {
+	TreeText text = { t.str, t.len, t.offset };
+	arena.texts.push_back(text);
+}
+Tree::Tree(TreeArena &arena, const Token &t, Tree *next, Tree *back, Tree *child, Tree *parent) : tokenType(t.tokenType), id(arena.numNodes()), next(next), back(back), child(child), parent(parent) {
+	TreeText text = { t.str, t.len, t.offset };
+	arena.texts.push_back(text);
+}
+Tree::Tree(TreeArena &arena, const TypeStatus &status) : tokenType(TOKEN_STD), id(arena.numNodes()), next(NULL), back(NULL), child(NULL), parent(NULL) {
+	TreeText text = { "", 0, NO_SOURCE_OFFSET };
+	arena.texts.push_back(text);
+	arena.sem(id).status = status;
+}
+Tree::Tree(TreeArena &arena, deque<unsigned int> *depthList) : tokenType(TOKEN_RAW_VECTOR), id(arena.numNodes()), next((Tree *)depthList), back(NULL), child(NULL), parent(NULL) {
+	TreeText text = { "", 0, NO_SOURCE_OFFSET };
+	arena.texts.push_back(text);
+}
+
+// destructor; nodes don't own their neighbours, since parse trees live in (and are released along with) a TreeArena
+Tree::~Tree() {}
 
-// destructor
-Tree::~Tree() {
-	delete next;
-	delete child;
+// side table accessors
+TreeArena *Tree::arena() const {
+	// every node lives in a block aligned to TREE_ARENA_BLOCK_SIZE, whose first word points back to the owning arena
+	return *((TreeArena **)((uintptr_t)this & ~((uintptr_t)(TREE_ARENA_BLOCK_SIZE-1))));
+}
+Token Tree::t() const {
+	const TreeArena *a = arena();
+	const TreeText &text = a->texts[id];
+	return Token(tokenType, text.str, text.len, a->fileIndex, text.offset);
+}
+SymbolTree *&Tree::env() const {
+	return (arena()->sem(id).env);
+}
+TypeStatus &Tree::status() const {
+	return (arena()->sem(id).status);
+}
+AstTerm *Tree::ast() const {
+	const TreeArena *a = arena();
+	map<unsigned int, AstTerm *>::const_iterator astFind = a->asts.find(id);
+	return ((astFind != a->asts.end()) ? astFind->second : NULL);
 }
 
 // core methods
 IRTree *Tree::code() const {
-	return (status.code);
+	return (status().code);
 }
 Type &Tree::typeRef() const {
-	return (*(status.type));
+	return (*(status().type));
 }
 DataTree *Tree::castCode(const Type &destType) const {
-	return (status.castCode(destType));
+	return (status().castCode(destType));
 }
 DataTree *Tree::castCommonCode(const Type &otherType) const {
-	return (status.castCommonCode(otherType));
+	return (status().castCommonCode(otherType));
 }
 
 // comparison oparators
 bool Tree::operator==(int tokenType) const {
-	return (t.tokenType == tokenType);
+	return (this->tokenType == tokenType);
 }
 bool Tree::operator!=(int tokenType) const {
-	return (t.tokenType != tokenType);
+	return (this->tokenType != tokenType);
 }
 
 // traversal operators
@@ -113,39 +226,17 @@ void Tree::operator&=(Tree *parent) {
 // converters
 Tree::operator string() const {
 	if (*this == TOKEN_NonArrayedIdentifier || *this == TOKEN_ArrayedIdentifier || *this == TOKEN_OpenIdentifier) { // if this is an identifier-style Tree node, decode it
-		string retVal(child->t.s); // ID or DPERIOD
+		string retVal(child->t().s()); // ID or DPERIOD
 		// invariant: cur is a non-NULL child of NonArrayedIdentifierSuffix, ArrayedIdentifierSuffix, or IdentifierSuffix
 		for(const Tree *cur = child->next->child; cur != NULL; cur = (cur->next->next != NULL) ? cur->next->next->child : NULL) {
 			// log the extension
 			const Tree *curn = cur->next; // ID, ArrayAccess, or TIMES
 			if (*curn == TOKEN_ID) {
 				retVal += '.';
-				retVal += curn->t.s;
+				retVal += curn->t().s();
 			} else if (*curn == TOKEN_ArrayAccess) {
-				// check to make sure that the expressions are compatible with STD_INT
-				if (curn->child->next->next->next == NULL) { // if there's only one subscript
-					TypeStatus expStatus = getStatusExp(curn->child->next);
-					if (!(*expStatus >> *stdIntType)) { // if the types are incompatible, flag an error
-						Token curToken = curn->child->next->t; // Exp
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"array subscript is invalid");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<expStatus<<")");
-					}
-					retVal += ".[]";
-				} else { // else if this is an extent subscript
-					TypeStatus leftExpStatus = getStatusExp(curn->child->next);
-					if (!(*leftExpStatus >> *stdIntType)) { // if the types are incompatible, flag an error
-						Token curToken = curn->child->next->t; // Exp
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"left extent subscript is invalid");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<leftExpStatus<<")");
-					}
-					TypeStatus rightExpStatus = getStatusExp(curn->child->next);
-					if (!(*rightExpStatus >> *stdIntType)) { // if the types are incompatible, flag an error
-						Token curToken = curn->child->next->next->next->t; // Exp
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"right extent subscript is invalid");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<rightExpStatus<<")");
-					}
-					retVal += ".[:]";
-				}
+				checkArrayAccess(curn);
+				retVal += (curn->child->next->next->next == NULL) ? ".[]" : ".[:]";
 			}
 		}
 		return retVal;
@@ -154,10 +245,401 @@ Tree::operator string() const {
 	}
 }
 
+// AstTerm functions
+
+// constructor; collapses the given Term's chain of unit productions
+AstTerm::AstTerm(Tree *term) : term(term), next(NULL) {
+	Tree *tc = term->child; // ClosedTerm, OpenTerm, or DynamicTerm
+	if (*tc == TOKEN_DynamicTerm) {
+		kind = TERM_DYNAMIC;
+		dispatch = operand = tc;
+		return;
+	}
+	dispatch = operand = tc->child; // SimpleTerm, ClosedCondTerm, SimpleCondTerm, or OpenCondTerm
+	if (*dispatch == TOKEN_SimpleCondTerm) {
+		kind = TERM_SIMPLE_COND;
+	} else if (*dispatch == TOKEN_ClosedCondTerm) {
+		kind = TERM_CLOSED_COND;
+	} else if (*dispatch == TOKEN_OpenCondTerm) {
+		kind = TERM_OPEN_COND;
+	} else if (*(dispatch->child) == TOKEN_SwitchTerm) {
+		kind = TERM_SWITCH;
+		operand = dispatch->child;
+	} else { // else if it's a StaticTerm
+		Tree *stc = dispatch->child->child; // TypedStaticTerm, SingleAccess, or MultiAccess
+		if (*stc != TOKEN_TypedStaticTerm) {
+			kind = TERM_ACCESS;
+			operand = stc;
+		} else if (*(stc->child) == TOKEN_BracketedExp) {
+			kind = TERM_EXP;
+			operand = stc->child;
+		} else { // else if it's a Node
+			operand = stc->child->child; // NonArrayedIdentifier, ArrayedIdentifier, Instantiation, Filter, Object, PrimOpNode, or PrimLiteral
+			if (*operand == TOKEN_NonArrayedIdentifier || *operand == TOKEN_ArrayedIdentifier) {
+				kind = TERM_IDENTIFIER;
+			} else if (*operand == TOKEN_Instantiation) {
+				kind = (*(operand->child->next->child) == TOKEN_RARROW) ? TERM_FLOW_INSTANTIATION : TERM_INSTANTIATION;
+			} else if (*operand == TOKEN_Filter) {
+				kind = TERM_FILTER;
+			} else if (*operand == TOKEN_Object) {
+				kind = TERM_OBJECT;
+			} else if (*operand == TOKEN_PrimOpNode) {
+				kind = TERM_PRIM_OP;
+			} else /* if (*operand == TOKEN_PrimLiteral) */ {
+				kind = TERM_PRIM_LITERAL;
+			}
+		}
+	}
+}
+
+// core methods
+bool AstTerm::isFlowThrough() const {
+	return (kind >= TERM_IDENTIFIER);
+}
+bool AstTerm::isStaticOperand() const {
+	return (kind >= TERM_ACCESS);
+}
+
+// returns the AstTerm for the given Term, lowering it if that hasn't been done yet
+AstTerm *lowerTerm(Tree *term, TreeArena &arena) {
+	AstTerm *&ast = arena.asts[term->id];
+	if (ast == NULL) {
+		ast = new (arena) AstTerm(term);
+	}
+	return ast;
+}
+
+void lowerTree(Tree *treeRoot, TreeArena &arena) {
+	vector<Tree *> nodeStack;
+	if (treeRoot != NULL) {
+		nodeStack.push_back(treeRoot);
+	}
+	while (!nodeStack.empty()) {
+		Tree *cur = nodeStack.back();
+		nodeStack.pop_back();
+		if (*cur == TOKEN_Term) { // if it's a Term, lower it and link it to the one that follows it in the pipe, if any
+			AstTerm *term = lowerTerm(cur, arena);
+			if (cur->next != NULL && cur->next->child != NULL) { // Terms
+				term->next = lowerTerm(cur->next->child, arena);
+			}
+		}
+		if (cur->next != NULL) {
+			nodeStack.push_back(cur->next);
+		}
+		if (cur->child != NULL) {
+			nodeStack.push_back(cur->child);
+		}
+	}
+}
+
+// parse tree cache
+
+// the layout of a cached tree file: a header, then the nodes in preorder, then the text of any nodes whose text doesn't appear verbatim in the source
+// each node is a run of varints: (tokenType << 2 | hasChild << 1 | hasNext), the zigzagged delta of its offset from the previous node's, its text length,
+// and, for nonempty text, (the zigzagged delta of its text's source position from its offset << 1 | whether the text is in the literal section instead)
+class CachedTreeHeader {
+	public:
+		// data members
+		char magic[sizeof(PARSE_CACHE_MAGIC)];
+		uint64_t key; // the key that the tree was saved against
+		uint64_t sourceSize; // the size of the source that the tree was parsed from
+		uint32_t numNodes;
+		uint32_t nodeBytes; // the size of the node section
+		uint32_t literalBytes; // the size of the literal section
+		uint64_t checksum; // a 64-bit FNV-1a hash of the node and literal sections
+};
+
+// returns the given hash extended over len bytes of data; start it off at PARSE_CACHE_CHECKSUM_SEED
+uint64_t getCacheChecksum(uint64_t hash, const void *data, size_t len) {
+	const unsigned char *bytes = (const unsigned char *)data;
+	for (size_t i=0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * 1099511628211ULL;
+	}
+	return hash;
+}
+
+void putVarint(string &out, uint32_t n) {
+	while (n >= 0x80) {
+		out += (char)((n & 0x7f) | 0x80);
+		n >>= 7;
+	}
+	out += (char)n;
+}
+
+// decodes the varint at cur into n, returning false if it runs past end
+bool getVarint(const unsigned char *&cur, const unsigned char *end, uint32_t &n) {
+	n = 0;
+	for (unsigned int shift = 0; cur < end && shift < 32; shift += 7) {
+		unsigned char c = *cur++;
+		n |= (uint32_t)(c & 0x7f) << shift;
+		if (!(c & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#define ZIGZAG(n) ((uint32_t)(((n) << 1) ^ (uint32_t)(((int32_t)(n)) >> 31)))
+#define UNZIGZAG(n) ((uint32_t)(((n) >> 1) ^ (uint32_t)(-(int32_t)((n) & 1))))
+
+bool saveTree(Tree *parseme, TreeArena &arena, SourceBuffer *in, uint64_t key, const string &fileName) {
+	if (parseme == NULL || in->size >= PARSE_CACHE_MAX_SOURCE_SIZE) { // if there's nothing to save or the offsets wouldn't fit, don't bother
+		return false;
+	}
+	// encode the nodes in preorder
+	string nodes;
+	string literals;
+	uint32_t numNodes = 0;
+	uint32_t prevOffset = 0;
+	vector<Tree *> nodeStack;
+	nodeStack.push_back(parseme);
+	while (!nodeStack.empty()) {
+		Tree *cur = nodeStack.back();
+		nodeStack.pop_back();
+		const TreeText &text = arena.texts[cur->id];
+		putVarint(nodes, ((uint32_t)cur->tokenType << 2) | ((cur->child != NULL) << 1) | (cur->next != NULL));
+		putVarint(nodes, ZIGZAG(text.offset - prevOffset));
+		prevOffset = text.offset;
+		putVarint(nodes, text.len);
+		if (text.len != 0) {
+			if (text.str >= in->data && text.str + text.len <= in->data + in->size) { // if the text is a span of the source, store its position
+				putVarint(nodes, ZIGZAG((uint32_t)(text.str - in->data) - text.offset) << 1);
+			} else { // else if the text lives outside the source (i.e. it's an escaped quoted literal), store a copy of it
+				putVarint(nodes, 1);
+				literals.append(text.str, text.len);
+			}
+		}
+		numNodes++;
+		// the next sibling goes under the child, so that the child's subtree comes out first
+		if (cur->next != NULL) {
+			nodeStack.push_back(cur->next);
+		}
+		if (cur->child != NULL) {
+			nodeStack.push_back(cur->child);
+		}
+	}
+	CachedTreeHeader header;
+	memcpy(header.magic, PARSE_CACHE_MAGIC, sizeof(header.magic));
+	header.key = key;
+	header.sourceSize = in->size;
+	header.numNodes = numNodes;
+	header.nodeBytes = nodes.length();
+	header.literalBytes = literals.length();
+	header.checksum = getCacheChecksum(getCacheChecksum(PARSE_CACHE_CHECKSUM_SEED, nodes.data(), nodes.length()), literals.data(), literals.length());
+	// write everything to a private temporary file and then move it into place, so that concurrent compilations never see a partially written tree
+	char tempSuffix[MAX_INT_STRING_LENGTH*2 + 3];
+	sprintf(tempSuffix, ".%u.%u", (unsigned int)getpid(), arena.fileIndex);
+	string tempFileName = fileName + tempSuffix;
+	FILE *out = fopen(tempFileName.c_str(), "wb");
+	if (out == NULL) {
+		return false;
+	}
+	bool written = (fwrite(&header, sizeof(header), 1, out) == 1) &&
+		(fwrite(nodes.data(), 1, nodes.length(), out) == nodes.length()) &&
+		(literals.empty() || fwrite(literals.data(), 1, literals.length(), out) == literals.length());
+	written = (fclose(out) == 0) && written;
+	if (!written || rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+		unlink(tempFileName.c_str());
+		return false;
+	}
+	return true;
+}
+
+// a place in the tree that the next decoded node attaches to; either as the first child of parent, or as the next sibling of back
+class CachedTreeSlot {
+	public:
+		// data members
+		Tree *parent;
+		Tree *back;
+};
+
+Tree *loadTree(TreeArena &arena, SourceBuffer *in, uint64_t key, const string &fileName) {
+	// read in the whole file
+	FILE *inFile = fopen(fileName.c_str(), "rb");
+	if (inFile == NULL) {
+		return NULL;
+	}
+	vector<unsigned char> buf;
+	struct stat st;
+	if (fstat(fileno(inFile), &st) == 0 && (size_t)st.st_size > sizeof(CachedTreeHeader)) {
+		buf.resize(st.st_size);
+		if (fread(&(buf[0]), 1, buf.size(), inFile) != buf.size()) {
+			buf.clear();
+		}
+	}
+	fclose(inFile);
+	if (buf.empty()) {
+		return NULL;
+	}
+	// validate the header against the source we're standing in for
+	CachedTreeHeader header;
+	memcpy(&header, &(buf[0]), sizeof(header));
+	if (memcmp(header.magic, PARSE_CACHE_MAGIC, sizeof(header.magic)) != 0 || header.key != key || header.sourceSize != in->size ||
+			buf.size() != sizeof(header) + (uint64_t)header.nodeBytes + header.literalBytes) {
+		return NULL;
+	}
+	// make sure that the payload is what was written, since the decoder trusts it to describe a well-formed tree
+	if (getCacheChecksum(PARSE_CACHE_CHECKSUM_SEED, &(buf[0]) + sizeof(header), buf.size() - sizeof(header)) != header.checksum) {
+		return NULL;
+	}
+	const unsigned char *cur = &(buf[0]) + sizeof(header);
+	const unsigned char *end = cur + header.nodeBytes;
+	const char *literals = (const char *)end;
+	uint32_t literalPos = 0;
+	// decode the nodes, attaching each one to the slot that its predecessor in preorder left open
+	Tree *root = NULL;
+	uint32_t prevOffset = 0;
+	vector<CachedTreeSlot> slotStack;
+	CachedTreeSlot rootSlot = { NULL, NULL };
+	slotStack.push_back(rootSlot);
+	bool valid = true;
+	for (uint32_t i=0; valid && i < header.numNodes; i++) {
+		uint32_t typeAndLinks, offsetDelta, len, strDelta = 0;
+		if (slotStack.empty() || !getVarint(cur, end, typeAndLinks) || !getVarint(cur, end, offsetDelta) || !getVarint(cur, end, len) ||
+				(len != 0 && !getVarint(cur, end, strDelta))) {
+			valid = false;
+			break;
+		}
+		if ((typeAndLinks >> 2) >= (NUM_LABELS)) { // if the node's type isn't a token or nonterminal that we know of, the file is bogus
+			valid = false;
+			break;
+		}
+		uint32_t offset = prevOffset + UNZIGZAG(offsetDelta);
+		prevOffset = offset;
+		const char *str = "";
+		if (len != 0) {
+			if (strDelta & 1) { // if the text is in the literal section, take the next piece of it
+				if ((uint64_t)literalPos + len > header.literalBytes) {
+					valid = false;
+					break;
+				}
+				str = in->addLiteral(string(literals + literalPos, len));
+				literalPos += len;
+			} else { // else if the text is a span of the source, point into it
+				uint32_t strPos = offset + UNZIGZAG(strDelta >> 1);
+				if ((uint64_t)strPos + len > in->size) {
+					valid = false;
+					break;
+				}
+				str = in->data + strPos;
+			}
+		}
+		Tree *node = new (arena) Tree(arena, Token((int)(typeAndLinks >> 2), str, len, arena.fileIndex, offset));
+		// link it into its slot
+		CachedTreeSlot slot = slotStack.back();
+		slotStack.pop_back();
+		if (slot.back != NULL) {
+			*(slot.back) += node;
+			*node -= slot.back;
+		} else if (slot.parent != NULL) {
+			*(slot.parent) *= node;
+			*node &= slot.parent;
+		} else {
+			root = node;
+		}
+		// open up slots for its next sibling and its first child, in the reverse of the order that they come in
+		if (typeAndLinks & 1) {
+			CachedTreeSlot nextSlot = { NULL, node };
+			slotStack.push_back(nextSlot);
+		}
+		if (typeAndLinks & 2) {
+			CachedTreeSlot childSlot = { node, NULL };
+			slotStack.push_back(childSlot);
+		}
+	}
+	if (!valid || !slotStack.empty() || cur != end || literalPos != header.literalBytes) { // if the file was damaged, throw away whatever we decoded
+		arena.clear();
+		return NULL;
+	}
+	return root;
+}
+
+// ParserProfile functions
+
+ParserProfile::ParserProfile() : files(0), shifts(0), maxStackDepth(0), time(0.0) {
+	memset(reductions, 0, sizeof(reductions));
+}
+
+void ParserProfile::operator+=(const ParserProfile &otherProfile) {
+	files += otherProfile.files;
+	shifts += otherProfile.shifts;
+	for (unsigned int i=0; i < NUM_RULES; i++) {
+		reductions[i] += otherProfile.reductions[i];
+	}
+	if (otherProfile.maxStackDepth > maxStackDepth) {
+		maxStackDepth = otherProfile.maxStackDepth;
+	}
+	time += otherProfile.time;
+}
+
+// orders rules by descending reduction count, and then by rule number
+class ReductionOrder {
+	public:
+		// data members
+		const unsigned long long *reductions;
+		// allocators/deallocators
+		ReductionOrder(const unsigned long long *reductions) : reductions(reductions) {}
+		// operators
+		bool operator()(unsigned int a, unsigned int b) const {
+			return ((reductions[a] != reductions[b]) ? (reductions[a] > reductions[b]) : (a < b));
+		}
+};
+
+// returns the given string as a JSON string literal
+string jsonString(const char *s) {
+	string retVal("\"");
+	for (; *s != '\0'; s++) {
+		if (*s == '\"' || *s == '\\') {
+			retVal += '\\';
+		}
+		retVal += *s;
+	}
+	retVal += '\"';
+	return retVal;
+}
+
+void ParserProfile::report(ostream &out, int mode) const {
+	// sort the rules that were used by how much they were used
+	vector<unsigned int> rules;
+	unsigned long long totalReductions = 0;
+	for (unsigned int i=0; i < NUM_RULES; i++) {
+		if (reductions[i] != 0) {
+			rules.push_back(i);
+			totalReductions += reductions[i];
+		}
+	}
+	sort(rules.begin(), rules.end(), ReductionOrder(reductions));
+	char timeString[MAX_INT_STRING_LENGTH];
+	sprintf(timeString, "%.6f", time);
+	if (mode == PARSER_PROFILE_JSON) {
+		out << "{\"files\": " << files << ", \"shifts\": " << shifts << ", \"reductions\": " << totalReductions <<
+			", \"maxStackDepth\": " << maxStackDepth << ", \"parseSeconds\": " << timeString << ", \"rules\": [";
+		for (unsigned int i=0; i < rules.size(); i++) {
+			out << ((i != 0) ? ", " : "") << "{\"rule\": " << rules[i] << ", \"production\": " << jsonString(ruleString[rules[i]]) << ", \"reductions\": " << reductions[rules[i]] << "}";
+		}
+		out << "]}\n";
+	} else {
+		out << PROGRAM_STRING << ": parser profile: " << files << " files, " << shifts << " shifts, " << totalReductions << " reductions, maximum state stack depth " <<
+			maxStackDepth << ", " << timeString << " s in parse().\n";
+		for (unsigned int i=0; i < rules.size(); i++) {
+			char shareString[MAX_INT_STRING_LENGTH];
+			sprintf(shareString, "%5.1f%%", 100.0*reductions[rules[i]]/totalReductions);
+			out << "\t" << reductions[rules[i]] << "\t" << shareString << "\t(" << rules[i] << ") " << ruleString[rules[i]] << "\n";
+		}
+	}
+}
+
+// returns the current wall clock time, in seconds
+inline double getProfileTime() {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec/1000000.0);
+}
+
 // main parsing functions
 
-void shiftToken(Tree *&treeCur, Token &t) {
-	Tree *treeToAdd = new Tree(t, NULL, treeCur, NULL, NULL);
+void shiftToken(Tree *&treeCur, Token &t, TreeArena &arena) {
+	Tree *treeToAdd = new (arena) Tree(arena, t, NULL, treeCur, NULL, NULL);
 	// link right from the current node
 	if (treeCur != NULL) {
 		*treeCur += treeToAdd;
@@ -166,8 +648,8 @@ void shiftToken(Tree *&treeCur, Token &t) {
 	treeCur = treeToAdd;
 }
 
-void promoteToken(Tree *&treeCur, Token &t) {
-	Tree *treeToAdd = new Tree(t, NULL, (treeCur != NULL) ? treeCur->back : NULL, treeCur, (treeCur != NULL) ? treeCur->parent : NULL);
+void promoteToken(Tree *&treeCur, Token &t, TreeArena &arena) {
+	Tree *treeToAdd = new (arena) Tree(arena, t, NULL, (treeCur != NULL) ? treeCur->back : NULL, treeCur, (treeCur != NULL) ? treeCur->parent : NULL);
 	// relatch on the left
 	if (treeCur != NULL && treeCur->back != NULL) {
 		*(treeCur->back) += treeToAdd;
@@ -186,53 +668,60 @@ void promoteToken(Tree *&treeCur, Token &t) {
 }
 
 // treeCur is guaranteed not to be NULL in this case
-void shiftPromoteNullToken(Tree *&treeCur, Token &t) {
-	Tree *treeToAdd = new Tree(t, NULL, treeCur, NULL, NULL);
+void shiftPromoteNullToken(Tree *&treeCur, Token &t, TreeArena &arena) {
+	Tree *treeToAdd = new (arena) Tree(arena, t, NULL, treeCur, NULL, NULL);
 	// link in the newly allocated node
 	*treeCur += treeToAdd;
 	// set treeCur to the newly allocated node
 	treeCur = treeToAdd;
 }
 
-int parse(vector<Token> *lexeme, Tree *&parseme, unsigned int fileIndex) {
+// the parser's main loop; it's specialized at compile time on whether it traces its actions and whether it profiles them, so the production instantiation carries no branches for either
+template <bool traced, bool profiled> int parseLoop(Lexer &lexer, Tree *&parseme, TreeArena &arena, ostream &outStream, ostream &errorStream, ParserProfile *profile) {
 
+	// if we're profiling, start the clock
+	double startTime = profiled ? getProfileTime() : 0.0;
 	// initialize local error code
-	parserErrorCode = 0;
+	int parserErrorCode = 0;
+	// the file that we're parsing
+	unsigned int fileIndex = lexer.fileIndex;
 
-	// initialize parser structures
-#include "../tmp/ruleRhsLengthRaw.h"
-#include "../tmp/ruleLhsTokenTypeRaw.h"
-#include "../tmp/ruleLhsTokenStringRaw.h"
-#include "../tmp/parserNodeRaw.h"
-
-	// iterate through the lexemes and do the actual parsing
+	// pull tokens out of the lexer and do the actual parsing
 	// initialize the current bit of tree that we're examining
 	Tree *treeCur = NULL;
-	// initialize the state stack and push the initial state onto it
-	stack<unsigned int> stateStack;
-	stateStack.push(0);
+	// initialize the state stack and push the initial state onto it; the stack is a flat array, preallocated to cover typical nesting depths
+	vector<unsigned int> stateStack;
+	stateStack.reserve(PARSER_STATE_STACK_RESERVE);
+	stateStack.push_back(0);
 
-	for(vector<Token>::iterator lexemeIter = lexeme->begin(); lexemeIter != lexeme->end(); lexemeIter++) {
+	bool accepted = false;
+	for(Token *lookahead = lexer.next(); lookahead != NULL && !lexer.lexerErrorCode; lookahead = lexer.next()) { // stop as soon as the lexer fails, since its tokens can't be trusted anymore
 
 transitionParserState: ;
 
 		// get the current state off the top of the stack
-		unsigned int curState = stateStack.top();
+		unsigned int curState = stateStack.back();
 		// peek at the next token of input
-		Token &t = *lexemeIter;
+		Token &t = *lookahead;
 		// get the transition node for the current state
-		ParserNode transition = parserNode[curState][t.tokenType];
+		ParserNode transition = parserTransition(curState, t.tokenType);
 
 		// branch based on the type of action dictated by the transition
 		if (transition.action == ACTION_SHIFT) {
-			shiftToken(treeCur, t);
-			stateStack.push(transition.n);
+			shiftToken(treeCur, t, arena);
+			stateStack.push_back(transition.n);
+			if (profiled) {
+				profile->shifts++;
+				if (stateStack.size() > profile->maxStackDepth) {
+					profile->maxStackDepth = stateStack.size();
+				}
+			}
 
-			VERBOSE( cout << "\t" <<
-				COLOREXP(SET_TERM(BRIGHT_CODE AND MAGENTA_CODE)) << "SHIFT" << COLOREXP(SET_TERM(RESET_CODE)) <<
-				"\t" << curState << "\t->\t" << transition.n << "\t[" <<
-				COLOREXP(SET_TERM(BRIGHT_CODE AND CYAN_CODE)) << tokenType2String(t.tokenType) << COLOREXP(SET_TERM(RESET_CODE)) <<
-				"]\n"; )
+			if (traced) {
+				outStream << "\t" <<
+					COLOREXP(SET_TERM(BRIGHT_CODE AND MAGENTA_CODE)) << "SHIFT" << COLOREXP(SET_TERM(RESET_CODE)) <<
+					"\t" << curState << "\t->\t" << transition.n << "\t" << t << "\n";
+			}
 
 		} else if (transition.action == ACTION_REDUCE) {
 			unsigned int numRhs = ruleRhsLength[transition.n];
@@ -240,60 +729,262 @@ transitionParserState: ;
 			if (numRhs > 1) {
 				treeCur = treeCur->goBack(numRhs-1);
 			}
-			for (unsigned int i=0; i<numRhs; i++) {
-				stateStack.pop();
-			}
+			stateStack.resize(stateStack.size() - numRhs);
 			// create the token that the promoted node will have
 			Token t;
 			t.tokenType = tokenType;
 			t.fileIndex = fileIndex;
-			t.row = treeCur != NULL ? treeCur->t.row : 0;
-			t.col = treeCur != NULL ? treeCur->t.col : 0;
+			t.offset = treeCur != NULL ? arena.texts[treeCur->id].offset : NO_SOURCE_OFFSET;
 			// promote the current token, as appropriate
 			if (numRhs != 0 || treeCur == NULL) { // if it's not the NULL-shifting promotion case
-				promoteToken(treeCur, t);
+				promoteToken(treeCur, t, arena);
 			} else { // else if it is the NULL-shifting promotion case
-				shiftPromoteNullToken(treeCur, t); // note: the above case handles treeCur == NULL
+				shiftPromoteNullToken(treeCur, t, arena); // note: the above case handles treeCur == NULL
 			}
 			// take the goto branch of the new transition
-			int tempState = stateStack.top();
-			stateStack.push(parserNode[tempState][tokenType].n);
+			int tempState = stateStack.back();
+			stateStack.push_back(parserTransition(tempState, tokenType).n);
+			if (profiled) {
+				profile->reductions[transition.n]++;
+				if (stateStack.size() > profile->maxStackDepth) {
+					profile->maxStackDepth = stateStack.size();
+				}
+			}
 
-			VERBOSE(
+			if (traced) {
 				const char *tokenString = ruleLhsTokenString[transition.n];
-				cout << "\t" <<
+				outStream << "\t" <<
 					COLOREXP(SET_TERM(BRIGHT_CODE AND GREEN_CODE)) << "REDUCE" << COLOREXP(SET_TERM(RESET_CODE)) <<
-					"\t" << curState << "\t->\t" << stateStack.top() << "\t<" <<
+					"\t" << curState << "\t->\t" << stateStack.back() << "\t<" <<
 					COLOREXP(SET_TERM(BRIGHT_CODE AND CYAN_CODE)) << tokenString << COLOREXP(SET_TERM(RESET_CODE)) <<
 					">\n";
-			)
+			}
 
 			goto transitionParserState;
 		} else if (transition.action == ACTION_ACCEPT) {
 
-			VERBOSE( cout << "\t" <<
-				COLOREXP(SET_TERM(BRIGHT_CODE AND WHITE_CODE)) << "ACCEPT" << COLOREXP(SET_TERM(RESET_CODE)) <<
-				"\n"; )
+			if (traced) {
+				outStream << "\t" <<
+					COLOREXP(SET_TERM(BRIGHT_CODE AND WHITE_CODE)) << "ACCEPT" << COLOREXP(SET_TERM(RESET_CODE)) <<
+					"\n";
+			}
 
+			accepted = true;
 			break;
 		} else if (transition.action == ACTION_ERROR) {
 			string errorString = "syntax error at ";
 			if (t.tokenType == TOKEN_CQUOTE || t.tokenType == TOKEN_SQUOTE) {
 				errorString += "quoted literal";
 			} else {
-				errorString += "\'" + t.s + "\'";
+				errorString += "\'" + t.s() + "\'";
 			}
-			parserError(fileIndex, t.row, t.col, errorString);
+			parserError(fileIndex, t.row(), t.col(), errorString);
 			break;
 		}
 	}
 
-	if (parserErrorCode) { // if there was an error, clean up
-		// deallocate the unfinished tree, since there was an error anyway
-		delete treeCur;
-	} else { // else if there were no errors, log the root parseme into the return slot
+	// if we stopped early, run the lexer over the rest of the file so that all of its errors still get reported
+	if (!accepted) {
+		while (lexer.next() != NULL);
+	}
+
+	if (!(parserErrorCode || lexer.lexerErrorCode)) { // if there were no errors, log the root parseme into the return slot
 		parseme = treeCur;
+	} // else if there was an error, the unfinished tree is simply released along with the arena
+	// if we're profiling, log this call
+	if (profiled) {
+		profile->files++;
+		profile->time += getProfileTime() - startTime;
 	}
 	// return to the caller
+	return (parserErrorCode + lexer.lexerErrorCode);
+}
+
+int parse(Lexer &lexer, Tree *&parseme, TreeArena &arena, ostream &outStream, ostream &errorStream, ParserProfile *profile) {
+	// dispatch to the appropriate specialization of the main loop
+	if (verboseOutput) {
+		if (profile != NULL) {
+			return parseLoop<true, true>(lexer, parseme, arena, outStream, errorStream, profile);
+		} else {
+			return parseLoop<true, false>(lexer, parseme, arena, outStream, errorStream, profile);
+		}
+	} else {
+		if (profile != NULL) {
+			return parseLoop<false, true>(lexer, parseme, arena, outStream, errorStream, profile);
+		} else {
+			return parseLoop<false, false>(lexer, parseme, arena, outStream, errorStream, profile);
+		}
+	}
+}
+
+// incremental reparsing
+
+// returns the SEMICOLON that ends the given top-level Pipe or LastPipe, or NULL if it doesn't end with one
+Tree *pipeSemicolon(Tree *pipe) {
+	Tree *cur = pipe->child; // NonEmptyTerms or Declaration
+	if (*cur == TOKEN_Declaration) {
+		cur = cur->child;
+	}
+	while (cur->next != NULL) {
+		cur = cur->next;
+	}
+	return ((*cur == TOKEN_SEMICOLON) ? cur : NULL);
+}
+
+// ReparseState functions
+
+ReparseState::ReparseState(Tree *parseme) : parseme(parseme) {
+	index(0, 0, parseme);
+}
+
+void ReparseState::index(unsigned int first, unsigned int last, Tree *program) {
+	vector<Tree *> newPipes;
+	vector<unsigned int> newStarts;
+	vector<unsigned int> newFirstIds;
+	// invariant: the pipes hang off a spine of Pipes and NonEmptyPipes nodes, each the first child's parent
+	for (Tree *cur = (program != NULL && program->child != NULL) ? program->child->child : NULL; cur != NULL; cur = (cur->next != NULL) ? cur->next->child : NULL) {
+		newPipes.push_back(cur);
+		newStarts.push_back(cur->arena()->texts[cur->id].offset);
+		newFirstIds.push_back(cur->bottom()->id); // the pipe's first token; the nodes of a pipe are allocated together, so its subtree is the id range from there to the pipe itself
+	}
+	pipes.erase(pipes.begin() + first, pipes.begin() + last);
+	pipes.insert(pipes.begin() + first, newPipes.begin(), newPipes.end());
+	starts.erase(starts.begin() + first, starts.begin() + last);
+	starts.insert(starts.begin() + first, newStarts.begin(), newStarts.end());
+	firstIds.erase(firstIds.begin() + first, firstIds.begin() + last);
+	firstIds.insert(firstIds.begin() + first, newFirstIds.begin(), newFirstIds.end());
+}
+
+unsigned int ReparseState::end(unsigned int i, SourceBuffer *in) {
+	Tree *semicolon = pipeSemicolon(pipes[i]);
+	if (semicolon != NULL) {
+		return (semicolon->arena()->texts[semicolon->id].offset + 1);
+	} else {
+		return ((i+1 < pipes.size()) ? starts[i+1] : in->size);
+	}
+}
+
+// relinks the spine of Pipes and NonEmptyPipes nodes of the given Program around the pipes in the given range, reusing each pipe's existing spine node
+// the pipes before the range and after it are assumed to be linked up already
+void respine(Tree *program, vector<Tree *> &pipes, unsigned int first, unsigned int last, TreeArena &arena) {
+	if (pipes.empty()) { // if there are no pipes left, leave the Program with an empty Pipes node
+		program->child->child = NULL;
+		arena.texts[program->child->id].offset = arena.texts[program->id].offset = NO_SOURCE_OFFSET;
+		return;
+	}
+	// the spine node of the first pipe becomes the Program's Pipes node
+	Tree *firstSpine = pipes[0]->parent;
+	firstSpine->tokenType = TOKEN_Pipes;
+	firstSpine->back = NULL;
+	firstSpine->parent = program;
+	program->child = firstSpine;
+	arena.texts[program->id].offset = arena.texts[firstSpine->id].offset;
+	// link each pipe in the range (and the one before it) to its successor's spine node
+	for (unsigned int i = (first > 0) ? first-1 : 0; i <= last && i < pipes.size(); i++) {
+		if (i+1 < pipes.size()) {
+			Tree *spine = pipes[i+1]->parent;
+			spine->tokenType = TOKEN_NonEmptyPipes;
+			spine->parent = NULL;
+			*(pipes[i]) += spine;
+			*spine -= pipes[i];
+		} else {
+			*(pipes[i]) += NULL;
+		}
+	}
+}
+
+// shifts the positions of the nodes in [firstId, lastId] by delta, given that their source text has been moved along with them
+inline void shiftTexts(TreeArena &arena, unsigned int firstId, unsigned int lastId, const char *data, size_t size, int delta) {
+	deque<TreeText>::iterator end = arena.texts.begin() + (lastId + 1);
+	for (deque<TreeText>::iterator iter = arena.texts.begin() + firstId; iter != end; iter++) {
+		if (iter->offset != NO_SOURCE_OFFSET) {
+			iter->offset += delta;
+		}
+		if (iter->len != 0 && iter->str >= data && iter->str < data + size) { // text that isn't in the source (i.e. escaped literals) stays where it is
+			iter->str += delta;
+		}
+	}
+}
+
+// the incremental part of reparse(); returns whether it worked out, leaving the edit applied to the source either way
+bool reparseRegion(SourceBuffer *in, unsigned int editStart, unsigned int editOldEnd, const string &text, ReparseState &state, TreeArena &arena, ostream &outStream) {
+	vector<unsigned int> &starts = state.starts;
+	// keep every pipe that ends strictly before the edit, back to the last one that ends with a SEMICOLON, so that the parser's context there is the same as at the start of a file
+	unsigned int keepBefore = upper_bound(starts.begin(), starts.end(), editStart) - starts.begin();
+	while (keepBefore > 0 && state.end(keepBefore-1, in) >= editStart) {
+		keepBefore--;
+	}
+	while (keepBefore > 0 && pipeSemicolon(state.pipes[keepBefore-1]) == NULL) {
+		keepBefore--;
+	}
+	// keep every pipe that starts strictly after the edit
+	unsigned int keepAfter = upper_bound(starts.begin() + keepBefore, starts.end(), editOldEnd) - starts.begin();
+	unsigned int regionStart = (keepBefore > 0) ? state.end(keepBefore-1, in) : 0;
+	// apply the edit, moving the text of the pipes after it; the pipes in between are about to be thrown away
+	const char *oldData = in->data;
+	size_t oldSize = in->size;
+	int delta = (int)text.length() - (int)(editOldEnd - editStart);
+	if (in->replace(editStart, editOldEnd, text)) { // if the source moved, point all of the kept nodes at its new location
+		for (deque<TreeText>::iterator iter = arena.texts.begin(); iter != arena.texts.end(); iter++) {
+			if (iter->len != 0 && iter->str >= oldData && iter->str < oldData + oldSize) {
+				unsigned int pos = iter->str - oldData;
+				iter->str = in->data + ((pos < editStart || pos >= editOldEnd) ? pos : editStart);
+			}
+		}
+		oldData = in->data;
+	}
+	for (unsigned int i = keepAfter; i < state.pipes.size(); i++) {
+		shiftTexts(arena, state.firstIds[i], state.pipes[i]->id, oldData, oldSize, delta);
+		starts[i] += delta;
+		arena.texts[state.pipes[i]->parent->id].offset = starts[i]; // the spine node above the pipe
+	}
+	unsigned int regionEnd = (keepAfter < state.pipes.size()) ? starts[keepAfter] : in->size;
+	// parse the region on its own; any errors in it are left for the full parse to report, since they may be artifacts of cutting it out of the file
+	ostringstream regionErrors;
+	Lexer lexer(in, arena.fileIndex, regionStart, regionEnd, regionErrors);
+	Tree *region = NULL;
+	if (parse(lexer, region, arena, outStream, regionErrors) != 0) {
+		return false;
+	}
+	// the region can only be spliced in as is if its last pipe ends with a SEMICOLON, unless it runs to the end of the file
+	Tree *regionSpine = region->child;
+	Tree *lastRegionPipe = NULL;
+	for (Tree *cur = regionSpine->child; cur != NULL; cur = (cur->next != NULL) ? cur->next->child : NULL) {
+		lastRegionPipe = cur;
+	}
+	if (lastRegionPipe != NULL && keepAfter < state.pipes.size() && pipeSemicolon(lastRegionPipe) == NULL) {
+		return false;
+	}
+	// splice the region's pipes in place of the old ones
+	lowerTree(region, arena);
+	unsigned int numPipes = state.pipes.size();
+	state.index(keepBefore, keepAfter, region);
+	respine(state.parseme, state.pipes, keepBefore, keepBefore + (state.pipes.size() + keepAfter - numPipes - keepBefore), arena);
+	return true;
+}
+
+int reparse(SourceBuffer *in, unsigned int editStart, unsigned int editOldEnd, const string &text, ReparseState &state, TreeArena &arena,
+		ostream &outStream, ostream &errorStream, bool *incremental) {
+	bool worked = false;
+	if (state.parseme != NULL) { // if we have an old tree to work from, try to reparse only the part of it around the edit
+		worked = reparseRegion(in, editStart, editOldEnd, text, state, arena, outStream);
+	} else {
+		in->replace(editStart, editOldEnd, text);
+	}
+	if (incremental != NULL) {
+		*incremental = worked;
+	}
+	if (worked) {
+		return 0;
+	}
+	// otherwise, fall back to parsing the whole file again from scratch
+	arena.clear();
+	state = ReparseState(NULL);
+	Lexer lexer(in, arena.fileIndex, errorStream);
+	int parserErrorCode = parse(lexer, state.parseme, arena, outStream, errorStream);
+	if (!parserErrorCode) {
+		lowerTree(state.parseme, arena);
+		state = ReparseState(state.parseme);
+	}
 	return parserErrorCode;
 }
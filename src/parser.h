@@ -16,22 +16,90 @@ class TypeStatus;
 class IRTree;
 class DataTree;
 
+// compact AST Term kinds; each names what sits at the bottom of a Term's chain of unit productions
+#define TERM_DYNAMIC 0 // DynamicTerm
+#define TERM_SIMPLE_COND 1 // SimpleCondTerm
+#define TERM_CLOSED_COND 2 // ClosedCondTerm
+#define TERM_OPEN_COND 3 // OpenCondTerm
+#define TERM_SWITCH 4 // SwitchTerm
+#define TERM_FLOW_INSTANTIATION 5 // Instantiation with a SingleFlowInitInstantiationSource or MultiFlowInitInstantiationSource
+#define TERM_ACCESS 6 // SingleAccess or MultiAccess
+#define TERM_EXP 7 // BracketedExp
+#define TERM_INSTANTIATION 8 // any other Instantiation
+#define TERM_IDENTIFIER 9 // NonArrayedIdentifier or ArrayedIdentifier
+#define TERM_FILTER 10 // Filter
+#define TERM_OBJECT 11 // Object
+#define TERM_PRIM_OP 12 // PrimOpNode
+#define TERM_PRIM_LITERAL 13 // PrimLiteral
+
+// cold per-node data that the parser records; only needed for diagnostics and identifier decoding
+class TreeText {
+	public:
+		// data members
+		const char *str; // as in Token::str
+		unsigned int len; // as in Token::len
+		unsigned int offset; // as in Token::offset
+};
+
+// cold per-node data that the semmer derives; only allocated once semantic analysis starts touching a tree
+class TreeSemantics {
+	public:
+		// data members
+		SymbolTree *env; // the symbol environment in which this node occurs
+		TypeStatus status; // the status coming OUT of this node
+		// allocators/deallocators
+		TreeSemantics();
+};
+
+// bump allocator for the parse tree nodes of one file; nodes are never freed individually, but all at once when the arena is destroyed
+// the arena also holds the nodes' cold data, in side tables indexed by node id
+class TreeArena {
+	public:
+		// data members
+		unsigned int fileIndex; // the file that all of the nodes in this arena came from
+		vector<char *> blocks; // the memory blocks that have been handed out so far; each starts with a pointer back to this arena
+		char *cur; // the unused part of the current block
+		char *end;
+		deque<TreeText> texts; // per-node source text and position; a deque, so that growing it while parsing never copies it
+		deque<TreeSemantics> semantics; // per-node semantic data; a deque so that references into it survive later growth
+		map<unsigned int, AstTerm *> asts; // the compact AST nodes lowered from this arena's Terms, keyed by node id; a map, since only Terms have one, and lowering shouldn't allocate the semantic table
+		// allocators/deallocators
+		TreeArena(unsigned int fileIndex = STANDARD_LIBRARY_FILE_INDEX);
+		~TreeArena();
+		// core methods
+		void *alloc(size_t size);
+		void clear(); // releases all of the nodes in the arena at once
+		TreeSemantics &sem(unsigned int id); // the semantic data for the given node, allocating the table on first use
+		unsigned int numNodes() const;
+		size_t bytes() const; // the total memory held by the arena and its side tables
+};
+
+void *operator new(size_t size, TreeArena &arena);
+void operator delete(void *p, TreeArena &arena); // only used if a constructor throws
+
+// parse tree node; only the fields needed to navigate the tree are stored inline, so that tree walks touch as little memory as possible
+// everything else lives in the side tables of the TreeArena that the node was allocated in, and is reached through the accessors below
 class Tree {
 	public:
 		// data members
-		Token t;
+		int tokenType;
+		unsigned int id; // this node's index into its arena's side tables
 		Tree *next;
 		Tree *back;
 		Tree *child;
 		Tree *parent;
-		SymbolTree *env; // the symbol environment in which this node occurs
-		TypeStatus status; // the status coming OUT of this node
-		// allocators/deallocators
-		Tree(const Token &t);
-		Tree(const Token &t, Tree *next, Tree *back, Tree *child, Tree *parent);
-		Tree(const TypeStatus &status);
-		Tree(deque<unsigned int> *depthList);
+		// allocators/deallocators; nodes must be allocated in the arena that they are constructed with
+		Tree(TreeArena &arena, const Token &t);
+		Tree(TreeArena &arena, const Token &t, Tree *next, Tree *back, Tree *child, Tree *parent);
+		Tree(TreeArena &arena, const TypeStatus &status);
+		Tree(TreeArena &arena, deque<unsigned int> *depthList);
 		~Tree();
+		// side table accessors
+		TreeArena *arena() const;
+		Token t() const; // materializes this node's token
+		SymbolTree *&env() const;
+		TypeStatus &status() const;
+		AstTerm *ast() const; // the AstTerm lowered from this node if it's a Term; NULL otherwise
 		// core methods
 		IRTree *code() const;
 		Type &typeRef() const;
@@ -55,7 +123,66 @@ class Tree {
 		operator string() const; // only for SuffixedIdentifier or NonArraySuffixedIdentifier kinds
 };
 
-int parse(vector<Token> *lexeme, Tree *&parseme, unsigned int fileIndex);
+// chain-collapsed view of a Term, built by lowerTree() after parsing so that Terms can be classified and dispatched without walking their unit productions
+class AstTerm {
+	public:
+		// data members
+		int kind; // one of the TERM_* kinds
+		Tree *term; // the Term that this node was lowered from
+		Tree *dispatch; // the DynamicTerm, SimpleTerm, SimpleCondTerm, ClosedCondTerm, or OpenCondTerm directly below the Term
+		Tree *operand; // the node at the bottom of the Term's chain of unit productions
+		AstTerm *next; // the next Term in the same pipe, or NULL if this is the last one
+		// allocators/deallocators
+		AstTerm(Tree *term);
+		// core methods
+		bool isFlowThrough() const; // whether values flow through this Term (i.e. it's a Node other than an Instantiation)
+		bool isStaticOperand() const; // whether this Term can be consumed as the right operand of a three-term operator flow
+};
+
+void lowerTree(Tree *treeRoot, TreeArena &arena); // lowers all of the Terms in the given parse tree into AstTerm nodes allocated in the given arena
+
+// parse tree cache; trees are stored against a key that identifies the source contents and the compiler that parsed them
+bool saveTree(Tree *parseme, TreeArena &arena, SourceBuffer *in, uint64_t key, const string &fileName); // returns whether the tree was written
+Tree *loadTree(TreeArena &arena, SourceBuffer *in, uint64_t key, const string &fileName); // loads into an empty arena; returns NULL (leaving the arena empty) if there's no usable tree in the file
+
+// parser statistics, gathered over one or more calls to parse() when profiling is enabled
+class ParserProfile {
+	public:
+		// data members
+		unsigned int files; // the number of calls to parse() counted
+		unsigned long long shifts;
+		unsigned long long reductions[NUM_RULES]; // per rule
+		unsigned int maxStackDepth; // the deepest that the state stack got
+		double time; // the wall clock time spent in parse(), in seconds; this includes lexing, since the parser pulls its tokens from the lexer
+		// allocators/deallocators
+		ParserProfile();
+		// core methods
+		void operator+=(const ParserProfile &otherProfile);
+		void report(ostream &out, int mode) const; // prints a summary in the given PARSER_PROFILE_ mode
+};
+
+int parse(Lexer &lexer, Tree *&parseme, TreeArena &arena, ostream &outStream = cout, ostream &errorStream = cerr, ParserProfile *profile = NULL); // returns the number of lexical and syntax errors encountered; counts into profile if it's given
+
+// the state that incremental reparsing keeps for a file between edits: its lowered parse tree, and an index of the tree's top-level pipes
+class ReparseState {
+	public:
+		// data members
+		Tree *parseme; // the current parse tree, or NULL if the file doesn't parse
+		vector<Tree *> pipes; // the top-level Pipes and LastPipes, in order
+		vector<unsigned int> starts; // the offset of each pipe's first token
+		vector<unsigned int> firstIds; // the id of each pipe's first token
+		// allocators/deallocators
+		ReparseState(Tree *parseme = NULL);
+		// core methods
+		void index(unsigned int first, unsigned int last, Tree *program); // replaces the pipes in [first, last) with the top-level pipes of the given Program
+		unsigned int end(unsigned int i, SourceBuffer *in); // the offset just past pipe i; its SEMICOLON, or the start of the next pipe if it has none
+};
+
+// applies an edit to the given source (replacing the bytes in [editStart, editOldEnd) with text) and updates its parse tree to match, returning the number of errors as parse() does
+// only the top-level pipes around the edit are lexed and parsed again, and the rest are kept; if that doesn't work out, the whole file is parsed again in a cleared arena
+// the tree must not have been through semantic analysis; incremental, if given, says whether the tree was reparsed incrementally
+int reparse(SourceBuffer *in, unsigned int editStart, unsigned int editOldEnd, const string &text, ReparseState &state, TreeArena &arena,
+	ostream &outStream = cout, ostream &errorStream = cerr, bool *incremental = NULL);
 
 // post-includes
 #include "semmer.h"
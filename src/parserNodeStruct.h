@@ -14,4 +14,12 @@ struct parserNodeStruct {
 };
 typedef struct parserNodeStruct ParserNode;
 
+// compressed parse table entries pack an action into the top 3 bits and its state/rule number into the rest of an unsigned short
+#define PARSER_ENTRY_N_BITS 13
+#define PARSER_ENTRY_N_MASK ((1 << PARSER_ENTRY_N_BITS) - 1)
+#define PARSER_ENTRY(action, n) ((unsigned short)(((action) << PARSER_ENTRY_N_BITS) | (n)))
+#define PARSER_ENTRY_ACTION(entry) ((entry) >> PARSER_ENTRY_N_BITS)
+#define PARSER_ENTRY_N(entry) ((unsigned int)((entry) & PARSER_ENTRY_N_MASK))
+#define PARSER_CHECK_EMPTY 0xFFFF /* the check value of unused slots in the comb vector */
+
 #endif
@@ -4,7 +4,9 @@
 
 // semmer-global variables
 
-int semmerErrorCode;
+__thread int semmerErrorCode;
+__thread bool semmerErrorNested = false;
+__thread ostream *semmerErrorStream = &cerr;
 
 Type *nullType;
 Type *errType;
@@ -31,30 +33,217 @@ ObjectType *charCompOpType;
 ObjectType *stringCompOpType;
 StdType *stdLibType;
 SymbolTree *stdLib;
+AtomTable atomTable;
+BindingCache bindingCache;
+TypeTable typeTable;
 IRTree *nopCode;
 
+TreeArena semmerTreeArena; // holds the Tree nodes that the semmer synthesizes itself, as opposed to those that come from parsing
+__thread SemWorker *semWorker = NULL; // the state of the current thread during parallel semantic analysis; NULL otherwise
+
+// returns the arena in which the current thread should synthesize Tree nodes
+inline TreeArena &curSemmerTreeArena() {
+	return ((semWorker != NULL) ? *(semWorker->arena) : semmerTreeArena);
+}
+
+// returns the current thread's name resolution cache
+inline BindingCache &curBindingCache() {
+	return ((semWorker != NULL) ? semWorker->bindingCache : bindingCache);
+}
+
+// AtomTable functions
+AtomTable::AtomTable() : slots(ATOM_TABLE_INITIAL_SIZE, make_pair(0U, (Atom)0)), shared(false) {
+	pthread_mutex_init(&mutex, NULL);
+	// intern the well-known atoms, in the order of their definitions
+	intern("..");
+	intern("[]");
+	intern("[:]");
+}
+AtomTable::~AtomTable() {
+	pthread_mutex_destroy(&mutex);
+}
+Atom AtomTable::intern(const char *str, unsigned int len) {
+	if (shared) {
+		pthread_mutex_lock(&mutex);
+	}
+	// hash the string (32-bit FNV-1a)
+	unsigned int hash = 2166136261U;
+	for (unsigned int i = 0; i < len; i++) {
+		hash = (hash ^ (unsigned char)str[i]) * 16777619U;
+	}
+	// probe for the string
+	unsigned int mask = slots.size() - 1;
+	unsigned int slot;
+	Atom atom = 0;
+	bool found = false;
+	for (slot = hash & mask; slots[slot].second != 0; slot = (slot + 1) & mask) {
+		if (slots[slot].first == hash) { // if the hashes match, check the string itself
+			atom = slots[slot].second - 1;
+			if (strings[atom].length() == len && memcmp(strings[atom].data(), str, len) == 0) { // if we found the string, we're done
+				found = true;
+				break;
+			}
+		}
+	}
+	if (!found) { // if this is a new string, log a new atom for it
+		atom = strings.size();
+		strings.push_back(string(str, len));
+		slots[slot] = make_pair(hash, atom + 1);
+		// if the table is now over half full, double its size and rehash
+		if (2*strings.size() > slots.size()) {
+			vector<pair<unsigned int, Atom> > oldSlots;
+			oldSlots.swap(slots);
+			slots.assign(2*oldSlots.size(), make_pair(0U, (Atom)0));
+			mask = slots.size() - 1;
+			for (vector<pair<unsigned int, Atom> >::const_iterator slotIter = oldSlots.begin(); slotIter != oldSlots.end(); slotIter++) {
+				if ((*slotIter).second != 0) {
+					for (slot = (*slotIter).first & mask; slots[slot].second != 0; slot = (slot + 1) & mask);
+					slots[slot] = *slotIter;
+				}
+			}
+		}
+	}
+	if (shared) {
+		pthread_mutex_unlock(&mutex);
+	}
+	return atom;
+}
+Atom AtomTable::intern(const string &s) {
+	return intern(s.data(), s.length());
+}
+const string &AtomTable::operator[](Atom atom) const {
+	if (shared) { // the strings themselves never move, but the deque's index into them can while another thread is interning
+		pthread_mutex_lock(&mutex);
+		const string &str = strings[atom];
+		pthread_mutex_unlock(&mutex);
+		return str;
+	}
+	return strings[atom];
+}
+
+// AtomMap functions
+AtomMap::AtomMap() : count(0) {}
+AtomMap::~AtomMap() {}
+SymbolTree *AtomMap::find(Atom atom) const {
+	if (count == 0) {
+		return NULL;
+	}
+	unsigned int mask = slots.size() - 1;
+	for (unsigned int slot = (atom * ATOM_MAP_HASH_MULTIPLIER) & mask; slots[slot].second != NULL; slot = (slot + 1) & mask) {
+		if (slots[slot].first == atom) {
+			return slots[slot].second;
+		}
+	}
+	return NULL;
+}
+void AtomMap::insert(Atom atom, SymbolTree *st) {
+	// if the table would be over half full, double its size and rehash
+	if (2*(count+1) > slots.size()) {
+		vector<pair<Atom, SymbolTree *> > oldSlots;
+		oldSlots.swap(slots);
+		slots.assign(max((size_t)ATOM_MAP_INITIAL_SIZE, 2*oldSlots.size()), make_pair((Atom)0, (SymbolTree *)NULL));
+		count = 0;
+		for (vector<pair<Atom, SymbolTree *> >::const_iterator slotIter = oldSlots.begin(); slotIter != oldSlots.end(); slotIter++) {
+			if ((*slotIter).second != NULL) {
+				insert((*slotIter).first, (*slotIter).second);
+			}
+		}
+	}
+	// probe for the atom, inserting the mapping if it's not already there
+	unsigned int mask = slots.size() - 1;
+	unsigned int slot;
+	for (slot = (atom * ATOM_MAP_HASH_MULTIPLIER) & mask; slots[slot].second != NULL; slot = (slot + 1) & mask) {
+		if (slots[slot].first == atom) { // if there's already a mapping for this atom, leave it alone
+			return;
+		}
+	}
+	slots[slot] = make_pair(atom, st);
+	count++;
+}
+void AtomMap::erase(Atom atom) {
+	if (count == 0) {
+		return;
+	}
+	unsigned int mask = slots.size() - 1;
+	unsigned int slot;
+	for (slot = (atom * ATOM_MAP_HASH_MULTIPLIER) & mask; slots[slot].second != NULL && slots[slot].first != atom; slot = (slot + 1) & mask);
+	if (slots[slot].second == NULL) { // if there's no mapping for this atom, there's nothing to do
+		return;
+	}
+	// empty the slot, then shift back any later entries of the probe run that can no longer reach their own slots
+	slots[slot].second = NULL;
+	count--;
+	for (unsigned int next = (slot + 1) & mask; slots[next].second != NULL; next = (next + 1) & mask) {
+		unsigned int home = (slots[next].first * ATOM_MAP_HASH_MULTIPLIER) & mask;
+		if (((next - home) & mask) >= ((next - slot) & mask)) { // if the entry's home slot is at or before the hole, move it into the hole
+			slots[slot] = slots[next];
+			slots[next].second = NULL;
+			slot = next;
+		}
+	}
+}
+unsigned int AtomMap::size() const {
+	return count;
+}
+
+// BindingCache functions
+BindingCacheEntry::BindingCacheEntry() : env(NULL), path(0), generation(0), binding((SymbolTree *)NULL, false) {}
+BindingCacheEntry::~BindingCacheEntry() {}
+BindingCache::BindingCache() : entries(BINDING_CACHE_SIZE), generation(1), dirty(false), hits(0), misses(0), invalidations(0) {}
+BindingCache::~BindingCache() {}
+// returns the slot for the given key
+inline unsigned int bindingCacheSlot(SymbolTree *env, Atom path) {
+	return (((unsigned int)((uintptr_t)env >> 4) ^ (path * ATOM_MAP_HASH_MULTIPLIER)) & (BINDING_CACHE_SIZE - 1));
+}
+bool BindingCache::find(SymbolTree *env, Atom path, pair<SymbolTree *, bool> &binding) {
+	const BindingCacheEntry &entry = entries[bindingCacheSlot(env, path)];
+	if (entry.generation == generation && entry.env == env && entry.path == path) {
+		binding = entry.binding;
+		hits++;
+		return true;
+	} else {
+		misses++;
+		return false;
+	}
+}
+void BindingCache::insert(SymbolTree *env, Atom path, const pair<SymbolTree *, bool> &binding) {
+	BindingCacheEntry &entry = entries[bindingCacheSlot(env, path)];
+	entry.env = env;
+	entry.path = path;
+	entry.generation = generation;
+	entry.binding = binding;
+	dirty = true;
+}
+void BindingCache::invalidate() {
+	if (dirty) { // if there's anything to discard, start a new generation
+		generation++;
+		invalidations++;
+		dirty = false;
+	}
+}
+
 // SymbolTree functions
-SymbolTree::SymbolTree(int kind, const string &id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), defSite(defSite), copyImportSite(copyImportSite), parent(NULL),
+SymbolTree::SymbolTree(int kind, const string &id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), atom(atomTable.intern(id)), defSite(defSite), copyImportSite(copyImportSite), parent(NULL),
 		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0) {
 	if (defSite != NULL) {
-		defSite->env = this;
+		defSite->env() = this;
 	}
 }
-SymbolTree::SymbolTree(int kind, const char *id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), defSite(defSite), copyImportSite(copyImportSite), parent(NULL), 
+SymbolTree::SymbolTree(int kind, const char *id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), atom(atomTable.intern(id)), defSite(defSite), copyImportSite(copyImportSite), parent(NULL), 
 		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0) {
 	if (defSite != NULL) {
-		defSite->env = this;
+		defSite->env() = this;
 	}
 }
-SymbolTree::SymbolTree(int kind, const string &id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), copyImportSite(copyImportSite), parent(NULL),
+SymbolTree::SymbolTree(int kind, const string &id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), atom(atomTable.intern(id)), copyImportSite(copyImportSite), parent(NULL),
 		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0){
-	TypeStatus status(defType, NULL); defSite = new Tree(status); defSite->env = this;
+	TypeStatus status(defType, NULL); defSite = new (curSemmerTreeArena()) Tree(curSemmerTreeArena(), status); defSite->env() = this;
 }
-SymbolTree::SymbolTree(int kind, const char *id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), copyImportSite(copyImportSite), parent(NULL),
+SymbolTree::SymbolTree(int kind, const char *id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), atom(atomTable.intern(id)), copyImportSite(copyImportSite), parent(NULL),
 		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0){
-	TypeStatus status(defType, NULL); defSite = new Tree(status); defSite->env = this;
+	TypeStatus status(defType, NULL); defSite = new (curSemmerTreeArena()) Tree(curSemmerTreeArena(), status); defSite->env() = this;
 }
-SymbolTree::SymbolTree(const SymbolTree &st, SymbolTree *parent, SymbolTree *copyImportSite) : kind(st.kind), id(st.id), defSite(st.defSite), copyImportSite(copyImportSite), parent(parent), children(st.children),
+SymbolTree::SymbolTree(const SymbolTree &st, SymbolTree *parent, SymbolTree *copyImportSite) : kind(st.kind), id(st.id), atom(st.atom), defSite(st.defSite), copyImportSite(copyImportSite), parent(parent), children(st.children),
 	offsetKindInternal(st.offsetKindInternal), offsetIndexInternal(st.offsetIndexInternal), numRaws(st.numRaws), numBlocks(st.numBlocks), numPartitions(st.numPartitions) {}
 SymbolTree::~SymbolTree() {}
 unsigned int SymbolTree::addRaw() {return (numRaws++);}
@@ -62,8 +251,8 @@ unsigned int SymbolTree::addBlock() {return (numBlocks++);}
 unsigned int SymbolTree::addPartition() {return (numPartitions++);}
 unsigned int SymbolTree::addShare() {return (numShares++);}
 void SymbolTree::getOffset() {
-	if (kind != KIND_STD && parent != NULL && defSite->status.type != NULL) { // if this is a node for which we can derive the offset from the corresponding Type, do so
-		offsetKindInternal = defSite->status.type->offsetKind();
+	if (kind != KIND_STD && parent != NULL && defSite->status().type != NULL) { // if this is a node for which we can derive the offset from the corresponding Type, do so
+		offsetKindInternal = defSite->status().type->offsetKind();
 		switch (offsetKindInternal) {
 			case OFFSET_RAW:
 				offsetIndexInternal = parent->addRaw();
@@ -98,18 +287,20 @@ unsigned int SymbolTree::offsetIndex() {
 	return offsetIndexInternal;
 }
 Tree *SymbolTree::offsetExp() const {
-	return (defSite->status.type->offsetExp);
+	return (defSite->status().type->offsetExp);
 }
 SymbolTree &SymbolTree::operator=(const SymbolTree &st) {
+	bindingCache.invalidate();
 	kind = st.kind;
 	defSite = st.defSite;
 	copyImportSite = st.copyImportSite;
 	if (id != st.id) { // if the id is changing
 		if (parent != NULL) { // ... and there exists a parent, fix up the parent's children map to use the new id
-			parent->children.erase(id);
-			parent->children.insert(make_pair(st.id, this));
+			parent->children.erase(atom);
+			parent->children.insert(st.atom, this);
 		}
 		id = st.id; // either way, update the id
+		atom = st.atom;
 	}
 	children = st.children;
 	return *this;
@@ -118,34 +309,33 @@ SymbolTree &SymbolTree::operator*=(SymbolTree *st) {
 	// first, check for conflicting bindings
 	if (st->kind == KIND_STD || st->kind == KIND_DECLARATION || st->kind == KIND_PARAMETER) { // if this is a conflictable (non-special system-level binding)
 		// per-symbol loop
-		map<string, SymbolTree *>::const_iterator conflictFind = children.find(st->id);
-		if (conflictFind != children.end()) { // if we've found a conflict
-			SymbolTree *conflictSt = (*conflictFind).second;
+		SymbolTree *conflictFind = children.find(st->atom);
+		if (conflictFind != NULL) { // if we've found a conflict
+			SymbolTree *conflictSt = conflictFind;
 			Token curDefToken;
 			if (st->defSite != NULL) { // if there is a definition site for the current symbol
-				curDefToken = st->defSite->t;
+				curDefToken = st->defSite->t();
 			} else { // otherwise, it must be a standard definition, so make up the token as if it was
 				curDefToken.fileIndex = STANDARD_LIBRARY_FILE_INDEX;
-				curDefToken.row = 0;
-				curDefToken.col = 0;
+				curDefToken.offset = NO_SOURCE_OFFSET;
 				exit(1);
 			}
 			Token prevDefToken;
 			if (conflictSt->defSite != NULL) { // if there is a definition site for the previous symbol
-				prevDefToken = conflictSt->defSite->t;
+				prevDefToken = conflictSt->defSite->t();
 			} else { // otherwise, it must be a standard definition, so make up the token as if it was
 				prevDefToken.fileIndex = STANDARD_LIBRARY_FILE_INDEX;
-				prevDefToken.row = 0;
-				prevDefToken.col = 0;
+				prevDefToken.offset = NO_SOURCE_OFFSET;
 				exit(1);
 			}
-			semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"redefinition of '"<<st->id<<"'");
-			semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous definition was here)");
+			semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"redefinition of '"<<st->id<<"'");
+			semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous definition was here)");
 			delete st;
 			return *this;
 		}
 	}	// binding is now known to be conflict-free, so log it normally
-	children.insert(make_pair(st->id, st));
+	children.insert(st->atom, st);
+	bindingCache.invalidate();
 	if (st != NULL) {
 		st->parent = this;
 		return *st;
@@ -184,7 +374,7 @@ string SymbolTree::toString(unsigned int tabDepth) {
 		}
 		COLOR( acc += SET_TERM(RESET_CODE); )
 		if (kind != KIND_OBJECT) {
-			Type *defType = defSite->status.type;
+			Type *defType = defSite->status().type;
 			if (defType != NULL) {
 				acc += " : ";
 				acc += defType->toString();
@@ -236,14 +426,45 @@ string SymbolTree::toString(unsigned int tabDepth) {
 		COLOR( acc += SET_TERM(RESET_CODE); )
 	}
 	acc += '\n';
-	for (map<string, SymbolTree *>::iterator childIter = children.begin(); childIter != children.end(); childIter++) {
-		SymbolTree *childCur = (*childIter).second;
+	vector<SymbolTree *> childList = sortedChildren();
+	for (vector<SymbolTree *>::const_iterator childIter = childList.begin(); childIter != childList.end(); childIter++) {
+		SymbolTree *childCur = *childIter;
 		if (childCur != NULL) {
 			acc += childCur->toString(tabDepth+1);
 		}
 	}
 	return acc;
 }
+// orders (identifier, node) pairs by the lexical order of the identifiers
+bool childOrder(const pair<const string *, SymbolTree *> &a, const pair<const string *, SymbolTree *> &b) {
+	return (*(a.first) < *(b.first));
+}
+// returns this node's children, in the lexical order of their identifiers
+vector<SymbolTree *> SymbolTree::sortedChildren() const {
+	vector<SymbolTree *> retVal;
+	retVal.reserve(children.size());
+	if (children.size() <= 1) { // if there's nothing to sort, just collect the children
+		for (vector<pair<Atom, SymbolTree *> >::const_iterator slotIter = children.slots.begin(); slotIter != children.slots.end(); slotIter++) {
+			if ((*slotIter).second != NULL) {
+				retVal.push_back((*slotIter).second);
+			}
+		}
+		return retVal;
+	}
+	// otherwise, pair up the children with their identifiers and sort them
+	vector<pair<const string *, SymbolTree *> > childPairs;
+	childPairs.reserve(children.size());
+	for (vector<pair<Atom, SymbolTree *> >::const_iterator slotIter = children.slots.begin(); slotIter != children.slots.end(); slotIter++) {
+		if ((*slotIter).second != NULL) {
+			childPairs.push_back(make_pair(&(atomTable[(*slotIter).first]), (*slotIter).second));
+		}
+	}
+	sort(childPairs.begin(), childPairs.end(), childOrder);
+	for (vector<pair<const string *, SymbolTree *> >::const_iterator childIter = childPairs.begin(); childIter != childPairs.end(); childIter++) {
+		retVal.push_back((*childIter).second);
+	}
+	return retVal;
+}
 SymbolTree::operator string() {
 	return toString(1);
 }
@@ -387,158 +608,152 @@ SymbolTree *genDefaultDefs() {
 	return stRoot;
 }
 
-// recursively extracts the appropriate nodes from the given tree and appropriately populates the passed containers
-void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
-	// base case
-	if (tree == NULL) {
-		return;
-	}
-	// log the current symbol environment in the tree (this pointer will potentially be overridden by a SymbolTree() constructor)
-	tree->env = st;
-	// recursive cases
-	if (*tree == TOKEN_Declaration) { // if it's a Declaration-style node
-		Token defToken = tree->child->t; // ID, AT, or DAT
-		if (defToken.tokenType != TOKEN_ID || (defToken.s != "null" && defToken.s != "true" && defToken.s != "false")) { // if this isn't a standard literal override, proceed normally
-			Tree *dcn = tree->child->next;
-			if (*dcn == TOKEN_EQUALS) { // standard static declaration
-				// allocate the new declaration node
-				SymbolTree *newDef = new SymbolTree(KIND_DECLARATION, tree->child->t.s, tree);
-				// ... and link it in
-				*st *= newDef;
-				// recurse
-				buildSt(tree->child, newDef, importList); // child of Declaration
-				buildSt(tree->next, st, importList); // right
-			} else if (*(tree->child) == TOKEN_AT) { // import-style declaration
-				// allocate the new definition node
-				Tree *importId = (*(tree->child->next) == TOKEN_ImportIdentifier) ? tree->child->next : tree->child->next->next; // ImportIdentifier
-				SymbolTree *newDef = new SymbolTree((*(importId->child) != TOKEN_OpenIdentifier) ? KIND_CLOSED_IMPORT : KIND_OPEN_IMPORT, IMPORT_DECL_STRING, tree);
-				// ... and link it in
-				*st *= newDef;
-				// also, since it's an import declaration, log it to the import list
-				importList.push_back(newDef);
-				// recurse
-				buildSt(tree->child, newDef, importList); // child of Declaration
-				buildSt(tree->next, st, importList); // right
-			}
-		} else { // else if this is a standard literal override, flag an error
-			semmerError(defToken.fileIndex,defToken.row,defToken.col,"redefinition of standard literal '"<<defToken.s<<"'");
-		}
-	} else if (*tree == TOKEN_Block || *tree == TOKEN_Object) { // if it's a block-style node
-		// allocate the new block definition node
-		// generate an identifier for the node
-		int kind;
-		string fakeId;
-		if (*tree == TOKEN_Block) { // if it's a block node, use a regular identifier
-			kind = KIND_BLOCK;
-			fakeId = BLOCK_NODE_STRING;
-		} else { // else if it's an object node, generate a fake identifier from a hash of the Tree node
-			kind = KIND_OBJECT;
-			fakeId = OBJECT_NODE_STRING;
-			fakeId += (uintptr_t)tree;
-		}
-		SymbolTree *blockDef = new SymbolTree(kind, fakeId, tree);
-		// latch the new node into the SymbolTree trunk
-		*st *= blockDef;
-		// recurse
-		buildSt(tree->child, blockDef, importList); // child of Block or Object
-		buildSt(tree->next, st, importList); // right
-	} else if (*tree == TOKEN_Filter || *tree == TOKEN_ExplicitFilter) { // if it's a filter-style node
-		// allocate the new filter definition node
-		// generate a fake identifier for the filter node from a hash of the Tree node
-		string fakeId(FILTER_NODE_STRING);
-		fakeId += (uintptr_t)tree;
-		SymbolTree *filterDef = new SymbolTree(KIND_FILTER, fakeId, tree);
-		// parse out the header's parameter declarations and add them to the st
-		Tree *pl = (*(tree->child) == TOKEN_FilterHeader) ? tree->child->child->next : NULL; // RSQUARE, ParamList, RetList, or NULL
-		if (pl != NULL && *pl == TOKEN_ParamList) { // if there is a parameter list to process
-			for (Tree *param = pl->child; param != NULL; param = (param->next != NULL) ? param->next->next->child : NULL) { // per-param loop
-				// allocate the new parameter definition node
-				SymbolTree *paramDef = new SymbolTree(KIND_PARAMETER, param->child->next->t.s, param);
-				// ... and link it into the filter definition node
-				*filterDef *= paramDef;
-			}
-		} // if there is a parameter list to process
-		// latch the new node into the SymbolTree trunk
-		*st *= filterDef;
-		// recurse
-		buildSt(tree->child, filterDef, importList); // child of Filter
-		buildSt(tree->next, st, importList); // right
-	} else if (*tree == TOKEN_Instructor || *tree == TOKEN_LastInstructor) { // if it's an instructor-style node
-		// allocate the new instructor definition node
-		// generate a fake identifier for the instructor node from a hash of the Tree node
-		string fakeId(INSTRUCTOR_NODE_STRING);
-		fakeId += (uintptr_t)tree;
-		SymbolTree *consDef = new SymbolTree(KIND_INSTRUCTOR, fakeId, tree);
-		// .. and link it in
-		*st *= consDef;
-		// link in the parameters of this instructor, if any
-		Tree *conscn = tree->child->next; // NULL, SEMICOLON, LSQUARE, or NonRetFilterHeader
-		if (conscn != NULL && *conscn == TOKEN_NonRetFilterHeader && *(conscn->child->next) == TOKEN_ParamList) { // if there is actually a parameter list on this instructor
-			Tree *pl = conscn->child->next; // ParamList
-			for (Tree *param = pl->child; param != NULL; param = (param->next != NULL) ? param->next->next->child : NULL) { // per-param loop
-				// allocate the new parameter definition node
-				SymbolTree *paramDef = new SymbolTree(KIND_PARAMETER, param->child->next->t.s, param);
-				// ... and link it into the instructor definition node
-				*consDef *= paramDef;
-			}
-		}
-		// recurse
-		buildSt(tree->child, consDef, importList); // child of Instructor
-		buildSt(tree->next, st, importList); // right
-	} else if (*tree == TOKEN_Outstructor) { // if it's an outstructor-style node
-		// allocate the new outstructor definition node
-		// generate a fake identifier for the outstructor node from a hash of the Tree node
-		string fakeId(OUTSTRUCTOR_NODE_STRING);
-		fakeId += (uintptr_t)tree;
-		SymbolTree *consDef = new SymbolTree(KIND_OUTSTRUCTOR, fakeId, tree);
-		// .. and link it in
-		*st *= consDef;
-		// recurse
-		buildSt(tree->child, consDef, importList); // child of Outstructor
-		buildSt(tree->next, st, importList); // right
-	} else if (*tree == TOKEN_Instantiation && st->kind != KIND_DECLARATION) { // if it's a non-bound (inlined) instantiation-style node
-		string fakeId(INSTANTIATION_NODE_STRING);
-		fakeId += (uintptr_t)tree;
-		// allocate the new instantiation node
-		SymbolTree *newDef = new SymbolTree(KIND_INSTANTIATION, fakeId, tree);
-		// ... and link it in
-		*st *= newDef;
-		// recurse
-		buildSt(tree->child, newDef, importList); // child of Instantiation
-		buildSt(tree->next, st, importList); // right
-	} else { // else if it's any other kind of node
-		// recurse normally
-		buildSt(tree->child, st, importList); // down
-		buildSt(tree->next, st, importList); // right
-	}
-}
-
-// chops up the passed in string into its period-delimited components
-vector<string> chopId(const string &s) {
-	vector<string> retVal;
-	string acc;
-	for (unsigned int i=0; i < s.size(); i++) {
-		if (s[i] != '.') { // if this character isn't a period
-			acc += s[i];
-		} else if (s[i+1] == '.') { // else if this character is a period and the next one is as well (can only occur at the beginning of an identifier)
-			i++;
-			acc += "..";
-		} else {
-			retVal.push_back(acc);
-			acc.clear();
-		}
-	}
-	if (acc.size() > 0) { // commit the last token if necessary
-		retVal.push_back(acc);
-	}
-	return retVal;
+// generates a unique fake identifier suffix from the address of the given Tree node
+string fakeIdSuffix(const Tree *tree) {
+	char suffixString[MAX_INT_STRING_LENGTH];
+	sprintf(suffixString, "%lx", (unsigned long)tree);
+	return string(suffixString);
+}
+
+// extracts the appropriate nodes from the given tree and appropriately populates the passed containers
+// walks the tree with an explicit work stack rather than recursing, so that arbitrarily long pipe chains can't overflow the call stack
+void buildSt(Tree *treeRoot, SymbolTree *stRoot, vector<SymbolTree *> &importList) {
+	vector<pair<Tree *, SymbolTree *> > workStack; // (Tree node, symbol environment) pairs left to visit
+	workStack.push_back(make_pair(treeRoot, stRoot));
+	while (!workStack.empty()) {
+		Tree *tree = workStack.back().first;
+		SymbolTree *st = workStack.back().second;
+		workStack.pop_back();
+		// skip over empty links
+		if (tree == NULL) {
+			continue;
+		}
+		// log the current symbol environment in the tree (this pointer will potentially be overridden by a SymbolTree() constructor)
+		tree->env() = st;
+		// expansion cases
+		if (*tree == TOKEN_Declaration) { // if it's a Declaration-style node
+			Token defToken = tree->child->t(); // ID, AT, or DAT
+			if (defToken.tokenType != TOKEN_ID || (defToken.s() != "null" && defToken.s() != "true" && defToken.s() != "false")) { // if this isn't a standard literal override, proceed normally
+				Tree *dcn = tree->child->next;
+				if (*dcn == TOKEN_EQUALS) { // standard static declaration
+					// allocate the new declaration node
+					SymbolTree *newDef = new SymbolTree(KIND_DECLARATION, tree->child->t().s(), tree);
+					// ... and link it in
+					*st *= newDef;
+					// expand
+					workStack.push_back(make_pair(tree->next, st)); // right
+					workStack.push_back(make_pair(tree->child, newDef)); // child of Declaration
+				} else if (*(tree->child) == TOKEN_AT) { // import-style declaration
+					// allocate the new definition node
+					Tree *importId = (*(tree->child->next) == TOKEN_ImportIdentifier) ? tree->child->next : tree->child->next->next; // ImportIdentifier
+					SymbolTree *newDef = new SymbolTree((*(importId->child) != TOKEN_OpenIdentifier) ? KIND_CLOSED_IMPORT : KIND_OPEN_IMPORT, IMPORT_DECL_STRING, tree);
+					// ... and link it in
+					*st *= newDef;
+					// also, since it's an import declaration, log it to the import list
+					importList.push_back(newDef);
+					// expand
+					workStack.push_back(make_pair(tree->next, st)); // right
+					workStack.push_back(make_pair(tree->child, newDef)); // child of Declaration
+				}
+			} else { // else if this is a standard literal override, flag an error
+				semmerError(defToken.fileIndex,defToken.row(),defToken.col(),"redefinition of standard literal '"<<defToken.s()<<"'");
+			}
+		} else if (*tree == TOKEN_Block || *tree == TOKEN_Object) { // if it's a block-style node
+			// allocate the new block definition node
+			// generate an identifier for the node
+			int kind;
+			string fakeId;
+			if (*tree == TOKEN_Block) { // if it's a block node, use a regular identifier
+				kind = KIND_BLOCK;
+				fakeId = BLOCK_NODE_STRING;
+			} else { // else if it's an object node, generate a fake identifier from a hash of the Tree node
+				kind = KIND_OBJECT;
+				fakeId = OBJECT_NODE_STRING;
+				fakeId += fakeIdSuffix(tree);
+			}
+			SymbolTree *blockDef = new SymbolTree(kind, fakeId, tree);
+			// latch the new node into the SymbolTree trunk
+			*st *= blockDef;
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, blockDef)); // child of Block or Object
+		} else if (*tree == TOKEN_Filter || *tree == TOKEN_ExplicitFilter) { // if it's a filter-style node
+			// allocate the new filter definition node
+			// generate a fake identifier for the filter node from a hash of the Tree node
+			string fakeId(FILTER_NODE_STRING);
+			fakeId += fakeIdSuffix(tree);
+			SymbolTree *filterDef = new SymbolTree(KIND_FILTER, fakeId, tree);
+			// parse out the header's parameter declarations and add them to the st
+			Tree *pl = (*(tree->child) == TOKEN_FilterHeader) ? tree->child->child->next : NULL; // RSQUARE, ParamList, RetList, or NULL
+			if (pl != NULL && *pl == TOKEN_ParamList) { // if there is a parameter list to process
+				for (Tree *param = pl->child; param != NULL; param = (param->next != NULL) ? param->next->next->child : NULL) { // per-param loop
+					// allocate the new parameter definition node
+					SymbolTree *paramDef = new SymbolTree(KIND_PARAMETER, param->child->next->t().s(), param);
+					// ... and link it into the filter definition node
+					*filterDef *= paramDef;
+				}
+			} // if there is a parameter list to process
+			// latch the new node into the SymbolTree trunk
+			*st *= filterDef;
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, filterDef)); // child of Filter
+		} else if (*tree == TOKEN_Instructor || *tree == TOKEN_LastInstructor) { // if it's an instructor-style node
+			// allocate the new instructor definition node
+			// generate a fake identifier for the instructor node from a hash of the Tree node
+			string fakeId(INSTRUCTOR_NODE_STRING);
+			fakeId += fakeIdSuffix(tree);
+			SymbolTree *consDef = new SymbolTree(KIND_INSTRUCTOR, fakeId, tree);
+			// .. and link it in
+			*st *= consDef;
+			// link in the parameters of this instructor, if any
+			Tree *conscn = tree->child->next; // NULL, SEMICOLON, LSQUARE, or NonRetFilterHeader
+			if (conscn != NULL && *conscn == TOKEN_NonRetFilterHeader && *(conscn->child->next) == TOKEN_ParamList) { // if there is actually a parameter list on this instructor
+				Tree *pl = conscn->child->next; // ParamList
+				for (Tree *param = pl->child; param != NULL; param = (param->next != NULL) ? param->next->next->child : NULL) { // per-param loop
+					// allocate the new parameter definition node
+					SymbolTree *paramDef = new SymbolTree(KIND_PARAMETER, param->child->next->t().s(), param);
+					// ... and link it into the instructor definition node
+					*consDef *= paramDef;
+				}
+			}
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, consDef)); // child of Instructor
+		} else if (*tree == TOKEN_Outstructor) { // if it's an outstructor-style node
+			// allocate the new outstructor definition node
+			// generate a fake identifier for the outstructor node from a hash of the Tree node
+			string fakeId(OUTSTRUCTOR_NODE_STRING);
+			fakeId += fakeIdSuffix(tree);
+			SymbolTree *consDef = new SymbolTree(KIND_OUTSTRUCTOR, fakeId, tree);
+			// .. and link it in
+			*st *= consDef;
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, consDef)); // child of Outstructor
+		} else if (*tree == TOKEN_Instantiation && st->kind != KIND_DECLARATION) { // if it's a non-bound (inlined) instantiation-style node
+			string fakeId(INSTANTIATION_NODE_STRING);
+			fakeId += fakeIdSuffix(tree);
+			// allocate the new instantiation node
+			SymbolTree *newDef = new SymbolTree(KIND_INSTANTIATION, fakeId, tree);
+			// ... and link it in
+			*st *= newDef;
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, newDef)); // child of Instantiation
+		} else { // else if it's any other kind of node
+			// expand
+			workStack.push_back(make_pair(tree->next, st)); // right
+			workStack.push_back(make_pair(tree->child, st)); // down
+		}
+	} // per-node loop
 }
 
 // rebuilds a string representation of this identifier from a chopped list and a depth
-string rebuildId(const vector<string> &choppedList, unsigned int depth) {
+string rebuildId(const vector<Atom> &choppedList, unsigned int depth) {
 	string acc;
 	for (unsigned int i=0; i <= depth; i++) {
-		acc += choppedList[i];
+		acc += atomTable[choppedList[i]];
 		if (i != depth) {
 			acc += '.';
 		}
@@ -546,25 +761,98 @@ string rebuildId(const vector<string> &choppedList, unsigned int depth) {
 	return acc;
 }
 
+// reports errors
+// returns the interned components of the given NonArrayedIdentifier, ArrayedIdentifier, or OpenIdentifier, taken straight from its tokens
+// this also checks the identifier's subscripts, so callers should chop each identifier only once and hold onto the result
+AtomPath getAtomPath(Tree *tree) {
+	AtomPath atoms;
+	Token headToken = tree->child->t(); // ID or DPERIOD
+	atoms.components.push_back(atomTable.intern(headToken.str, headToken.len));
+	// invariant: cur is a non-NULL child of NonArrayedIdentifierSuffix, ArrayedIdentifierSuffix, or IdentifierSuffix
+	for(const Tree *cur = tree->child->next->child; cur != NULL; cur = (cur->next->next != NULL) ? cur->next->next->child : NULL) {
+		const Tree *curn = cur->next; // ID, ArrayAccess, or TIMES
+		if (*curn == TOKEN_ID) {
+			Token curToken = curn->t();
+			atoms.components.push_back(atomTable.intern(curToken.str, curToken.len));
+		} else if (*curn == TOKEN_ArrayAccess) {
+			checkArrayAccess(curn);
+			atoms.components.push_back((curn->child->next->next->next == NULL) ? ATOM_SUBSCRIPT : ATOM_RANGE);
+		}
+	}
+	atoms.path = (atoms.components.size() == 1) ? atoms.components[0] : atomTable.intern(rebuildId(atoms.components, atoms.components.size()-1));
+	return atoms;
+}
+
+// returns the node at which an identifier beginning with the given atom latches when bound from env, or NULL if there is no such node
+SymbolTree *findLatchPoint(Atom head, SymbolTree *env) {
+	for (SymbolTree *stCur = env; stCur != NULL; stCur = stCur->parent) {
+		if ((stCur->kind == KIND_STD ||
+				stCur->kind == KIND_DECLARATION ||
+				stCur->kind == KIND_PARAMETER) &&
+				stCur->atom == head) { // if this is a valid latch point, return it
+			return stCur;
+		} else if (stCur->kind == KIND_BLOCK ||
+				stCur->kind == KIND_OBJECT ||
+				stCur->kind == KIND_INSTRUCTOR ||
+				stCur->kind == KIND_FILTER) { // else if this is a valid basis block, scan its children for a latch point
+			SymbolTree *latchFind = stCur->children.find(head);
+			if (latchFind != NULL) { // if we've found a latch point in the children
+				return latchFind;
+			}
+		}
+	}
+	return NULL;
+}
+
+// returns the fake node with the given atom under the given parent, or NULL if there isn't one yet
+SymbolTree *findFake(SymbolTree *parent, Atom atom) {
+	SymbolTree *fakeFind = parent->children.find(atom);
+	if (fakeFind == NULL && semWorker != NULL) { // if we're analyzing in parallel, the node might be one that this thread is still holding
+		map<pair<SymbolTree *, Atom>, SymbolTree *>::const_iterator workerFind = semWorker->fakes.find(make_pair(parent, atom));
+		if (workerFind != semWorker->fakes.end()) {
+			fakeFind = workerFind->second;
+		}
+	}
+	return fakeFind;
+}
+
+// latches the given fake node in under the given parent
+void latchFake(SymbolTree *parent, SymbolTree *fake) {
+	if (semWorker != NULL) { // if we're analyzing in parallel, other threads may be reading the parent's children, so hold onto the node until they're done
+		fake->parent = parent;
+		semWorker->fakes.insert(make_pair(make_pair(parent, fake->atom), fake));
+	} else { // else if we're the only thread, latch it in directly
+		*parent *= fake;
+	}
+}
+
 // reports errors
 // second component is whether we passed through constantication for this binding
-pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStatus &inStatus = TypeStatus()) {
-	vector<string> id = chopId(s); // chop up the input identifier into its components
+pair<SymbolTree *, bool> bindId(const AtomPath &atoms, SymbolTree *env, const TypeStatus &inStatus = TypeStatus()) {
+	const vector<Atom> &id = atoms.components;
+	// check if we've already bound this identifier in this scope; recalls depend on the incoming status, and failures must report their errors, so neither are cached
+	bool cacheable = (id[0] != ATOM_RECALL);
+	Atom path = atoms.path; // the atom of the whole identifier
+	BindingCache &cache = curBindingCache();
+	pair<SymbolTree *, bool> cachedBinding;
+	if (cacheable && cache.find(env, path, cachedBinding)) {
+		return cachedBinding;
+	}
 	SymbolTree *stRoot = NULL; // the latch point of the binding
-	if (id[0] == "..") { // if the identifier begins with a recall
+	if (id[0] == ATOM_RECALL) { // if the identifier begins with a recall
 		Type *recallType = inStatus.type;
 		if (recallType) { // if there's a recall binding passed in, use a fake SymbolTree node for it
 			// generate a fake identifier for the recall binding node from a hash of the recall identifier's Type object
 			string fakeId(FAKE_RECALL_NODE_PREFIX);
 			fakeId += (unsigned int)inStatus;
 			// check if a SymbolTree node with this identifier already exists -- if so, use it
-			map<string, SymbolTree *>::const_iterator fakeFind = env->children.find(fakeId);
-			if (fakeFind != env->children.end()) { // if we found a match, use it
-				stRoot = (*fakeFind).second;
+			SymbolTree *fakeFind = findFake(env, atomTable.intern(fakeId));
+			if (fakeFind != NULL) { // if we found a match, use it
+				stRoot = fakeFind;
 			} else { // else if we didn't find a match, create a new fake latch point to use
 				SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, fakeId);
 				// attach the new fake node to the main SymbolTree
-				*env *= fakeStNode;
+				latchFake(env, fakeStNode);
 				// accept the new fake node as the latch point
 				stRoot = fakeStNode;
 			}
@@ -572,24 +860,7 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 			return make_pair((SymbolTree *)NULL, false);
 		}
 	} else { // else if it's a regular identifier
-		for (SymbolTree *stCur = env; stCur != NULL; stCur = stCur->parent) { // scan for a latch point for the beginning of the identifier
-			if ((stCur->kind == KIND_STD ||
-					stCur->kind == KIND_DECLARATION ||
-					stCur->kind == KIND_PARAMETER) &&
-					stCur->id == id[0]) { // if this is a valid latch point, log it and break
-				stRoot = stCur;
-				break;
-			} else if (stCur->kind == KIND_BLOCK ||
-					stCur->kind == KIND_OBJECT ||
-					stCur->kind == KIND_INSTRUCTOR ||
-					stCur->kind == KIND_FILTER) { // else if this is a valid basis block, scan its children for a latch point
-				map<string, SymbolTree *>::const_iterator latchFind = stCur->children.find(id[0]);
-				if (latchFind != stCur->children.end()) { // if we've found a latch point in the children
-					stRoot = (*latchFind).second;
-					break;
-				}
-			}
-		}
+		stRoot = findLatchPoint(id[0], env); // scan for a latch point for the beginning of the identifier
 	}
 	if (stRoot != NULL) { // if we managed to find a latch point, verify the rest of the binding
 		bool needsConstantization = false; // whether this identifier needs to be constantized due to going though a constant reference in the chain
@@ -598,13 +869,13 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 			bool success = false;
 			Type *stCurType = errType;
 			if (stCur->kind == KIND_STD) { // if it's a standard system-level binding, look in the list of children for a match to this sub-identifier
-				map<string, SymbolTree *>::const_iterator childFind = stCur->children.find(id[i]);
-				if (childFind != stCur->children.end()) { // if there's a match to this sub-identifier, proceed
-					if (*(stCur->defSite->status.type) == STD_STD) { // if it's the root std node, just log the child as stCur and continue in the derivation
-						stCur = (*childFind).second;
+				SymbolTree *childFind = stCur->children.find(id[i]);
+				if (childFind != NULL) { // if there's a match to this sub-identifier, proceed
+					if (*(stCur->defSite->status().type) == STD_STD) { // if it's the root std node, just log the child as stCur and continue in the derivation
+						stCur = childFind;
 						success = true;
 					} else { // else if it's not the root std node, use the subidentifier's type for derivation, as usual
-						stCurType = (*childFind).second->defSite->status.type;
+						stCurType = childFind->defSite->status().type;
 					}
 				}
 			} else if (stCur->kind == KIND_DECLARATION) { // else if it's a Declaration binding, carefully get its type
@@ -615,43 +886,43 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 			} else if (stCur->kind == KIND_PARAMETER) { // else if it's a Param binding, naively get its type
 				stCurType = getStatusType(stCur->defSite->child); // Type
 			} else if (stCur->kind == KIND_FAKE) { // else if it's a faked SymbolTree node, get its type from the fake Tree node we created for it
-				stCurType = stCur->defSite->status.type;
+				stCurType = stCur->defSite->status().type;
 			}
 			if (*stCurType) { // if we managed to derive a type for this SymbolTree node
 				// handle some special cases based on the suffix of the type we just derived
 				if (stCurType->suffix == SUFFIX_LIST || stCurType->suffix == SUFFIX_STREAM) { // else if it's a list or a stream, flag an error, since we can't traverse down those
-					Token curToken = stCur->defSite->t;
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"member access on unmembered identifier '"<<rebuildId(id, i)<<"'");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (identifier type is "<<stCurType<<")");
+					Token curToken = stCur->defSite->t();
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"member access on unmembered identifier '"<<rebuildId(id, i)<<"'");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (identifier type is "<<stCurType<<")");
 					stCurType = errType;
 				} else if (stCurType->suffix == SUFFIX_ARRAY || stCurType->suffix == SUFFIX_POOL) { // else if it's an array or pool, ensure that we're accessing it using a subscript
-					if (id[i] == "[]" || id[i] == "[:]") { // if we're accessing it via a subscript, accept it and proceed deeper into the binding
+					if (id[i] == ATOM_SUBSCRIPT || id[i] == ATOM_RANGE) { // if we're accessing it via a subscript, accept it and proceed deeper into the binding
 						// if it's an array type, flag the fact that it must be constantized
 						if (stCurType->suffix == SUFFIX_ARRAY) {
 							needsConstantization = true;
 						}
 						// we're about to fake a SymbolTree node for this subscript access
 						// but first, check if a SymbolTree node has already been faked for this member
-						map<string, SymbolTree *>::const_iterator fakeFind = stCur->children.find(id[i]);
-						if (fakeFind != stCur->children.end()) { // if we've already faked a SymbolTree node for this member, accept it and proceed deeper into the binding
-							stCur = (*fakeFind).second;
+						SymbolTree *fakeFind = findFake(stCur, id[i]);
+						if (fakeFind != NULL) { // if we've already faked a SymbolTree node for this member, accept it and proceed deeper into the binding
+							stCur = fakeFind;
 						} else { // else if we haven't yet faked a SymbolTree node for this member, do so now
 							Type *mutableStCurType = stCurType;
-							if (id[i] == "[]") { // if it's an expression access (as opposed to a range access), decrease the type's depth
+							if (id[i] == ATOM_SUBSCRIPT) { // if it's an expression access (as opposed to a range access), decrease the type's depth
 								mutableStCurType = mutableStCurType->copy(); // make a mutable copy of the type
 								mutableStCurType->decreaseDepth();
 							}
-							SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, id[i], mutableStCurType);
+							SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, atomTable[id[i]], mutableStCurType);
 							// attach the new fake node to the main SymbolTree
-							*stCur *= fakeStNode;
+							latchFake(stCur, fakeStNode);
 							// accept the new fake node and proceed deeper into the binding
 							stCur = fakeStNode;
 						}
 						success = true; // all of the above branches lead to success
 					} else {
-						Token curToken = stCur->defSite->t;
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"non-subscript access on identifier '"<<rebuildId(id, i)<<"'");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (identifier type is "<<stCurType<<")");
+						Token curToken = stCur->defSite->t();
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"non-subscript access on identifier '"<<rebuildId(id, i)<<"'");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (identifier type is "<<stCurType<<")");
 						stCurType = errType;
 					}
 				} else if (stCurType->category == CATEGORY_OBJECTTYPE) { // else if it's an Object constant or latch (the only other category that can have sub-identifiers)
@@ -661,20 +932,20 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 					}
 					// proceed with binding the sub-identifier as normal by trying to find a match in the Object's members
 					ObjectType *stCurTypeCast = ((ObjectType *)stCurType);
-					MemberList::iterator findIter = stCurTypeCast->memberList.find(id[i]);
+					MemberList::iterator findIter = stCurTypeCast->memberList.find(atomTable[id[i]]);
 					if (findIter != stCurTypeCast->memberList.end()) { // if we managed to find a matching sub-identifier
 						if ((*findIter).defSite() != NULL) { // if the member has a real definition site, accept it and proceed deeper into the binding
-							stCur = (*findIter).defSite()->env;
+							stCur = (*findIter).defSite()->env();
 						} else { // else if the member has no real definition site, we'll need to fake a SymbolTree node for it
 							// but first, check if a SymbolTree node has already been faked for this member
-							map<string, SymbolTree *>::const_iterator fakeFindIter = stCur->children.find(id[i]);
-							if (fakeFindIter != stCur->children.end()) { // if we've already faked a SymbolTree node for this member, accept it and proceed deeper into the binding
-								stCur = (*fakeFindIter).second;
-								stCur = (*fakeFindIter).second;
+							SymbolTree *fakeFindIter = findFake(stCur, id[i]);
+							if (fakeFindIter != NULL) { // if we've already faked a SymbolTree node for this member, accept it and proceed deeper into the binding
+								stCur = fakeFindIter;
+								stCur = fakeFindIter;
 							} else { // else if we haven't yet faked a SymbolTree node for this member, do so now
-								SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, id[i], (*findIter));
+								SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, atomTable[id[i]], (*findIter));
 								// attach the new fake node to the main SymbolTree
-								*stCur *= fakeStNode;
+								latchFake(stCur, fakeStNode);
 								// accept the new fake node and proceed deeper into the binding
 								stCur = fakeStNode;
 							}
@@ -687,24 +958,53 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 				return make_pair((SymbolTree *)NULL, false);
 			} // else if we managed to find a binding for this sub-identifier, continue onto trying to bind the next one
 		}
-		// if we managed to bind all of the sub-identifiers, return the tail of the binding as well as whether we need to post-constantize it
+		// if we managed to bind all of the sub-identifiers, cache and return the tail of the binding as well as whether we need to post-constantize it
+		if (cacheable) {
+			cache.insert(env, path, make_pair(stCur, needsConstantization));
+		}
 		return make_pair(stCur, needsConstantization);
 	} else { // else if we failed to find an initial latch point, return failure
 		return make_pair((SymbolTree *)NULL, false);
 	}
 }
 
+// moves the given blocked imports back into the worklist; those after the current import are retried in this round, and the rest in the next one
+void wakeImports(vector<unsigned int> &blockedList, unsigned int importIndex, set<unsigned int> &curRound, set<unsigned int> &nextRound) {
+	for (vector<unsigned int>::const_iterator blockedIter = blockedList.begin(); blockedIter != blockedList.end(); blockedIter++) {
+		if (*blockedIter > importIndex) {
+			curRound.insert(*blockedIter);
+		} else {
+			nextRound.insert(*blockedIter);
+		}
+	}
+	blockedList.clear();
+}
+
+// imports are processed in rounds in list order, but an import that fails to bind is only retried once something that could unblock it happens
 void subImportDecls(vector<SymbolTree *> importList) {
 	bool stdExplicitlyImported = false;
-	for(;;) { // per-change loop
-		// per-import loop
-		vector<SymbolTree *> redoList; // the list of imports that we couldn't handle this round and must redo in the next one
-		for (vector<SymbolTree *>::const_iterator importIter = importList.begin(); importIter != importList.end(); importIter++) {
+	set<unsigned int> curRound; // indices of the imports left to handle this round
+	set<unsigned int> nextRound; // indices of the imports to handle in the next round
+	map<Atom, vector<unsigned int> > nameBlockedLists; // imports whose heads failed to latch, keyed by those heads; these can't bind until something defines that name
+	vector<unsigned int> anyBlockedList; // imports that failed further along their paths; any successful import could unblock these
+	vector<AtomPath> importPaths(importList.size()); // the interned components of each import's path, chopped the first time that the import is handled
+	for (unsigned int i = 0; i < importList.size(); i++) {
+		curRound.insert(i);
+	}
+	while (!curRound.empty()) { // per-round loop
+		while (!curRound.empty()) { // per-import loop
+			unsigned int importIndex = *(curRound.begin());
+			curRound.erase(curRound.begin());
+			vector<SymbolTree *>::const_iterator importIter = importList.begin() + importIndex;
+			vector<Atom> definedAtoms; // the names defined by handling this import
 			// extract the import path out of the iterator
 			Tree *importdcn = (*importIter)->defSite->child->next;
 			bool copyImport = (*importdcn == TOKEN_LSQUARE); // whether this is a copy-import
 			Tree *importId = copyImport ? importdcn->next : importdcn; // ImportIdentifier
-			string importPath = *(importId->child); // NonArrayedIdentifier, ArrayedIdentifier, or OpenIdentifier
+			AtomPath &importPath = importPaths[importIndex];
+			if (importPath.components.empty()) { // if this is the first time we're handling this import, chop up its path
+				importPath = getAtomPath(importId->child); // NonArrayedIdentifier, ArrayedIdentifier, or OpenIdentifier
+			}
 			SymbolTree *importParent = (*importIter)->parent;
 			// try to find a binding for this import
 			SymbolTree *binding = bindId(importPath, *importIter).first;
@@ -717,33 +1017,34 @@ void subImportDecls(vector<SymbolTree *> importList) {
 						}
 						if (!stdExplicitlyImported) { // if it's the first standard import, flag it as handled and let it slide
 							(*importIter)->id = STANDARD_IMPORT_DECL_STRING;
+							(*importIter)->atom = atomTable.intern(STANDARD_IMPORT_DECL_STRING);
+							bindingCache.invalidate();
 							stdExplicitlyImported = true;
-							continue;
 						}
 					} else /* if ((*importIter)->kind == KIND_OPEN_IMPORT) */ { // else if this is an open-import of the standard library node
 						// add in the imported nodes, scanning for conflicts along the way
 						bool firstInsert = true;
-						for (map<string, SymbolTree *>::const_iterator childIter = binding->children.begin();
-								childIter != binding->children.end();
-								childIter++) {
+						vector<SymbolTree *> bindingChildren = binding->sortedChildren();
+						for (vector<SymbolTree *>::const_iterator childIter = bindingChildren.begin(); childIter != bindingChildren.end(); childIter++) {
 							// check for naming conflicts
-							map<string, SymbolTree *>::const_iterator conflictFind = importParent->children.find((*childIter).second->id);
-							if (conflictFind == importParent->children.end()) { // if there were no member naming conflicts
+							SymbolTree *conflictFind = importParent->children.find((*childIter)->atom);
+							if (conflictFind == NULL) { // if there were no member naming conflicts
+								definedAtoms.push_back((*childIter)->atom);
 								if (firstInsert) { // if this is the first insertion, copy in place of the import placeholder node
 									if (copyImport) { // if this is a copy-import
-										**importIter = SymbolTree(*((*childIter).second), importParent, (*childIter).second); // scope to the local environment
+										**importIter = SymbolTree(*((*childIter)), importParent, (*childIter)); // scope to the local environment
 									} else { // else if this is not a copy-import
-										**importIter = SymbolTree(*((*childIter).second), (*childIter).second->parent, NULL); // scope to the foreign environment
+										**importIter = SymbolTree(*((*childIter)), (*childIter)->parent, NULL); // scope to the foreign environment
 									}
 									firstInsert = false;
 								} else { // else if this is not the first insertion, latch in a copy of the child
-									SymbolTree *baseChildCopy = new SymbolTree(*((*childIter).second), NULL, (copyImport) ? (*childIter).second : NULL); // build the copy, scoping to NULL for now
+									SymbolTree *baseChildCopy = new SymbolTree(*((*childIter)), NULL, (copyImport) ? (*childIter) : NULL); // build the copy, scoping to NULL for now
 									*((*importIter)->parent) *= baseChildCopy; // latch in the copy
 									// correct the scope based on whether this is a copy-import or not
 									if (copyImport) { // if this is a copy-import
 										baseChildCopy->parent = importParent; // scope to the local environment
 									} else { // else if this is not a copy-import
-										baseChildCopy->parent = (*childIter).second->parent; // scope to the foreign environment
+										baseChildCopy->parent = (*childIter)->parent; // scope to the foreign environment
 									}
 								}
 							} // else if there is a member naming conflict, do nothing; the import is overridden by what's already there
@@ -754,108 +1055,133 @@ void subImportDecls(vector<SymbolTree *> importList) {
 					if ((*importIter)->kind == KIND_CLOSED_IMPORT) { // if this is a closed-import
 						// check to make sure that this import doesn't cause a binding conflict
 						string importPathTip = binding->id; // must exist if binding succeeed
-						map<string, SymbolTree *>::const_iterator conflictFind = importParent->children.find(importPathTip);
-						if (conflictFind == importParent->children.end()) { // there was no conflict, so just copy the binding in place of the import placeholder node
+						SymbolTree *conflictFind = importParent->children.find(binding->atom);
+						if (conflictFind == NULL) { // there was no conflict, so just copy the binding in place of the import placeholder node
+							definedAtoms.push_back(binding->atom);
 							if (copyImport) { // if this is a copy-import
 								**importIter = SymbolTree(*binding, importParent, binding); // scope to the local environment
 							} else { // else if this is not a copy-import
 								**importIter = SymbolTree(*binding, binding->parent, NULL); // scope to the foreign environment
 							}
 						} else { // else if there was a conflict, flag an error
-							Token curDefToken = importId->child->t; // child of NonArrayedIdentifier or ArrayedIdentifier
+							Token curDefToken = importId->child->t(); // child of NonArrayedIdentifier or ArrayedIdentifier
 							Token prevDefToken;
-							if ((*conflictFind).second->defSite != NULL) { // if there is a definition site for the previous symbol
-								prevDefToken = (*conflictFind).second->defSite->t;
+							if (conflictFind->defSite != NULL) { // if there is a definition site for the previous symbol
+								prevDefToken = conflictFind->defSite->t();
 							} else { // otherwise, it must be a standard definition, so make up the token as if it was
 								prevDefToken.fileIndex = STANDARD_LIBRARY_FILE_INDEX;
-								prevDefToken.row = 0;
-								prevDefToken.col = 0;
+								prevDefToken.offset = NO_SOURCE_OFFSET;
 							}
-							semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"name conflict in importing '"<<importPathTip<<"'");
-							semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (conflicting definition was here)");
+							semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"name conflict in importing '"<<importPathTip<<"'");
+							semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (conflicting definition was here)");
 						}
 					} else /* if ((*importIter)->kind == KIND_OPEN_IMPORT) */ { // else if this is an open-import
 						// verify that what's being open-imported is actually an object by finding an object-style child in the binding's children
-						map<string, SymbolTree *>::const_iterator bindingChildIter;
-						for (bindingChildIter = binding->children.begin(); bindingChildIter != binding->children.end(); bindingChildIter++) {
-							if ((*bindingChildIter).second->kind == KIND_OBJECT) {
+						vector<SymbolTree *> bindingChildren = binding->sortedChildren();
+						vector<SymbolTree *>::const_iterator bindingChildIter;
+						for (bindingChildIter = bindingChildren.begin(); bindingChildIter != bindingChildren.end(); bindingChildIter++) {
+							if ((*bindingChildIter)->kind == KIND_OBJECT) {
 								break;
 							}
 						}
-						if (bindingChildIter != binding->children.end()) { // if we found an object-style child in this open-import's children (it's a valid open-impoprt of an object)
-							SymbolTree *bindingBase = (*bindingChildIter).second; // KIND_OBJECT; this node's children are the ones we're going to import in
+						if (bindingChildIter != bindingChildren.end()) { // if we found an object-style child in this open-import's children (it's a valid open-impoprt of an object)
+							SymbolTree *bindingBase = *bindingChildIter; // KIND_OBJECT; this node's children are the ones we're going to import in
 							// add in the imported nodes, scanning for conflicts along the way
 							bool firstInsert = true;
-							for (map<string, SymbolTree *>::const_iterator bindingBaseIter = bindingBase->children.begin();
-									bindingBaseIter != bindingBase->children.end();
-									bindingBaseIter++) {
+							vector<SymbolTree *> bindingBaseChildren = bindingBase->sortedChildren();
+							for (vector<SymbolTree *>::const_iterator bindingBaseIter = bindingBaseChildren.begin(); bindingBaseIter != bindingBaseChildren.end(); bindingBaseIter++) {
 								// check for member naming conflicts (constructor type conflicts will be resolved later)
-								map<string, SymbolTree *>::const_iterator conflictFind = importParent->children.find((*bindingBaseIter).second->id);
-								if (conflictFind == importParent->children.end()) { // if there were no member naming conflicts
+								SymbolTree *conflictFind = importParent->children.find((*bindingBaseIter)->atom);
+								if (conflictFind == NULL) { // if there were no member naming conflicts
+									definedAtoms.push_back((*bindingBaseIter)->atom);
 									if (firstInsert) { // if this is the first insertion, copy in place of the import placeholder node
 										if (copyImport) { // if this is a copy-import
-											**importIter = SymbolTree(*((*bindingBaseIter).second), importParent, (*bindingBaseIter).second); // scope to the local environment
+											**importIter = SymbolTree(*((*bindingBaseIter)), importParent, (*bindingBaseIter)); // scope to the local environment
 										} else { // else if this is not a copy-import
-											**importIter = SymbolTree(*((*bindingBaseIter).second), (*bindingBaseIter).second->parent, NULL); // scope to the foreign environment
+											**importIter = SymbolTree(*((*bindingBaseIter)), (*bindingBaseIter)->parent, NULL); // scope to the foreign environment
 										}
 										firstInsert = false;
 									} else { // else if this is not the first insertion, latch in a copy of the child
-										SymbolTree *baseChildCopy = new SymbolTree(*((*bindingBaseIter).second), NULL, (copyImport) ? (*bindingBaseIter).second : NULL); // build the copy, scoping to NULL for now
+										SymbolTree *baseChildCopy = new SymbolTree(*((*bindingBaseIter)), NULL, (copyImport) ? (*bindingBaseIter) : NULL); // build the copy, scoping to NULL for now
 										*((*importIter)->parent) *= baseChildCopy; // latch in the copy
 										// correct the scope based on whether this is a copy-import or not
 										if (copyImport) { // if this is a copy-import
 											baseChildCopy->parent = importParent; // scope to the local environment
 										} else { // else if this is not a copy-import
-											baseChildCopy->parent = (*bindingBaseIter).second->parent; // scope to the foreign environment
+											baseChildCopy->parent = (*bindingBaseIter)->parent; // scope to the foreign environment
 										}
 									}
 								} // else if there is a member naming conflict, do nothing; the import is overridden by what's already there
 							}
 						} else { // else if we didn't find an object-style child in this open-import's children (it's an open-impoprt of a non-object), flag an error
-							Token curDefToken = importId->child->t; // child of NonArrayedIdentifier or ArrayedIdentifier
+							Token curDefToken = importId->child->t(); // child of NonArrayedIdentifier or ArrayedIdentifier
 							Token prevDefToken;
 							if (binding->defSite != NULL) { // if there is a definition site for the previous symbol
-								prevDefToken = binding->defSite->t;
+								prevDefToken = binding->defSite->t();
 							} else { // otherwise, it must be a standard definition, so make up the token as if it was
 								prevDefToken.fileIndex = STANDARD_LIBRARY_FILE_INDEX;
-								prevDefToken.row = 0;
-								prevDefToken.col = 0;
+								prevDefToken.offset = NO_SOURCE_OFFSET;
 							}
-							semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"open import on non-object '"<<importPathTip<<"'");
-							semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (importing from here)");
+							semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"open import on non-object '"<<importPathTip<<"'");
+							semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (importing from here)");
 						}
 					}
 				}
-			} else { // else if no binding could be found
-				redoList.push_back(*importIter); // log the failed node for rebinding during the next round
+				// since we handled this import, wake up the imports that it might have unblocked
+				for (vector<Atom>::const_iterator atomIter = definedAtoms.begin(); atomIter != definedAtoms.end(); atomIter++) {
+					map<Atom, vector<unsigned int> >::iterator blockedFind = nameBlockedLists.find(*atomIter);
+					if (blockedFind != nameBlockedLists.end()) {
+						wakeImports(blockedFind->second, importIndex, curRound, nextRound);
+						nameBlockedLists.erase(blockedFind);
+					}
+				}
+				wakeImports(anyBlockedList, importIndex, curRound, nextRound);
+			} else { // else if no binding could be found, log what the import is blocked on
+				Atom importHead = importPath.components[0];
+				if (importHead != ATOM_RECALL && findLatchPoint(importHead, *importIter) == NULL) { // if the head of the path didn't latch anywhere, wait for that name to be defined
+					nameBlockedLists[importHead].push_back(importIndex);
+				} else { // else if the binding failed further along the path, wait for any change
+					anyBlockedList.push_back(importIndex);
+				}
 			}
 		} // per-import loop
-		if (redoList.size() == importList.size()) { // if the import table has stabilized
-			for (vector<SymbolTree *>::const_iterator importIter = redoList.begin(); importIter != redoList.end(); importIter++) {
-				Token curToken = (*importIter)->defSite->t;
-				Tree *importdcn = (*importIter)->defSite->child->next;
-				Tree *importId = (*importdcn == TOKEN_NonArrayedIdentifier || *importdcn == TOKEN_ArrayedIdentifier) ?
-					(*importIter)->defSite->child->next :
-					(*importIter)->defSite->child->next->next; // NonArrayedIdentifier or ArrayedIdentifier
-				string importPath = *importId; // NonArrayedIdentifier or ArrayedIdentifier
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"cannot resolve import '"<<importPath<<"'");
-			}
-			break;
-		} else { // else if the import table hasn't stabilized yet, do another substitution round on the failed binding list
-			importList = redoList;
-		}
-	} // per-change loop
+		curRound.swap(nextRound);
+	} // per-round loop
+	// the worklist has drained, so flag whatever is still blocked as unresolvable, in list order
+	vector<unsigned int> unresolvedList(anyBlockedList);
+	for (map<Atom, vector<unsigned int> >::const_iterator blockedIter = nameBlockedLists.begin(); blockedIter != nameBlockedLists.end(); blockedIter++) {
+		unresolvedList.insert(unresolvedList.end(), blockedIter->second.begin(), blockedIter->second.end());
+	}
+	sort(unresolvedList.begin(), unresolvedList.end());
+	for (vector<unsigned int>::const_iterator unresolvedIter = unresolvedList.begin(); unresolvedIter != unresolvedList.end(); unresolvedIter++) {
+		SymbolTree *importSt = importList[*unresolvedIter];
+		Token curToken = importSt->defSite->t();
+		Tree *importdcn = importSt->defSite->child->next;
+		Tree *importId = (*importdcn == TOKEN_NonArrayedIdentifier || *importdcn == TOKEN_ArrayedIdentifier) ?
+			importSt->defSite->child->next :
+			importSt->defSite->child->next->next; // NonArrayedIdentifier or ArrayedIdentifier
+		string importPath = *importId; // NonArrayedIdentifier or ArrayedIdentifier
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"cannot resolve import '"<<importPath<<"'");
+	}
 }
 
-// recursively derives the Type trees and offsets of all non-inlined semantic-impacting nodes in the passed-in SymbolTree
-void semSt(SymbolTree *root, SymbolTree *parent = NULL) {
-	if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR) { // if it's a non-inlined node, derive its type
-		getStatusSymbolTree(root, parent);
-	}
-	// recurse on this node's children
-	for (map<string, SymbolTree *>::const_iterator iter = root->children.begin(); iter != root->children.end(); iter++) {
-		semSt((*iter).second, root);
-	}
+// derives the Type trees and offsets of all non-inlined semantic-impacting nodes in the passed-in SymbolTree, in pre-order
+void semSt(SymbolTree *stRoot) {
+	vector<pair<SymbolTree *, SymbolTree *> > workStack; // (node, parent) pairs left to visit
+	workStack.push_back(make_pair(stRoot, (SymbolTree *)NULL));
+	while (!workStack.empty()) {
+		SymbolTree *root = workStack.back().first;
+		SymbolTree *parent = workStack.back().second;
+		workStack.pop_back();
+		if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR) { // if it's a non-inlined node, derive its type
+			getStatusSymbolTree(root, parent);
+		}
+		// queue this node's children, in reverse so that they're visited in order
+		vector<SymbolTree *> childList = root->sortedChildren();
+		for (vector<SymbolTree *>::reverse_iterator iter = childList.rbegin(); iter != childList.rend(); iter++) {
+			workStack.push_back(make_pair(*iter, root));
+		}
+	} // per-node loop
 }
 
 // reports errors; derives the status of this SymbolTree node, as well as deriving its subnode offset properties
@@ -872,14 +1198,14 @@ TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeS
 	} else if (root->kind == KIND_INSTANTIATION) { // else if the symbol was defined as an instantiation-style node
 		returnStatus(getStatusInstantiation(tree, inStatus)); // Instantiation
 	} else if (root->kind == KIND_FAKE) { // else if the symbol was fake-defined as part of bindId()
-		return (tree->status);
+		return (tree->status());
 	}
 	GET_STATUS_CODE;
 	// ensure that this isn't a copy-import of a non-referensible node
-	if (root->copyImportSite != NULL && !(root->defSite->status.type->referensible)) { // if it's a copy-import of a non-referensible type, flag an error
-		Token curToken = root->defSite->t;
-		Token sourceToken = root->copyImportSite->defSite->t;
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"copy import of non-referensible identifier '"<<root->copyImportSite->id<<"'");
+	if (root->copyImportSite != NULL && !(root->defSite->status().type->referensible)) { // if it's a copy-import of a non-referensible type, flag an error
+		Token curToken = root->defSite->t();
+		Token sourceToken = root->copyImportSite->defSite->t();
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"copy import of non-referensible identifier '"<<root->copyImportSite->id<<"'");
 	}
 	// generate the intermediate code tree
 	if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR || root->kind == KIND_INSTANTIATION) {
@@ -895,22 +1221,21 @@ TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeS
 // reports errors
 TypeStatus getStatusIdentifier(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
-	string id = *tree; // string representation of this identifier
-	pair<SymbolTree *, bool> binding = bindId(id, tree->env, inStatus);
+	const AtomPath &id = getAtomPath(tree); // the interned components of this identifier
+	pair<SymbolTree *, bool> binding = bindId(id, tree->env(), inStatus);
 	SymbolTree *st = binding.first;
 	if (st != NULL) { // if we found a binding
 		TypeStatus stStatus = getStatusSymbolTree(st, st->parent, inStatus);
 		if (*stStatus) { // if we successfully extracted a type for this SymbolTree entry
-			Type *mutableStType = stStatus;
+			Type *stType = stStatus;
 			if (binding.second) { // do the upstream-mandated constantization if needed
-				mutableStType = mutableStType->copy();
-				mutableStType->constantize();
+				stType = stType->constantized();
 			}
-			returnType(mutableStType);
+			returnType(stType);
 		}
 	} else { // else if we couldn't find a binding
-		Token curToken = tree->t;
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"cannot resolve '"<<id<<"'");
+		Token curToken = tree->t();
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"cannot resolve '"<<rebuildId(id.components, id.components.size()-1)<<"'");
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -935,15 +1260,15 @@ TypeStatus getStatusPrimaryBase(Tree *tree, const TypeStatus &inStatus) {
 				if (mutableSubStatus.type->delatch()) {
 					returnStatus(mutableSubStatus);
 				} else {
-					Token curToken = pbc->child->t; // SLASH
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"delatch of incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<subStatus<<")");
+					Token curToken = pbc->child->t(); // SLASH
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"delatch of incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<subStatus<<")");
 					mutableSubStatus.type->erase();
 				}
 			} else { // else if the derived type isn't a latch or stream (and thus can't be delatched), error
-				Token curToken = pbc->t;
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"delatch of non-latch, non-stream '"<<subSI<<"'");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<inStatus<<")");
+				Token curToken = pbc->t();
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"delatch of non-latch, non-stream '"<<subSI<<"'");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<inStatus<<")");
 			}
 		}
 	} else if (*pbc == TOKEN_Instantiation) {
@@ -962,11 +1287,11 @@ TypeStatus getStatusPrimaryBase(Tree *tree, const TypeStatus &inStatus) {
 		TypeStatus baseStatus = getStatusPrimaryBase(pbc, inStatus); // derive the status of the base node
 		if (*baseStatus) { // if we managed to derive the status of the base node
 			if (*baseStatus >> *stdIntType) { // if the base can be converted into an int, return int
-				returnType(new StdType(STD_INT, SUFFIX_LATCH));
+				returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 			} else { // else if we couldn't apply the operator to the type of the subnode, flag an error
-				Token curToken = pbc->next->child->t; // the actual operator token
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"postfix operation '"<<curToken.s<<"' on invalid type");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<baseStatus<<")");
+				Token curToken = pbc->next->child->t(); // the actual operator token
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"postfix operation '"<<curToken.s()<<"' on invalid type");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<baseStatus<<")");
 			}
 		}
 	}
@@ -1008,24 +1333,24 @@ TypeStatus getStatusPrimary(Tree *tree, const TypeStatus &inStatus) {
 			Tree *pomocc = primaryc->child->child;
 			if (*pomocc == TOKEN_NOT) {
 				if (*subStatus >> *stdBoolType) {
-					returnType(new StdType(STD_BOOL, SUFFIX_LATCH));
+					returnType(typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 				}
 			} else if (*pomocc == TOKEN_COMPLEMENT) {
 				if (*subStatus >> *stdIntType) {
-					returnType(new StdType(STD_INT, SUFFIX_LATCH));
+					returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 				}
 			} else /* if (*pomocc == TOKEN_PLUS || *pomocc == TOKEN_MINUS) */ {
 				if (*subStatus >> *stdIntType) {
-					returnType(new StdType(STD_INT, SUFFIX_LATCH));
+					returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 				}
 				if (*subStatus >> *stdFloatType) {
-					returnType(new StdType(STD_FLOAT, SUFFIX_LATCH));
+					returnType(typeTable.stdType(STD_FLOAT, SUFFIX_LATCH));
 				}
 			}
 			// we couldn't derive a valid type for this prefix operation, so flag an error
-			Token curToken = primaryc->child->child->t; // the actual operator token
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"prefix operation '"<<curToken.s<<"' on invalid type");
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<subStatus<<")");
+			Token curToken = primaryc->child->child->t(); // the actual operator token
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"prefix operation '"<<curToken.s()<<"' on invalid type");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<subStatus<<")");
 		}
 	}
 	GET_STATUS_CODE;
@@ -1039,15 +1364,15 @@ TypeStatus getStatusPrimary(Tree *tree, const TypeStatus &inStatus) {
 		} else if (*pomocc == TOKEN_COMPLEMENT) {
 			returnCode(new TempTree(new UnOpTree(UNOP_COMPLEMENT_INT, primarycn->castCode(*stdIntType))));
 		} else if (*pomocc == TOKEN_PLUS) {
-			if (*(primarycn->status) >> *stdIntType) {
+			if (*(primarycn->status()) >> *stdIntType) {
 				returnCode(primarycn->castCode(*stdIntType));
-			} else /* if (*(primarycn->status) >> *stdFloatType) */ {
+			} else /* if (*(primarycn->status()) >> *stdFloatType) */ {
 				returnCode(primarycn->castCode(*stdFloatType));
 			}
 		} else if (*pomocc == TOKEN_MINUS) {
-			if (*(primarycn->status) >> *stdIntType) {
+			if (*(primarycn->status()) >> *stdIntType) {
 				returnCode(new TempTree(new UnOpTree(UNOP_MINUS_INT, primarycn->castCode(*stdIntType))));
-			} else /* if (*(primarycn->status) >> *stdFloatType) */ {
+			} else /* if (*(primarycn->status()) >> *stdFloatType) */ {
 				returnCode(new TempTree(new UnOpTree(UNOP_MINUS_FLOAT, primarycn->castCode(*stdFloatType))));
 			}
 		}
@@ -1097,6 +1422,29 @@ TypeStatus getStatusBracketedExp(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_FOOTER;
 }
 
+// derives the statuses of the infix operand Exps under the given Exp in the same left-to-right postorder that recursion would, but with an explicit work stack, so that getStatusExp() finds its operands memoized and long operator chains don't overflow the stack
+void deriveExpOperands(Tree *tree, const TypeStatus &inStatus) {
+	vector<pair<Tree *, bool> > workStack; // pairs of (Exp, whether its operands have already been pushed)
+	Tree *expRight = tree->child->next->next;
+	workStack.push_back(make_pair(expRight, false));
+	workStack.push_back(make_pair(tree->child, false)); // the left operand goes on top, so it's derived first
+	while (!workStack.empty()) {
+		Tree *cur = workStack.back().first;
+		bool expanded = workStack.back().second;
+		workStack.pop_back();
+		if (cur->status().type != NULL) { // if this operand is already memoized, there's nothing to do
+			continue;
+		}
+		if (expanded || *(cur->child) == TOKEN_Primary) { // if the operand's own operands are done (or it has none), derive it now
+			getStatusExp(cur, inStatus);
+		} else { // else if it's an infix Exp whose operands haven't been derived yet, revisit it after deriving them
+			workStack.push_back(make_pair(cur, true));
+			workStack.push_back(make_pair(cur->child->next->next, false));
+			workStack.push_back(make_pair(cur->child, false));
+		}
+	}
+}
+
 // reports errors
 TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
@@ -1107,30 +1455,31 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 		Tree *expLeft = expc;
 		Tree *op = expLeft->next;
 		Tree *expRight = op->next;
+		deriveExpOperands(tree, inStatus);
 		TypeStatus left = getStatusExp(expLeft, inStatus);
 		TypeStatus right = getStatusExp(expRight, inStatus);
 		if (*left && *right) { // if we derived the types of both operands successfully
 			if (!(left->suffix == SUFFIX_CONSTANT || left->suffix == SUFFIX_LATCH)) {
-				Token curToken = expLeft->t; // Exp
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"left operand of expression is not a constant or latch");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (operand type is "<<left<<")");
+				Token curToken = expLeft->t(); // Exp
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"left operand of expression is not a constant or latch");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (operand type is "<<left<<")");
 			} else if (!(right->suffix == SUFFIX_CONSTANT || right->suffix == SUFFIX_LATCH)) {
-				Token curToken = expRight->t; // Exp
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"right operand of expression is not a constant or latch");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (operand type is "<<right<<")");
+				Token curToken = expRight->t(); // Exp
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"right operand of expression is not a constant or latch");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (operand type is "<<right<<")");
 			} else {
-				switch (op->t.tokenType) {
+				switch (op->tokenType) {
 					case TOKEN_DOR:
 					case TOKEN_DAND:
 						if ((*left >> *stdBoolType) && (*right >> *stdBoolType)) {
-							returnType(new StdType(STD_BOOL, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 						}
 						break;
 					case TOKEN_OR:
 					case TOKEN_XOR:
 					case TOKEN_AND:
 						if ((*left >> *stdIntType) && (*right >> *stdIntType)) {
-							returnType(new StdType(STD_INT, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 						}
 						break;
 					case TOKEN_DEQUALS:
@@ -1140,13 +1489,13 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 					case TOKEN_LE:
 					case TOKEN_GE:
 						if (left->isComparable(*right)) {
-							returnType(new StdType(STD_BOOL, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 						}
 						break;
 					case TOKEN_LS:
 					case TOKEN_RS:
 						if ((*left >> *stdIntType) && (*right >> *stdIntType)) {
-							returnType(new StdType(STD_INT, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 						}
 						break;
 					case TOKEN_TIMES:
@@ -1155,26 +1504,26 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 					case TOKEN_PLUS:
 					case TOKEN_MINUS:
 						if ((*left >> *stdIntType) && (*right >> *stdIntType)) {
-							returnType(new StdType(STD_INT, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 						}
 						if ((*left >> *stdFloatType) && (*right >> *stdFloatType)) {
-							returnType(new StdType(STD_FLOAT, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_FLOAT, SUFFIX_LATCH));
 						}
 						// if both terms are convertible to string, return string
 						if ((*left >> *stdStringType) && (*right >> *stdStringType)) {
-							returnType(new StdType(STD_STRING, SUFFIX_LATCH));
+							returnType(typeTable.stdType(STD_STRING, SUFFIX_LATCH));
 						}
 						break;
 					default: // can't happen; the above should cover all cases
 						break;
 				}
 				// if we couldn't resolve a type for this expression (or else we would have returned it above)
-				Token curToken = op->t; // the actual operator token
-				Token curTokenLeft = expLeft->t; // the left operand
-				Token curTokenRight = expRight->t; // the right operand
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"infix operation '"<<curToken.s<<"' on invalid operands");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (left operand type is "<<left<<")");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (right operand type is "<<right<<")");
+				Token curToken = op->t(); // the actual operator token
+				Token curTokenLeft = expLeft->t(); // the left operand
+				Token curTokenRight = expRight->t(); // the right operand
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"infix operation '"<<curToken.s()<<"' on invalid operands");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (left operand type is "<<left<<")");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (right operand type is "<<right<<")");
 			}
 		}
 	}
@@ -1185,7 +1534,7 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 		Tree *expLeft = expc;
 		Tree *op = expLeft->next;
 		Tree *expRight = op->next;
-		switch (op->t.tokenType) {
+		switch (op->tokenType) {
 			case TOKEN_DOR:
 				returnCode(new TempTree(new BinOpTree(BINOP_DOR_BOOL, expLeft->castCode(*stdBoolType), expRight->castCode(*stdBoolType))));
 			case TOKEN_DAND:
@@ -1213,35 +1562,35 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 			case TOKEN_RS:
 				returnCode(new TempTree(new BinOpTree(BINOP_RS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
 			case TOKEN_TIMES:
-				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
+				if ((*(expLeft->status()) >> *stdIntType) && (*(expRight->status()) >> *stdIntType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_TIMES_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
-				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
+				} else /* if ((*(expLeft->status()) >> *stdFloatType) && (*(expRight->status()) >> *stdFloatType)) */ {
 					returnCode(new TempTree(new BinOpTree(BINOP_TIMES_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
 				}
 			case TOKEN_DIVIDE:
-				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
+				if ((*(expLeft->status()) >> *stdIntType) && (*(expRight->status()) >> *stdIntType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_DIVIDE_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
-				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
+				} else /* if ((*(expLeft->status()) >> *stdFloatType) && (*(expRight->status()) >> *stdFloatType)) */ {
 					returnCode(new TempTree(new BinOpTree(BINOP_DIVIDE_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
 				}
 			case TOKEN_MOD:
-				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
+				if ((*(expLeft->status()) >> *stdIntType) && (*(expRight->status()) >> *stdIntType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_MOD_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
-				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
+				} else /* if ((*(expLeft->status()) >> *stdFloatType) && (*(expRight->status()) >> *stdFloatType)) */ {
 					returnCode(new TempTree(new BinOpTree(BINOP_MOD_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
 				}
 			case TOKEN_PLUS:
-				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
+				if ((*(expLeft->status()) >> *stdIntType) && (*(expRight->status()) >> *stdIntType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
-				} else if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) {
+				} else if ((*(expLeft->status()) >> *stdFloatType) && (*(expRight->status()) >> *stdFloatType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
-				} else /* if ((*(expLeft->status) >> *stdStringType) && (*(expRight->status) >> *stdStringType)) */ {
+				} else /* if ((*(expLeft->status()) >> *stdStringType) && (*(expRight->status()) >> *stdStringType)) */ {
 					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_STRING, expLeft->castCode(*stdStringType), expRight->castCode(*stdStringType))));
 				}
 			case TOKEN_MINUS:
-				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
+				if ((*(expLeft->status()) >> *stdIntType) && (*(expRight->status()) >> *stdIntType)) {
 					returnCode(new TempTree(new BinOpTree(BINOP_MINUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
-				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
+				} else /* if ((*(expLeft->status()) >> *stdFloatType) && (*(expRight->status()) >> *stdFloatType)) */ {
 					returnCode(new TempTree(new BinOpTree(BINOP_MINUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
 				}
 			default: // can't happen; the above should cover all cases
@@ -1251,54 +1600,80 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_FOOTER;
 }
 
+// reports errors
+// checks to make sure that the given ArrayAccess's subscript expressions are compatible with STD_INT
+void checkArrayAccess(const Tree *arrayAccess) {
+	if (arrayAccess->child->next->next->next == NULL) { // if there's only one subscript
+		TypeStatus expStatus = getStatusExp(arrayAccess->child->next);
+		if (!(*expStatus >> *stdIntType)) { // if the types are incompatible, flag an error
+			Token curToken = arrayAccess->child->next->t(); // Exp
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"array subscript is invalid");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (subscript type is "<<expStatus<<")");
+		}
+	} else { // else if this is an extent subscript
+		TypeStatus leftExpStatus = getStatusExp(arrayAccess->child->next);
+		if (!(*leftExpStatus >> *stdIntType)) { // if the types are incompatible, flag an error
+			Token curToken = arrayAccess->child->next->t(); // Exp
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"left extent subscript is invalid");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (subscript type is "<<leftExpStatus<<")");
+		}
+		TypeStatus rightExpStatus = getStatusExp(arrayAccess->child->next);
+		if (!(*rightExpStatus >> *stdIntType)) { // if the types are incompatible, flag an error
+			Token curToken = arrayAccess->child->next->next->next->t(); // Exp
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"right extent subscript is invalid");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (subscript type is "<<rightExpStatus<<")");
+		}
+	}
+}
+
 TypeStatus getStatusPrimOpNode(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	Tree *ponc = tree->child->child; // the operator token itself
-	switch (ponc->t.tokenType) {
+	switch (ponc->tokenType) {
 		case TOKEN_NOT:
-			returnType(new StdType(STD_NOT, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_NOT, SUFFIX_LATCH));
 		case TOKEN_COMPLEMENT:
-			returnType(new StdType(STD_COMPLEMENT, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_COMPLEMENT, SUFFIX_LATCH));
 		case TOKEN_DPLUS:
-			returnType(new StdType(STD_DPLUS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DPLUS, SUFFIX_LATCH));
 		case TOKEN_DMINUS:
-			returnType(new StdType(STD_DMINUS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DMINUS, SUFFIX_LATCH));
 		case TOKEN_DOR:
-			returnType(new StdType(STD_DOR, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DOR, SUFFIX_LATCH));
 		case TOKEN_DAND:
-			returnType(new StdType(STD_DAND, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DAND, SUFFIX_LATCH));
 		case TOKEN_OR:
-			returnType(new StdType(STD_OR, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_OR, SUFFIX_LATCH));
 		case TOKEN_XOR:
-			returnType(new StdType(STD_XOR, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_XOR, SUFFIX_LATCH));
 		case TOKEN_AND:
-			returnType(new StdType(STD_AND, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_AND, SUFFIX_LATCH));
 		case TOKEN_DEQUALS:
-			returnType(new StdType(STD_DEQUALS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DEQUALS, SUFFIX_LATCH));
 		case TOKEN_NEQUALS:
-			returnType(new StdType(STD_NEQUALS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_NEQUALS, SUFFIX_LATCH));
 		case TOKEN_LT:
-			returnType(new StdType(STD_LT, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_LT, SUFFIX_LATCH));
 		case TOKEN_GT:
-			returnType(new StdType(STD_GT, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_GT, SUFFIX_LATCH));
 		case TOKEN_LE:
-			returnType(new StdType(STD_LE, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_LE, SUFFIX_LATCH));
 		case TOKEN_GE:
-			returnType(new StdType(STD_GE, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_GE, SUFFIX_LATCH));
 		case TOKEN_LS:
-			returnType(new StdType(STD_LS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_LS, SUFFIX_LATCH));
 		case TOKEN_RS:
-			returnType(new StdType(STD_RS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_RS, SUFFIX_LATCH));
 		case TOKEN_TIMES:
-			returnType(new StdType(STD_TIMES, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_TIMES, SUFFIX_LATCH));
 		case TOKEN_DIVIDE:
-			returnType(new StdType(STD_DIVIDE, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_DIVIDE, SUFFIX_LATCH));
 		case TOKEN_MOD:
-			returnType(new StdType(STD_MOD, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_MOD, SUFFIX_LATCH));
 		case TOKEN_PLUS:
-			returnType(new StdType(STD_PLUS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_PLUS, SUFFIX_LATCH));
 		case TOKEN_MINUS:
-			returnType(new StdType(STD_MINUS, SUFFIX_LATCH));
+			returnType(typeTable.stdType(STD_MINUS, SUFFIX_LATCH));
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -1308,13 +1683,13 @@ TypeStatus getStatusPrimLiteral(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	Tree *plc = tree->child;
 	if (*plc == TOKEN_INUM) {
-		returnType(new StdType(STD_INT, SUFFIX_LATCH));
+		returnType(typeTable.stdType(STD_INT, SUFFIX_LATCH));
 	} else if (*plc == TOKEN_FNUM) {
-		returnType(new StdType(STD_FLOAT, SUFFIX_LATCH));
+		returnType(typeTable.stdType(STD_FLOAT, SUFFIX_LATCH));
 	} else if (*plc == TOKEN_CQUOTE) {
-		returnType(new StdType(STD_CHAR, SUFFIX_LATCH));
+		returnType(typeTable.stdType(STD_CHAR, SUFFIX_LATCH));
 	} else if (*plc == TOKEN_SQUOTE) {
-		returnType(new StdType(STD_STRING, SUFFIX_LATCH));
+		returnType(typeTable.stdType(STD_STRING, SUFFIX_LATCH));
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -1387,7 +1762,7 @@ TypeStatus getStatusFilterHeader(Tree *tree, const TypeStatus &inStatus) {
 
 // reports errors; assumes that the corresponding Filter thunk was generated successfully
 TypeStatus verifyStatusFilter(Tree *tree) {
-	FilterType *headerType = (FilterType *)(tree->status.type);
+	FilterType *headerType = (FilterType *)(tree->status().type);
 	if (*(headerType->from())) { // if the header from-type evaluates to a valid type
 		Tree *block;
 		TypeStatus startStatus; // the status that we're going to feed into the Block subnode derivation
@@ -1410,9 +1785,9 @@ TypeStatus verifyStatusFilter(Tree *tree) {
 					(*(((FilterType *)(blockStatus.type))->to()) >> *(headerType->to()))) { // if the header and Block return types are compatible
 				returnTypeRet(headerType, NULL);
 			} else { // else if the header and Block don't match
-				Token curToken = block->child->t; // LCURLY
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"block returns unexpected type "<<((FilterType *)(blockStatus.type))->to());
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<headerType->to()<<")");
+				Token curToken = block->child->t(); // LCURLY
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"block returns unexpected type "<<((FilterType *)(blockStatus.type))->to());
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<headerType->to()<<")");
 			}
 		}
 	}
@@ -1450,7 +1825,7 @@ TypeStatus getStatusInstructor(Tree *tree, const TypeStatus &inStatus) {
 
 // assumes that the corresponding Filter thunk was generated successfully
 TypeStatus verifyStatusInstructor(Tree *tree) {
-	FilterType *headerType = (FilterType *)(tree->status.type);
+	FilterType *headerType = (FilterType *)(tree->status().type);
 	if (*(headerType->from())) { // if the header evaluates to a valid type
 		Tree *block;
 		if (tree->child->next != NULL) {
@@ -1469,7 +1844,7 @@ TypeStatus verifyStatusInstructor(Tree *tree) {
 				returnTypeRet(headerType, NULL);
 			}
 		} else { // else if there is no explicit definition block to verify, simply return the previously derived status
-			returnStatus(tree->status);
+			returnStatus(tree->status());
 		}
 	}
 	GET_STATUS_CODE;
@@ -1486,7 +1861,7 @@ TypeStatus getStatusOutstructor(Tree *tree, const TypeStatus &inStatus) {
 
 // reports errors; assumes that the corresponding Filter thunk was generated successfully
 TypeStatus verifyStatusOutstructor(Tree *tree) {
-	FilterType *headerType = (FilterType *)(tree->status.type);
+	FilterType *headerType = (FilterType *)(tree->status().type);
 	if (*(headerType->from())) { // if the header from-type evaluates to a valid type
 		Tree *block = tree->child->next->next; // NULL, RSQUARE, or Block
 		if (block != NULL && *block == TOKEN_Block) { // if there's an explicit block to verify for this Outstructor
@@ -1499,13 +1874,13 @@ TypeStatus verifyStatusOutstructor(Tree *tree) {
 				} else if (*(((FilterType *)(verifiedStatus.type))->to()) >> *(headerType->to())) { // else if the return types are compatible, log the header's to-type as the return status
 					returnTypeRet(headerType, NULL);
 				} else { // if the return types are not compatible, flag an error
-					Token curToken = block->child->t; // LCURLY
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"outstructor returns unexpected type "<<((FilterType *)(verifiedStatus.type))->to());
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<headerType->to()<<")");
+					Token curToken = block->child->t(); // LCURLY
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"outstructor returns unexpected type "<<((FilterType *)(verifiedStatus.type))->to());
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<headerType->to()<<")");
 				}
 			}
 		} else { // else if there is no explicit block to verify for this Outstructor (it's an implicitly null outstructor)
-			returnStatus(tree->status);
+			returnStatus(tree->status());
 		}
 	}
 	GET_STATUS_CODE;
@@ -1519,16 +1894,17 @@ TypeStatus getStatusObject(Tree *tree, const TypeStatus &inStatus) {
 	StructorList instructorList;
 	StructorList outstructorList;
 	MemberList memberList;
-	SymbolTree *objectSt = tree->env;
-	for (map<string, SymbolTree *>::const_iterator memberIter = objectSt->children.begin(); memberIter != objectSt->children.end(); memberIter++) {
-		if ((*memberIter).second->kind == KIND_INSTRUCTOR) { // if it's an instructor-style node
-			instructorList.add((*memberIter).second->defSite); // Instructor
-		} else if ((*memberIter).second->kind == KIND_OUTSTRUCTOR) { // else if it's an outstructor-style node
-			outstructorList.add((*memberIter).second->defSite); // Outstructor
-		} else if ((*memberIter).second->kind == KIND_DECLARATION) { // else if it's a declaration-style node
-			memberList.add((*memberIter).second->id, (*memberIter).second->defSite);
-		} else if ((*memberIter).second->kind == KIND_STD) { // else if it's an imported standard node
-			memberList.add((*memberIter).second->id, (*memberIter).second->defSite->status.type);
+	SymbolTree *objectSt = tree->env();
+	vector<SymbolTree *> memberSts = objectSt->sortedChildren();
+	for (vector<SymbolTree *>::const_iterator memberIter = memberSts.begin(); memberIter != memberSts.end(); memberIter++) {
+		if ((*memberIter)->kind == KIND_INSTRUCTOR) { // if it's an instructor-style node
+			instructorList.add((*memberIter)->defSite); // Instructor
+		} else if ((*memberIter)->kind == KIND_OUTSTRUCTOR) { // else if it's an outstructor-style node
+			outstructorList.add((*memberIter)->defSite); // Outstructor
+		} else if ((*memberIter)->kind == KIND_DECLARATION) { // else if it's a declaration-style node
+			memberList.add((*memberIter)->id, (*memberIter)->defSite);
+		} else if ((*memberIter)->kind == KIND_STD) { // else if it's an imported standard node
+			memberList.add((*memberIter)->id, (*memberIter)->defSite->status().type);
 		}
 	}
 	// return a thunk representing this ObjectType
@@ -1546,7 +1922,7 @@ TypeStatus verifyStatusObject(Tree *tree) {
 	// making sure that there are no type conflicts in instructors and outstructors
 	// derive types for and verify all members
 	// verify all remaining raw pipes in this Object definition
-	ObjectType *objectType = (ObjectType *)(tree->status.type);
+	ObjectType *objectType = (ObjectType *)(tree->status().type);
 	// derive types for all instructors and outstructors from their headers and validate that there were no errors in doing so
 	bool failed = !(objectType->instructorList.reify() && objectType->outstructorList.reify());
 	// verify the definitions of all instructors and outstructors (including filling in the return types of implicit outstructors)
@@ -1570,10 +1946,10 @@ TypeStatus verifyStatusObject(Tree *tree) {
 				if (iter2 != iter1) { // if this isn't the same instructor as in the outer loop
 					Type *insType2 = *iter2;
 					if (*insType2 && *insType2 == *insType1) {
-						Token curDefToken = (*iter1).defSite()->t; // Instructor
-						Token prevDefToken = (*iter2).defSite()->t; // Instructor
-						semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"duplicate instructor of type "<<insType1);
-						semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous definition was here)");
+						Token curDefToken = (*iter1).defSite()->t(); // Instructor
+						Token prevDefToken = (*iter2).defSite()->t(); // Instructor
+						semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"duplicate instructor of type "<<insType1);
+						semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous definition was here)");
 						failed = true;
 						break;
 					}
@@ -1590,10 +1966,10 @@ TypeStatus verifyStatusObject(Tree *tree) {
 				if (iter2 != iter1) { // if this isn't the same outstructor as in the outer loop
 					Type *outsType2 = *iter2;
 					if (*outsType2 && *outsType2 == *outsType1) {
-						Token curDefToken = (*iter1).defSite()->t; // Outstructor
-						Token prevDefToken = (*iter2).defSite()->t; // Outstructor
-						semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"duplicate outstructor of type "<<outsType1);
-						semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous definition was here)");
+						Token curDefToken = (*iter1).defSite()->t(); // Outstructor
+						Token prevDefToken = (*iter2).defSite()->t(); // Outstructor
+						semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"duplicate outstructor of type "<<outsType1);
+						semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous definition was here)");
 						failed = true;
 						break;
 					}
@@ -1624,7 +2000,7 @@ TypeStatus verifyStatusObject(Tree *tree) {
 	}
 	// finally, do the verified return
 	if (!failed) { // if we successfully verified everything, return the originally derived status
-		returnStatus(tree->status);
+		returnStatus(tree->status());
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -1659,9 +2035,9 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 			// validate that this suffix expression is valid
 			TypeStatus expStatus = getStatusExp(exp, inStatus); // Exp
 			if (!(*expStatus >> *stdIntType)) { // if the expression is incompatible with an integer, flag a bad expression error
-				Token curToken = exp->t; // Exp
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"array subscript is invalid");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<expStatus<<")");
+				Token curToken = exp->t(); // Exp
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"array subscript is invalid");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (subscript type is "<<expStatus<<")");
 				failed = true;
 			}
 		}
@@ -1673,9 +2049,9 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 			// validate that this suffix expression is valid
 			TypeStatus expStatus = getStatusExp(exp, inStatus); // Exp
 			if (!(*expStatus >> *stdIntType)) { // if the expression is incompatible with an integer, flag a bad expression error
-				Token curToken = exp->t; // Exp
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"pool subscript is invalid");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<expStatus<<")");
+				Token curToken = exp->t(); // Exp
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"pool subscript is invalid");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (subscript type is "<<expStatus<<")");
 				failed = true;
 			}
 		}
@@ -1692,8 +2068,8 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 					idStatus->offsetExp = offsetExp;
 					returnStatus(idStatus);
 				} else { // else if the type is defined by a standard literal, flag an error
-					Token curToken = typec->child->t; // guaranteed to be ID, since only NonArrayedIdentifier or ArrayedIdentifier nodes generate inoperable types
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"standard literal '"<<typec<<"' is not a type");
+					Token curToken = typec->child->t(); // guaranteed to be ID, since only NonArrayedIdentifier or ArrayedIdentifier nodes generate inoperable types
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"standard literal '"<<typec<<"' is not a type");
 				}
 			}
 		} else if (*typec == TOKEN_FilterType) { // else if it's an in-place-defined filter type
@@ -1740,12 +2116,12 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 							}
 							if (iter1 == instructorList.end()) { // if there were no conflicts, add the instructor's type to the list
 								instructorList.add((TypeList *)(insStatus.type));
-								instructorTokens.push_back(cur->child->t); // EQUALS
+								instructorTokens.push_back(cur->child->t()); // EQUALS
 							} else { // otherwise, flag the conflict as an error
-								Token curDefToken = cur->child->t; // EQUALS
+								Token curDefToken = cur->child->t(); // EQUALS
 								Token prevDefToken = *iter2;
-								semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"duplicate instructor of type "<<insStatus);
-								semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous definition was here)");
+								semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"duplicate instructor of type "<<insStatus);
+								semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous definition was here)");
 								failed = true;
 							}
 						} else { // otherwise, if we failed to derive a type for this instructor
@@ -1764,12 +2140,12 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 							}
 							if (iter1 == outstructorList.end()) { // if there were no conflicts, add the outstructor's type to the list
 								outstructorList.add((TypeList *)(outsStatus.type));
-								outstructorTokens.push_back(cur->child->t); // EQUALS
+								outstructorTokens.push_back(cur->child->t()); // EQUALS
 							} else { // otherwise, flag the conflict as an error
-								Token curDefToken = cur->child->t; // EQUALS
+								Token curDefToken = cur->child->t(); // EQUALS
 								Token prevDefToken = *iter2;
-								semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"duplicate outstructor of type "<<outsStatus);
-								semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous definition was here)");
+								semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"duplicate outstructor of type "<<outsStatus);
+								semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous definition was here)");
 								failed = true;
 							}
 						} else { // otherwise, if we failed to derive a type for this outstructor
@@ -1777,7 +2153,7 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 						}
 					} else if (*cur == TOKEN_MemberType) { // else if it's a member type
 						// check for naming conflicts with this member
-						string &stringToAdd = cur->child->t.s; // ID
+						string stringToAdd = cur->child->t().s(); // ID
 						MemberList::iterator iter1;
 						vector<Token>::const_iterator iter2;
 						for (iter1 = memberList.begin(), iter2 = memberTokens.begin(); iter1 != memberList.end(); iter1++, iter2++) {
@@ -1789,15 +2165,15 @@ TypeStatus getStatusType(Tree *tree, const TypeStatus &inStatus) {
 							TypeStatus memberStatus = getStatusType(cur->child->next->next, inStatus); // Type
 							if (*memberStatus) { // if we successfully derived a type for this Declaration
 								memberList.add(stringToAdd, memberStatus.type);
-								memberTokens.push_back(cur->child->t); // ID
+								memberTokens.push_back(cur->child->t()); // ID
 							} else { // else if we failed to derive a type
 								failed = true;
 							}
 						} else { // else if there was a naming conflict with this member
-							Token curDefToken = cur->child->t;
+							Token curDefToken = cur->child->t();
 							Token prevDefToken = *iter2;
-							semmerError(curDefToken.fileIndex,curDefToken.row,curDefToken.col,"duplicate declaration of object type member '"<<stringToAdd<<"'");
-							semmerError(prevDefToken.fileIndex,prevDefToken.row,prevDefToken.col,"-- (previous declaration was here)");
+							semmerError(curDefToken.fileIndex,curDefToken.row(),curDefToken.col(),"duplicate declaration of object type member '"<<stringToAdd<<"'");
+							semmerError(prevDefToken.fileIndex,prevDefToken.row(),prevDefToken.col(),"-- (previous declaration was here)");
 							failed = true;
 						}
 					}
@@ -1822,9 +2198,9 @@ TypeStatus getStatusTypeList(Tree *tree, const TypeStatus &inStatus) {
 			if (curTypeStatus.type->instantiable) { // if the derived type is instantiable
 				list.push_back(curTypeStatus.type); // commit the type to the list
 			} else { // else if the derived type is not instantiable, flag an error
-				Token curToken = cur->t; // Type
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"parameterized non-instantiable node '"<<cur->child<<"'"); // NonArrayedIdentifier
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter type is "<<curTypeStatus<<")");
+				Token curToken = cur->t(); // Type
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"parameterized non-instantiable node '"<<cur->child<<"'"); // NonArrayedIdentifier
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter type is "<<curTypeStatus<<")");
 				failed = true;
 			}
 		} else { // else if we failed to derive a type for this node
@@ -1849,10 +2225,10 @@ TypeStatus getStatusParamList(Tree *tree, const TypeStatus &inStatus) {
 			list.push_back(paramStatus.type->copy()); // commit the type to the list
 			if (*paramStatus) { // if we successfully derived a type for this node
 				if (!(paramStatus.type->instantiable)) { // if the derived type is not instantiable, flag an error
-					Token curToken = cur->t; // Param
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"parameterized non-instantiable node '"<<cur->child->child<<"'"); // NonArrayedIdentifier
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter type is "<<paramStatus<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter identifier is '"<<cur->child->next->t.s<<"')");
+					Token curToken = cur->t(); // Param
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"parameterized non-instantiable node '"<<cur->child->child<<"'"); // NonArrayedIdentifier
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter type is "<<paramStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter identifier is '"<<cur->child->next->t().s()<<"')");
 					failed = true;
 				}
 			} else { // else if we failed to derive a type for this node
@@ -1864,10 +2240,10 @@ TypeStatus getStatusParamList(Tree *tree, const TypeStatus &inStatus) {
 					list.push_back((((TypeList *)(inStatus.type))->list[list.size()])->copy());
 				} else { // else if the incoming type list is too short, flag an error
 					list.push_back(errType);
-					Token curToken = cur->t; // Param
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"auto-typed parameter in list with not enough incoming values"); // NonArrayedIdentifier
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<inStatus<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter identifier is '"<<cur->child->next->t.s<<"')");
+					Token curToken = cur->t(); // Param
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"auto-typed parameter in list with not enough incoming values"); // NonArrayedIdentifier
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<inStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter identifier is '"<<cur->child->next->t().s()<<"')");
 					failed = true;
 				}
 			} else if (*inStatus != *nullType) { // else if there is a valid single non-null incoming type
@@ -1875,24 +2251,24 @@ TypeStatus getStatusParamList(Tree *tree, const TypeStatus &inStatus) {
 					list.push_back(inStatus.type->copy());
 				} else { // else if this a subsequent parameter in the list, there are too many parameters
 					list.push_back(errType);
-					Token curToken = cur->t; // Param
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"auto-typed parameter in list with single incoming value"); // NonArrayedIdentifier
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<inStatus<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter identifier is '"<<cur->child->next->t.s<<"')");
+					Token curToken = cur->t(); // Param
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"auto-typed parameter in list with single incoming value"); // NonArrayedIdentifier
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<inStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter identifier is '"<<cur->child->next->t().s()<<"')");
 					failed = true;
 				}
 			} else { // else if the incoming type is null, flag an error
 				list.push_back(errType);
-				Token curToken = cur->t; // Param
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"auto-typed parameter with no incoming value"); // NonArrayedIdentifier
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<inStatus<<")");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (parameter identifier is '"<<cur->child->next->t.s<<"')");
+				Token curToken = cur->t(); // Param
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"auto-typed parameter with no incoming value"); // NonArrayedIdentifier
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<inStatus<<")");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (parameter identifier is '"<<cur->child->next->t().s()<<"')");
 				failed = true;
 				failed = true;
 			}
 		}
 		// log the parameter's type in the Param tree node
-		cur->status.type = list.back();
+		cur->status().type = list.back();
 	}
 	if (!failed) { // if we managed to derive types for all of the parameters, return a TypeList containing them
 		returnType(new TypeList(list));
@@ -1907,20 +2283,18 @@ TypeStatus getStatusInstantiationSource(Tree *tree, const TypeStatus &inStatus)
 	if (*tree == TOKEN_BlankInstantiationSource) { // if it's a blank slot instantiation 
 		returnStatus(getStatusType(tree, inStatus)); // BlankInstantiationSource (compatible in this form as a Type)
 	} else if (*tree == TOKEN_SingleInitInstantiationSource) { // else if it's a regular single-initialized instantiation
-		TypeStatus mutableIdStatus = getStatusType(tree, inStatus); // SingleInitInstantiationSource (compatible in this form as a Type)
-		mutableIdStatus.type = mutableIdStatus.type->copy();
-		mutableIdStatus.type->latchize();
-		returnStatus(mutableIdStatus);
+		TypeStatus idStatus = getStatusType(tree, inStatus); // SingleInitInstantiationSource (compatible in this form as a Type)
+		idStatus.type = idStatus.type->latchized();
+		returnStatus(idStatus);
 	} else if (*tree == TOKEN_MultiInitInstantiationSource) { // else if it's a regular multi-initialized instantiation
 		TypeStatus mutableIdStatus = getStatusType(tree, inStatus); // MultiInitInstantiationSource (compatible in this form as a Type)
 		mutableIdStatus.type = mutableIdStatus.type->copy();
 		mutableIdStatus.type->poolize(tree->child->next->child->child); // LSQUARE
 		returnStatus(mutableIdStatus);
 	} else if (*tree == TOKEN_SingleFlowInitInstantiationSource) { // else if it's a single flow-style instantiation
-		TypeStatus mutableIdStatus = getStatusType(tree->child->next, inStatus); // SingleInitInstantiationSource (compatible in this form as a Type)
-		mutableIdStatus.type = mutableIdStatus.type->copy();
-		mutableIdStatus.type->latchize();
-		returnStatus(mutableIdStatus);
+		TypeStatus idStatus = getStatusType(tree->child->next, inStatus); // SingleInitInstantiationSource (compatible in this form as a Type)
+		idStatus.type = idStatus.type->latchized();
+		returnStatus(idStatus);
 	} else if (*tree == TOKEN_MultiFlowInitInstantiationSource) { // else if it's a multi flow-style instantiation
 		TypeStatus mutableIdStatus = getStatusType(tree->child->next, inStatus); // MultiInitInstantiationSource (compatible in this form as a Type)
 		mutableIdStatus.type = mutableIdStatus.type->copy();
@@ -1963,10 +2337,10 @@ unsigned int decodeInitializerList(Tree *tree, deque<unsigned int> *depthList, c
 				}
 				if (!objectOutstructorFound) { // if the special case failed, try a direct compatibility
 					if (!(*initializerStatus >> *instantiationStatus)) { // if the initializer is incompatible, throw an error
-						Token curToken = initializer->t; // Exp
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"incompatible initializer in list");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (instantiation type is "<<instantiationStatus<<")");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (initializer type is "<<initializerStatus<<")");
+						Token curToken = initializer->t(); // Exp
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incompatible initializer in list");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (instantiation type is "<<instantiationStatus<<")");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (initializer type is "<<initializerStatus<<")");
 						failed = true;
 					}
 				}
@@ -1992,10 +2366,10 @@ unsigned int decodeInitializerList(Tree *tree, deque<unsigned int> *depthList, c
 			unsigned int thisCbeBreadth = decodeInitializerList(cbe, depthList, instantiationStatus, inStatus, (last && (cbe->next == NULL)));
 			if (thisCbeBreadth != firstCbeBreadth) { // if a this breadth analysis differs from the first one
 				if (firstCbeBreadth != 0 && thisCbeBreadth != 0) { // if neither breadth analysis was a failure, flag a breadth mismatch error
-					Token curToken = cbe->t; // CurlyBracketedExp
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"initializer list is jagged");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (found "<<thisCbeBreadth<<" elements)");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected "<<firstCbeBreadth<<" elements)");
+					Token curToken = cbe->t(); // CurlyBracketedExp
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"initializer list is jagged");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (found "<<thisCbeBreadth<<" elements)");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected "<<firstCbeBreadth<<" elements)");
 					failed = true;
 				} else if (firstCbeBreadth == 0 /* && thisCbeBreadth != 0 */) { // else if our first breadth analysis failed but this one didn't, log this one as the new first one
 					firstCbeBreadth = thisCbeBreadth;
@@ -2022,10 +2396,10 @@ TypeStatus getStatusInstantiation(Tree *tree, const TypeStatus &inStatus) {
 	TypeStatus instantiationStatus = getStatusInstantiationSource(is, inStatus); // BlankInstantiationSource or CopyInstantiationSource
 	if (*instantiationStatus) { // if we successfully derived a type for the instantiation
 		if (!(instantiationStatus.type->instantiable)) { // if we are instantiating an uninstantiable node, flag an error
-			Token curToken = is->t; // InstantiationSource
+			Token curToken = is->t(); // InstantiationSource
 			Tree *identifier = (*(is->child) == TOKEN_NonArrayedIdentifier) ? is->child: is->child->next;// NonArrayedIdentifier or ArrayedIdentifier
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"instantiation of non-instantiable node '"<<identifier<<"'"); 
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<instantiationStatus<<")");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"instantiation of non-instantiable node '"<<identifier<<"'"); 
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<instantiationStatus<<")");
 			returnTypeRet(errType, NULL);
 		}
 		if ((is->next->next == NULL || *(is->next->next->child->next) == TOKEN_RBRACKET) && *(is->child) != TOKEN_RARROW) { // if we're doing default initialization
@@ -2033,10 +2407,10 @@ TypeStatus getStatusInstantiation(Tree *tree, const TypeStatus &inStatus) {
 				if (((ObjectType *)(instantiationStatus.type))->isNullInstantiable()) {
 					returnStatus(instantiationStatus);
 				} else {
-					Token curToken = is->t; // InstantiationSource
+					Token curToken = is->t(); // InstantiationSource
 					Tree *identifier = (*(is->child) == TOKEN_NonArrayedIdentifier) ? is->child: is->child->next;// NonArrayedIdentifier or ArrayedIdentifier
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"null instantiation of non-null-instantiable node '"<<identifier<<"'"); 
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<instantiationStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"null instantiation of non-null-instantiable node '"<<identifier<<"'"); 
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<instantiationStatus<<")");
 					returnTypeRet(errType, NULL);
 				}
 			} else { // else if we're default instantiating a non-object, just return the type of the instantiation
@@ -2065,10 +2439,10 @@ TypeStatus getStatusInstantiation(Tree *tree, const TypeStatus &inStatus) {
 					mutableInstantiationType->erase(); // delete the temporary instantiation comparison type
 					returnStatus(instantiationStatus);
 				} else { // else if the initializer is incompatible, throw an error
-					Token curToken = is->child->next->t; // SingleInitInstantiationSource or MultiInitInstantiationSource
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"incompatible initialization of flow instantiation");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (instantiation type is "<<mutableInstantiationType<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<inStatus<<")");
+					Token curToken = is->child->next->t(); // SingleInitInstantiationSource or MultiInitInstantiationSource
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incompatible initialization of flow instantiation");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (instantiation type is "<<mutableInstantiationType<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<inStatus<<")");
 					mutableInstantiationType->erase(); // delete the temporary instantiation comparison type
 				}
 			} else /* if (*(is->child->next) == TOKEN_SingleAccessor) */ { // else if it's a clone-based initialization
@@ -2099,10 +2473,10 @@ TypeStatus getStatusInstantiation(Tree *tree, const TypeStatus &inStatus) {
 					mutableInstantiationType->erase(); // delete the temporary instantiation comparison type
 					returnStatus(instantiationStatus);
 				} else { // else if the initializer is incompatible, throw an error
-					Token curToken = initializer->t; // BracketedExp
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"incompatible initializer");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (instantiation type is "<<mutableInstantiationType<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (initializer type is "<<initializerStatus<<")");
+					Token curToken = initializer->t(); // BracketedExp
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incompatible initializer");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (instantiation type is "<<mutableInstantiationType<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (initializer type is "<<initializerStatus<<")");
 					mutableInstantiationType->erase(); // delete the temporary instantiation comparison type
 				}
 			}
@@ -2112,7 +2486,7 @@ TypeStatus getStatusInstantiation(Tree *tree, const TypeStatus &inStatus) {
 				TypeStatus mutableInstantiationStatus = instantiationStatus;
 				mutableInstantiationStatus.type = mutableInstantiationStatus.type->copy();
 				mutableInstantiationStatus.type->depth = depthList->size();
-				mutableInstantiationStatus.type->poolize(new Tree(depthList)); // use the depthList as the pool size expression
+				mutableInstantiationStatus.type->poolize(new (curSemmerTreeArena()) Tree(curSemmerTreeArena(), depthList)); // use the depthList as the pool size expression
 				returnStatus(mutableInstantiationStatus);
 			} else { // else if we failed to decode the initializer list depths, delete the allocated depthList
 				delete depthList;
@@ -2156,17 +2530,16 @@ TypeStatus getStatusTypedStaticTerm(Tree *tree, const TypeStatus &inStatus) {
 				Tree *tstcc = tstc->child;
 				if ((*tstcc == TOKEN_NonArrayedIdentifier || *tstcc == TOKEN_ArrayedIdentifier) &&
 						!(nodeStatus->category == CATEGORY_FILTERTYPE && nodeStatus->suffix == SUFFIX_LATCH) && nodeStatus.type != stdBoolLitType) { // if the Node needs to be constantized
-					// first, copy the Type so that our mutations don't propagate to the StaticTerm
-					TypeStatus mutableNodeStatus = nodeStatus;
-					mutableNodeStatus.type = mutableNodeStatus.type->copy();
-					mutableNodeStatus->constantize();
-					returnStatus(mutableNodeStatus);
+					// derive a constantized Type rather than mutating the one that belongs to the StaticTerm
+					TypeStatus constantNodeStatus = nodeStatus;
+					constantNodeStatus.type = constantNodeStatus.type->constantized();
+					returnStatus(constantNodeStatus);
 				} else { // else if the node doesn't need to be constantized, just return the nodeStatus
 					returnStatus(nodeStatus);
 				}
 			} else { // else if it's a standard node that we can't use an access operator on, flag an error
-				Token curToken = tstc->child->child->t; // guaranteed to be ID, since only NonArrayedIdentifier or ArrayedIdentifier nodes generate inoperable types
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"reference to non-referensible node '"<<tstc->child<<"'");
+				Token curToken = tstc->child->child->t(); // guaranteed to be ID, since only NonArrayedIdentifier or ArrayedIdentifier nodes generate inoperable types
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"reference to non-referensible node '"<<tstc->child<<"'");
 			}
 		}
 	} else if (*tstc == TOKEN_BracketedExp) { // else if it's an expression
@@ -2175,9 +2548,9 @@ TypeStatus getStatusTypedStaticTerm(Tree *tree, const TypeStatus &inStatus) {
 			if (expStatus.type->suffix != SUFFIX_LIST && expStatus.type->suffix != SUFFIX_STREAM) { // if the type isn't inherently dynamic, return the status normally
 				returnStatus(expStatus);
 			} else { // else if the type is inherently dynamic, flag an error
-				Token curToken = tstc->child->t; // LBRACKET
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"expression returns dynamic type");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expression type is "<<expStatus<<")");
+				Token curToken = tstc->child->t(); // LBRACKET
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"expression returns dynamic type");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expression type is "<<expStatus<<")");
 			}
 		}
 	}
@@ -2192,16 +2565,16 @@ TypeStatus getStatusAccess(Tree *tree, const TypeStatus &inStatus) {
 	TypeStatus nodeStatus = getStatusNode(tree->child->next, inStatus); // Node
 	if (*nodeStatus) { // if we managed to derive a type for the subnode
 		if (!(nodeStatus->referensible)) { // else if it's a standard node that we can't use an access operator on, flag an error
-			Token curToken = tree->child->child->t; // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"access of immutable node '"<<tree->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<nodeStatus<<")");
+			Token curToken = tree->child->child->t(); // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"access of immutable node '"<<tree->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<nodeStatus<<")");
 		} else if (nodeStatus.type == stdBoolLitType) { // else if it's an access of a standard literal, flag an error
-			Token curToken = tree->child->child->t; // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"access of immutable literal '"<<tree->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+			Token curToken = tree->child->child->t(); // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"access of immutable literal '"<<tree->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
 		} else if (nodeStatus.type->category == CATEGORY_STDTYPE && !(((StdType *)(nodeStatus.type))->isComparable())) { // else if it's an access of an incomparable StdType, flag an error
-			Token curToken = tree->child->child->t; // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"access of immutable standard node");
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<nodeStatus<<")");
+			Token curToken = tree->child->child->t(); // SLASH, SSLASH, ASLASH, DSLASH, DSSLASH, or DASLASH
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"access of immutable standard node");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<nodeStatus<<")");
 		} else { // else if it's an otherwise acceptable access, attempt it
 			// copy the Type so that our mutations don't propagate to the Node
 			TypeStatus mutableNodeStatus = nodeStatus;
@@ -2212,27 +2585,27 @@ TypeStatus getStatusAccess(Tree *tree, const TypeStatus &inStatus) {
 				if (mutableNodeStatus.type->delatch()) {
 					returnStatus(mutableNodeStatus);
 				} else {
-					Token curToken = accessorc->t; // SLASH, DSLASH, or LSQUARE
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"delatch of incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<nodeStatus<<")");
+					Token curToken = accessorc->t(); // SLASH, DSLASH, or LSQUARE
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"delatch of incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<nodeStatus<<")");
 					mutableNodeStatus.type->erase();
 				}
 			} else if (*accessorc == TOKEN_DSLASH) {
 				if (mutableNodeStatus.type->destream()) {
 					returnStatus(mutableNodeStatus);
 				} else {
-					Token curToken = accessorc->t; // SLASH, DSLASH, or LSQUARE
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"destream of incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<nodeStatus<<")");
+					Token curToken = accessorc->t(); // SLASH, DSLASH, or LSQUARE
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"destream of incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<nodeStatus<<")");
 					mutableNodeStatus.type->erase();
 				}
 			} else /* if (*accessorc == TOKEN_LSQUARE) */ {
 				if (mutableNodeStatus.type->delist()) {
 					returnStatus(mutableNodeStatus);
 				} else {
-					Token curToken = accessorc->t; // SLASH, DSLASH, or LSQUARE
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"delist of incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<nodeStatus<<")");
+					Token curToken = accessorc->t(); // SLASH, DSLASH, or LSQUARE
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"delist of incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<nodeStatus<<")");
 					mutableNodeStatus.type->erase();
 				}
 			}
@@ -2278,9 +2651,9 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 		if (packedStatus->pack()) { // if we managed to pack the type, proceed normally
 			returnStatus(packedStatus);
 		} else { // else if we failed to pack the type, erase the copied type and flag an error
-			Token curToken = dtc->child->t; // RFLAG
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"incoming type cannot be packed");
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<inStatus<<")");
+			Token curToken = dtc->child->t(); // RFLAG
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incoming type cannot be packed");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<inStatus<<")");
 			packedStatus->erase();
 		}
 	} else if (*dtc == TOKEN_Unpack) {
@@ -2289,9 +2662,9 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 		if (unpackedStatus->unpack()) { // if we managed to unpack the type, proceed normally
 			returnStatus(unpackedStatus);
 		} else { // else if we failed to unpack the type, erase the copied type and flag an error
-			Token curToken = dtc->child->t; // LFLAG
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"incoming type cannot be unpacked");
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (type is "<<inStatus<<")");
+			Token curToken = dtc->child->t(); // LFLAG
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incoming type cannot be unpacked");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (type is "<<inStatus<<")");
 			unpackedStatus->erase();
 		}
 	} else if (*dtc == TOKEN_Link) {
@@ -2301,44 +2674,44 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 			if (*linkType) { // if the types are link-compatible, return the resulting type
 				returnTypeRet(linkType, inStatus.retType);
 			} else {
-				Token curToken = dtc->child->t; // DCOLON
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"link with incompatible type");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<inStatus<<")");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (link type is "<<linkStatus<<")");
+				Token curToken = dtc->child->t(); // DCOLON
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"link with incompatible type");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<inStatus<<")");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (link type is "<<linkStatus<<")");
 			}
 		}
 	} else if (*dtc == TOKEN_Loopback) {
-		SymbolTree *enclosingEnv = dtc->env;
+		SymbolTree *enclosingEnv = dtc->env();
 		if (enclosingEnv->kind == KIND_BLOCK && enclosingEnv->parent != NULL) {
 			SymbolTree *enclosingParent = enclosingEnv->parent;
 			if (enclosingParent->kind == KIND_FILTER) {
-				FilterType *enclosingType = (FilterType *)(enclosingParent->defSite->status.type);
+				FilterType *enclosingType = (FilterType *)(enclosingParent->defSite->status().type);
 				if ((*inStatus == *nullType && *(enclosingType->from()) == *nullType) || (*inStatus >> *(enclosingType->from()))) {
 					if (enclosingType->to() == NULL) {
-						Token curToken = dtc->child->t; // LARROW
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"irresolvable implicit loopback return type");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (incoming type is "<<enclosingType->from()<<")");
+						Token curToken = dtc->child->t(); // LARROW
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"irresolvable implicit loopback return type");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (incoming type is "<<enclosingType->from()<<")");
 					} else if (enclosingType->to()->list.size() == 1) {
 						returnTypeRet(enclosingType->to()->list[0], inStatus.retType);
 					} else {
 						returnTypeRet(enclosingType->to(), inStatus.retType);
 					}
 				} else {
-					Token curToken = dtc->child->t; // LARROW
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"loopback of unexpected type "<<inStatus);
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<enclosingType->from()<<")");
+					Token curToken = dtc->child->t(); // LARROW
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"loopback of unexpected type "<<inStatus);
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<enclosingType->from()<<")");
 				}
 			} else if (enclosingParent->kind == KIND_INSTRUCTOR) {
-				TypeList *enclosingType = (TypeList *)(enclosingParent->defSite->status.type);
+				TypeList *enclosingType = (TypeList *)(enclosingParent->defSite->status().type);
 				if (*inStatus >> *enclosingType) {
 					returnTypeRet(nullType, inStatus.retType);
 				} else {
-					Token curToken = dtc->child->t; // LARROW
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"loopback of unexpected type "<<inStatus);
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<enclosingType<<")");
+					Token curToken = dtc->child->t(); // LARROW
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"loopback of unexpected type "<<inStatus);
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<enclosingType<<")");
 				}
 			} else if (enclosingParent->kind == KIND_OUTSTRUCTOR) {
-				TypeList *enclosingType = (TypeList *)(enclosingParent->defSite->status.type);
+				TypeList *enclosingType = (TypeList *)(enclosingParent->defSite->status().type);
 				if (*inStatus == *nullType) {
 					if (enclosingType->list.size() == 1) {
 						returnTypeRet(enclosingType->list[0], inStatus.retType);
@@ -2346,14 +2719,14 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 						returnTypeRet(enclosingType, inStatus.retType);
 					}
 				} else {
-					Token curToken = dtc->child->t; // LARROW
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"loopback of unexpected type "<<inStatus);
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<enclosingType<<")");
+					Token curToken = dtc->child->t(); // LARROW
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"loopback of unexpected type "<<inStatus);
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<enclosingType<<")");
 				}
 			}
 		} else {
-			Token curToken = dtc->child->t; // LARROW
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"loopback outside of a filter block");
+			Token curToken = dtc->child->t(); // LARROW
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"loopback outside of a filter block");
 		}
 	} else if (*dtc == TOKEN_Send) {
 		TypeStatus nodeStatus = getStatusNode(dtc->child->next, inStatus);
@@ -2363,18 +2736,18 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 				if (*inStatus >> *nodeStatus) { // if the Send is valid, proceed normally
 					returnType(nullType);
 				} else { // else if the Send is invalid, flag an error
-					Token curToken = dtc->child->t; // RARROW
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"send to incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (source type is "<<inStatus<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (destination type is "<<nodeStatus<<")");
+					Token curToken = dtc->child->t(); // RARROW
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"send to incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (source type is "<<inStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (destination type is "<<nodeStatus<<")");
 				}
 			} else if (!(nodeStatus->referensible)) { // else if it's a standard node that we can't use an access operator on, flag an error
-				Token curToken = dtc->child->t; // RARROW
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"send to immutable node '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<nodeStatus<<")");
+				Token curToken = dtc->child->t(); // RARROW
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"send to immutable node '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<nodeStatus<<")");
 			} else /* if (nodeStatus.type == stdBoolLitType) */ { // else if it's an access of a standard literal, flag an error
-				Token curToken = dtc->child->t; // RARROW
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"send to immutable literal '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+				Token curToken = dtc->child->t(); // RARROW
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"send to immutable literal '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
 			}
 		}
 	} else if (*dtc == TOKEN_Swap) {
@@ -2385,18 +2758,18 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 				if (*inStatus >> *nodeStatus) { // if the Swap is valid, proceed normally
 					returnType(nodeStatus.type);
 				} else { // else if the Send is invalid, flag an error
-					Token curToken = dtc->child->t; // RARROW
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"swap with incompatible type");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (source type is "<<inStatus<<")");
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (destination type is "<<nodeStatus<<")");
+					Token curToken = dtc->child->t(); // RARROW
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"swap with incompatible type");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (source type is "<<inStatus<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (destination type is "<<nodeStatus<<")");
 				}
 			} else if (!(nodeStatus->referensible)) { // else if it's a standard node that we can't use an access operator on, flag an error
-				Token curToken = dtc->child->t; // LRARROW
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"swap with immutable node '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (node type is "<<nodeStatus<<")");
+				Token curToken = dtc->child->t(); // LRARROW
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"swap with immutable node '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (node type is "<<nodeStatus<<")");
 			} else /* if (nodeStatus.type == stdBoolLitType) */ { // else if it's an access of a standard literal, flag an error
-				Token curToken = dtc->child->t; // LRARROW
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"swap with immutable literal '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
+				Token curToken = dtc->child->t(); // LRARROW
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"swap with immutable literal '"<<dtc->child->next->child<<"'"); // NonArrayedIdentifier or ArrayedIdentifier
 			}
 		}
 	} else if (*dtc == TOKEN_Return) {
@@ -2411,12 +2784,12 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 			if (*thisRetType >> *knownRetType) { // if the cast succeeded, use the new return type
 				returnTypeRet(nullType, thisRetType);
 			} else { // else if this return type conflicts with the known one, flag an error
-				Token curToken = dtc->child->t; // DRARROW
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"return of unexpected type "<<thisRetType);
+				Token curToken = dtc->child->t(); // DRARROW
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"return of unexpected type "<<thisRetType);
 				if (*knownRetType == *errType) {
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (not expecting a return here)");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (not expecting a return here)");
 				} else {
-					semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (expected type is "<<knownRetType<<")");
+					semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (expected type is "<<knownRetType<<")");
 				}
 			}
 		} else { // else if there is no return type logged, log this one and proceed normally
@@ -2439,10 +2812,10 @@ TypeStatus getStatusSwitchTerm(Tree *tree, const TypeStatus &inStatus) {
 			// derive the label's type
 			TypeStatus label = getStatusTypedStaticTerm(ltc, inStatus);
 			if (!(*label >> *inStatus)) { // if the type doesn't match, throw an error
-				Token curToken = ltc->t;
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"incompatible switch label");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (label type is "<<label<<")");
-				semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (input type is "<<inStatus<<")");
+				Token curToken = ltc->t();
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"incompatible switch label");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (label type is "<<label<<")");
+				semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (input type is "<<inStatus<<")");
 			}
 		}
 		// derive the to-type of this label
@@ -2460,11 +2833,11 @@ TypeStatus getStatusSwitchTerm(Tree *tree, const TypeStatus &inStatus) {
 		TypeStatus thisToStatus = toStatus[i];
 		if (!(thisToStatus->baseEquals(*firstToStatus) && *thisToStatus == *firstToStatus)) { // if the types don't match, throw an error
 			Tree *toTree = toTrees[i];
-			Token curToken1 = toTree->t;
-			Token curToken2 = firstToTree->t;
-			semmerError(curToken1.fileIndex,curToken1.row,curToken1.col,"inconsistent switch destination type");
-			semmerError(curToken1.fileIndex,curToken1.row,curToken1.col,"-- (this type is "<<thisToStatus<<")");
-			semmerError(curToken2.fileIndex,curToken2.row,curToken2.col,"-- (first type is "<<firstToStatus<<")");
+			Token curToken1 = toTree->t();
+			Token curToken2 = firstToTree->t();
+			semmerError(curToken1.fileIndex,curToken1.row(),curToken1.col(),"inconsistent switch destination type");
+			semmerError(curToken1.fileIndex,curToken1.row(),curToken1.col(),"-- (this type is "<<thisToStatus<<")");
+			semmerError(curToken2.fileIndex,curToken2.row(),curToken2.col(),"-- (first type is "<<firstToStatus<<")");
 			failed = true;
 		}
 	}
@@ -2493,9 +2866,9 @@ TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus) {
 	if (*inStatus == STD_BOOL) { // if what's coming in is a boolean
 		returnStatus(getStatusTerm(tree->child->next, TypeStatus(nullType, NULL)));
 	} else { // else if what's coming in isn't a boolean
-		Token curToken = tree->child->t; // QUESTION
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"non-boolean input to conditional");
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (input type is "<<inStatus<<")");
+		Token curToken = tree->child->t(); // QUESTION
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"non-boolean input to conditional");
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (input type is "<<inStatus<<")");
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -2525,18 +2898,18 @@ TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus)
 			if (*trueStatus == *falseStatus) { // if the two branches match in type
 				returnStatus(trueStatus);
 			} else { // else if the two branches don't match in type
-				Token curToken1 = tree->child->t; // QUESTION
-				Token curToken2 = trueBranchc->t; // SimpleTerm or ClosedCondTerm
-				Token curToken3 = falseBranchc->t; // SimpleTerm, ClosedCondTerm, SimpleCondTerm, or ClosedCondTerm
-				semmerError(curToken1.fileIndex,curToken1.row,curToken1.col,"type mismatch in conditional branches");
-				semmerError(curToken2.fileIndex,curToken2.row,curToken2.col,"-- (true branch type is "<<trueStatus<<")");
-				semmerError(curToken3.fileIndex,curToken3.row,curToken3.col,"-- (false branch type is "<<falseStatus<<")");
+				Token curToken1 = tree->child->t(); // QUESTION
+				Token curToken2 = trueBranchc->t(); // SimpleTerm or ClosedCondTerm
+				Token curToken3 = falseBranchc->t(); // SimpleTerm, ClosedCondTerm, SimpleCondTerm, or ClosedCondTerm
+				semmerError(curToken1.fileIndex,curToken1.row(),curToken1.col(),"type mismatch in conditional branches");
+				semmerError(curToken2.fileIndex,curToken2.row(),curToken2.col(),"-- (true branch type is "<<trueStatus<<")");
+				semmerError(curToken3.fileIndex,curToken3.row(),curToken3.col(),"-- (false branch type is "<<falseStatus<<")");
 			}
 		}
 	} else { // else if what's coming in isn't a boolean
-		Token curToken = tree->child->t; // QUESTION
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"non-boolean input to conditional operator");
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (input type is "<<inStatus<<")");
+		Token curToken = tree->child->t(); // QUESTION
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"non-boolean input to conditional operator");
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (input type is "<<inStatus<<")");
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -2544,18 +2917,15 @@ TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus)
 
 TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
-	Tree *tc = tree->child;
-	if (*tc != TOKEN_DynamicTerm) { // if it's not a DynamicTerm
-		Tree *tcc = tree->child->child;
-		if (*tcc == TOKEN_SimpleTerm) {
-			returnStatus(getStatusSimpleTerm(tcc, inStatus));
-		} else if (*tcc == TOKEN_SimpleCondTerm) {
-			returnStatus(getStatusSimpleCondTerm(tcc, inStatus));
-		} else if (*tcc == TOKEN_ClosedCondTerm || *tcc == TOKEN_OpenCondTerm) {
-			returnStatus(getStatusOpenOrClosedCondTerm(tcc, inStatus));
-		}
-	} else { // else if it's a DynamicTerm
-		returnStatus(getStatusDynamicTerm(tc, inStatus));
+	AstTerm *term = tree->ast();
+	if (term->kind == TERM_DYNAMIC) {
+		returnStatus(getStatusDynamicTerm(term->dispatch, inStatus));
+	} else if (term->kind == TERM_SIMPLE_COND) {
+		returnStatus(getStatusSimpleCondTerm(term->dispatch, inStatus));
+	} else if (term->kind == TERM_CLOSED_COND || term->kind == TERM_OPEN_COND) {
+		returnStatus(getStatusOpenOrClosedCondTerm(term->dispatch, inStatus));
+	} else { // else if it's a SimpleTerm
+		returnStatus(getStatusSimpleTerm(term->dispatch, inStatus));
 	}
 	GET_STATUS_CODE;
 	GET_STATUS_FOOTER;
@@ -2566,24 +2936,21 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	// scan the pipe left to right
 	TypeStatus curStatus = inStatus;
-	Tree *curTerm;
-	Tree *prevTerm;
-	for (curTerm = prevTerm = tree->child; curTerm != NULL; prevTerm = curTerm, curTerm = curTerm->next->child) {
+	AstTerm *curTerm;
+	AstTerm *prevTerm;
+	for (curTerm = prevTerm = tree->child->ast(); curTerm != NULL; prevTerm = curTerm, curTerm = curTerm->next) {
 		// derive a type for the next term in the sequence
-		TypeStatus nextTermStatus = getStatusTerm(curTerm, curStatus);
+		TypeStatus nextTermStatus = getStatusTerm(curTerm->term, curStatus);
 		if (*nextTermStatus) { // if we managed to derive a type for this term
-			if (*(curTerm->child->child) == TOKEN_SimpleTerm &&
-					*(curTerm->child->child->child) == TOKEN_StaticTerm &&
-					*(curTerm->child->child->child->child->child) == TOKEN_Node &&
-					*(curTerm->child->child->child->child->child->child) != TOKEN_Instantiation) { // if it's a flow-through Term
+			if (curTerm->isFlowThrough()) { // if it's a flow-through Term
 				pair<Type *, bool> stdFlowResult(errType, false);
 				if (nextTermStatus->category == CATEGORY_STDTYPE) { // if this Term's type is a STDTYPE, try to derive a three-term exceptional type for it
-					stdFlowResult = ((StdType *)(nextTermStatus.type))->stdFlowDerivation(curStatus, curTerm->next->child);
+					stdFlowResult = ((StdType *)(nextTermStatus.type))->stdFlowDerivation(curStatus, curTerm->next);
 				}
 				if (*(stdFlowResult.first)) { // if we managed to derive a three-term exceptional type for this term
 					curStatus = TypeStatus(stdFlowResult.first, nextTermStatus); // log the three-term exceptional type as the current status
 					if (stdFlowResult.second) { // if we used a third term for the derivation, advance curTerm past it
-						curTerm = curTerm->next->child;
+						curTerm = curTerm->next;
 					}
 				} else if (*curStatus == *nullType &&
 						nextTermStatus.type->category == CATEGORY_FILTERTYPE && *(((FilterType *)(nextTermStatus.type))->from()) == *nullType) { // else if this is a generator invocation
@@ -2593,11 +2960,11 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 					// derive a type for the flow of the current type into the next term in the sequence
 					Type *flowResult = (*curStatus , *nextTermStatus);
 					if (flowResult == NULL) { // if the flow result was implicit (NULL), flag an error
-						Token curToken = curTerm->t; // Term
-						Token prevToken = prevTerm->t; // Term
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"irresolvable implicit filter return type");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (term's type is "<<nextTermStatus<<")");
-						semmerError(prevToken.fileIndex,prevToken.row,prevToken.col,"-- (incoming type is "<<curStatus<<")");
+						Token curToken = curTerm->term->t(); // Term
+						Token prevToken = prevTerm->term->t(); // Term
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"irresolvable implicit filter return type");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (term's type is "<<nextTermStatus<<")");
+						semmerError(prevToken.fileIndex,prevToken.row(),prevToken.col(),"-- (incoming type is "<<curStatus<<")");
 						// short-circuit the derivation of this NonEmptyTerms
 						curStatus = errType;
 						break;
@@ -2606,11 +2973,11 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 					} else if (*curStatus == *nullType) { // else if the flow is not valid, but the incoming type is null, treat it as a value injection
 						curStatus = nextTermStatus;
 					} else { // else if the type flow is not valid and the incoming type is not null, flag an error
-						Token curToken = curTerm->t; // Term
-						Token prevToken = prevTerm->t; // Term
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"term does not accept incoming type");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (term's type is "<<nextTermStatus<<")");
-						semmerError(prevToken.fileIndex,prevToken.row,prevToken.col,"-- (incoming type is "<<curStatus<<")");
+						Token curToken = curTerm->term->t(); // Term
+						Token prevToken = prevTerm->term->t(); // Term
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"term does not accept incoming type");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (term's type is "<<nextTermStatus<<")");
+						semmerError(prevToken.fileIndex,prevToken.row(),prevToken.col(),"-- (incoming type is "<<curStatus<<")");
 						// short-circuit the derivation of this NonEmptyTerms
 						curStatus = errType;
 						break;
@@ -2620,9 +2987,9 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 				curStatus = nextTermStatus;
 			}
 		} else { // otherwise, if we failed to derive a type for this term, flag an error
-			Token curToken = curTerm->t;
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"cannot resolve term's output type");
-			semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (input type is "<<curStatus<<")");
+			Token curToken = curTerm->term->t(); // Term
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"cannot resolve term's output type");
+			semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (input type is "<<curStatus<<")");
 			// short-circuit the derivation for this NonEmptyTerms
 			curStatus = errType;
 			break;
@@ -2640,10 +3007,10 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 TypeStatus getStatusDeclaration(Tree *tree) {
 	GET_STATUS_HEADER;
 	// check if this is a recursive invocation
-	Type *&fakeRetType = tree->status.retType;
+	Type *&fakeRetType = tree->status().retType;
 	if (fakeRetType != NULL) { // if we previously logged a recursion alert here (and we don't have a memoized type to return), flag an ill-formed recursion error
-		Token curToken = tree->child->t;
-		semmerError(curToken.fileIndex,curToken.row,curToken.col,"irresolvable recursive definition of '"<<curToken.s<<"'");
+		Token curToken = tree->child->t();
+		semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"irresolvable recursive definition of '"<<curToken.s()<<"'");
 	} else { // else if there is no recursion alert for this Declaration
 		// flag a recursion alert for this Declaration and proceed normally
 		fakeRetType = errType;
@@ -2653,7 +3020,7 @@ TypeStatus getStatusDeclaration(Tree *tree) {
 			if (*(declarationSub->child->child) == TOKEN_Filter) {
 				TypeStatus derivedStatus = getStatusFilter(declarationSub->child->child); // blindly generates a thunk; never fails
 				// log the derived type as the return value of this declaration
-				Type *&fakeType = tree->status.type;
+				Type *&fakeType = tree->status().type;
 				fakeType = derivedStatus.type;
 				// verify the internal contents of the filter
 				TypeStatus verifiedStatus = verifyStatusFilter(declarationSub->child->child);
@@ -2665,7 +3032,7 @@ TypeStatus getStatusDeclaration(Tree *tree) {
 			} else if (*(declarationSub->child->child) == TOKEN_Object) {
 				TypeStatus derivedStatus = getStatusObject(declarationSub->child->child); // blindly generates a thunk; never fails
 				// log the derived type as the return value of this declaration
-				Type *&fakeType = tree->status.type;
+				Type *&fakeType = tree->status().type;
 				fakeType = derivedStatus.type;
 				// verify the internal contents of the object
 				TypeStatus verifiedStatus = verifyStatusObject(declarationSub->child->child);
@@ -2685,9 +3052,9 @@ TypeStatus getStatusDeclaration(Tree *tree) {
 					if (derivedStatus.type->category != CATEGORY_TYPELIST) { // if the derived type is not a TypeList, simply return it 
 						returnTypeRet(derivedStatus, NULL);
 					} else { // else if the derived type is a TypeList, flag an error
-						Token curToken = tree->t; // Declaration
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"declaration of compound-typed identifier '"<<tree->child->t.s<<"'");
-						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (identifier type is "<<derivedStatus<<")");
+						Token curToken = tree->t(); // Declaration
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"declaration of compound-typed identifier '"<<tree->child->t().s()<<"'");
+						semmerError(curToken.fileIndex,curToken.row(),curToken.col(),"-- (identifier type is "<<derivedStatus<<")");
 					}
 				}
 			} else if (*declarationSub == TOKEN_BlankInstantiation) { // else if it's a blank instantiation declaration
@@ -2727,13 +3094,234 @@ void semPipes(Tree *treeRoot) {
 	}
 }
 
+// SemUnit functions
+SemUnit::SemUnit(SymbolTree *root, SymbolTree *parent, Tree *pipe, unsigned int owner) : root(root), parent(parent), pipe(pipe), owner(owner), errorCode(0) {}
+SemUnit::~SemUnit() {}
+void SemUnit::run() {
+	semmerErrorStream = &errors;
+	semmerErrorCode = 0;
+	if (root != NULL) { // if this unit is a symbol tree node, derive it as semSt() would
+		getStatusSymbolTree(root, parent);
+	} else { // else if this unit is a top-level pipe, derive it as semPipes() would
+		getStatusPipe(pipe, TypeStatus(nullType, stdIntType));
+	}
+	errorCode = semmerErrorCode;
+}
+
+// SemWorker functions
+SemWorker::SemWorker() : arena(new TreeArena()) {}
+SemWorker::~SemWorker() {}
+
+// returns the index of the top-level pipe whose parse tree contains the given node, or noOwner if it's not in any of them
+unsigned int pipeOwner(const vector<vector<unsigned int> > &owners, Tree *tree, unsigned int noOwner) {
+	const TreeArena *arena = tree->arena();
+	if (arena->fileIndex < owners.size() && tree->id < owners[arena->fileIndex].size()) {
+		unsigned int owner = owners[arena->fileIndex][tree->id];
+		if (owner != UINT_MAX) {
+			return owner;
+		}
+	}
+	return noOwner;
+}
+
+// returns the representative of the given pipe's set in the union-find forest, halving the path along the way
+unsigned int findPipeSet(vector<unsigned int> &pipeSets, unsigned int pipe) {
+	while (pipeSets[pipe] != pipe) {
+		pipeSets[pipe] = pipeSets[pipeSets[pipe]];
+		pipe = pipeSets[pipe];
+	}
+	return pipe;
+}
+
+// merges the sets of the given pipes in the union-find forest; noOwner stands for the standard library and synthesized nodes, which don't join anything
+void joinPipeSets(vector<unsigned int> &pipeSets, unsigned int a, unsigned int b, unsigned int noOwner) {
+	if (a == noOwner || b == noOwner) {
+		return;
+	}
+	a = findPipeSet(pipeSets, a);
+	b = findPipeSet(pipeSets, b);
+	if (a != b) {
+		pipeSets[max(a, b)] = min(a, b);
+	}
+}
+
+bool largerComponent(const vector<SemUnit *> &a, const vector<SemUnit *> &b) {
+	return (a.size() > b.size());
+}
+
+vector<vector<SemUnit *> > semComponents; // the units of each independent component, each in serial order
+unsigned int nextSemComponent = 0; // the index of the next component that a worker thread should claim
+pthread_mutex_t nextSemComponentMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// worker thread body; keeps claiming unanalyzed components, deriving each one's units in order
+void *semWorkerThread(void *worker) {
+	semWorker = (SemWorker *)worker;
+	for(;;) {
+		// claim the next component
+		pthread_mutex_lock(&nextSemComponentMutex);
+		unsigned int i = nextSemComponent++;
+		pthread_mutex_unlock(&nextSemComponentMutex);
+		if (i >= semComponents.size()) { // if there are no more components, we're done
+			break;
+		}
+		// derive the component's units
+		for (vector<SemUnit *>::const_iterator unitIter = semComponents[i].begin(); unitIter != semComponents[i].end(); unitIter++) {
+			(*unitIter)->run();
+		}
+	}
+	semWorker = NULL;
+	return NULL;
+}
+
+// does the work of semSt() followed by semPipes() on a pool of numJobs threads (including the calling one)
+// top-level pipes that are linked by their bindings are grouped into components; different components share no mutable state, so they can be derived concurrently
+void semParallel(SymbolTree *stRoot, Tree *treeRoot) {
+	// number the top-level pipes, labeling each parse tree node with the pipe that it's in and logging the identifiers along the way
+	vector<Tree *> pipes;
+	vector<vector<unsigned int> > owners; // per file, the index of the top-level pipe that each node is in, or UINT_MAX if it's in none
+	vector<pair<Tree *, unsigned int> > identifiers; // identifier nodes and the pipes that they're in
+	for (Tree *programCur = treeRoot; programCur != NULL; programCur = programCur->next) {
+		for (Tree *pipeCur = programCur->child->child; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
+			unsigned int pipeIndex = pipes.size();
+			pipes.push_back(pipeCur);
+			TreeArena *arena = pipeCur->arena();
+			if (arena->fileIndex >= owners.size()) {
+				owners.resize(arena->fileIndex + 1);
+			}
+			vector<unsigned int> &fileOwners = owners[arena->fileIndex];
+			if (fileOwners.empty()) { // if this is the file's first pipe, set up its labels, and make sure that its semantic data table and line index are complete so that the threads only ever read them
+				fileOwners.resize(arena->numNodes(), UINT_MAX);
+				arena->sem(arena->numNodes() - 1);
+				inFiles[arena->fileIndex]->indexLines(); // error positions are looked up in it
+			}
+			fileOwners[pipeCur->id] = pipeIndex;
+			vector<Tree *> nodeStack;
+			if (pipeCur->child != NULL) {
+				nodeStack.push_back(pipeCur->child);
+			}
+			while (!nodeStack.empty()) {
+				Tree *cur = nodeStack.back();
+				nodeStack.pop_back();
+				fileOwners[cur->id] = pipeIndex;
+				if (*cur == TOKEN_NonArrayedIdentifier || *cur == TOKEN_ArrayedIdentifier) {
+					identifiers.push_back(make_pair(cur, pipeIndex));
+				}
+				if (cur->next != NULL) {
+					nodeStack.push_back(cur->next);
+				}
+				if (cur->child != NULL) {
+					nodeStack.push_back(cur->child);
+				}
+			}
+		}
+	}
+	unsigned int noOwner = pipes.size();
+	// link each pipe with the pipes defining the names that its identifiers latch onto
+	vector<unsigned int> pipeSets(pipes.size() + 1);
+	for (unsigned int i = 0; i < pipeSets.size(); i++) {
+		pipeSets[i] = i;
+	}
+	for (vector<pair<Tree *, unsigned int> >::const_iterator idIter = identifiers.begin(); idIter != identifiers.end(); idIter++) {
+		Token headToken = (*idIter).first->child->t(); // ID or DPERIOD; only the head matters, and decoding the whole identifier would check its subscripts
+		Atom head = atomTable.intern(headToken.str, headToken.len);
+		if (head != ATOM_RECALL) { // recalls bind to fake nodes typed by the incoming status, which don't link anything
+			SymbolTree *latch = findLatchPoint(head, (*idIter).first->env());
+			if (latch != NULL && latch->defSite != NULL) {
+				joinPipeSets(pipeSets, (*idIter).second, pipeOwner(owners, latch->defSite, noOwner), noOwner);
+			}
+		}
+	}
+	// walk the symbol tree in the same order as semSt(), logging its units and linking imported nodes with the pipes that they were imported into
+	vector<SemUnit *> units;
+	vector<pair<SymbolTree *, pair<SymbolTree *, unsigned int> > > workStack; // (node, (parent, enclosing pipe)) pairs left to visit
+	workStack.push_back(make_pair(stRoot, make_pair((SymbolTree *)NULL, noOwner)));
+	while (!workStack.empty()) {
+		SymbolTree *root = workStack.back().first;
+		SymbolTree *parent = workStack.back().second.first;
+		unsigned int context = workStack.back().second.second;
+		workStack.pop_back();
+		unsigned int owner = (root->defSite != NULL) ? pipeOwner(owners, root->defSite, noOwner) : noOwner;
+		if (owner == noOwner) { // if the node wasn't defined in any pipe, it belongs to the one enclosing it
+			owner = context;
+		} else { // else if the node was defined in a pipe, link it with the one enclosing it, which differ if the node was imported
+			joinPipeSets(pipeSets, owner, context, noOwner);
+		}
+		if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR) {
+			units.push_back(new SemUnit(root, parent, NULL, owner));
+		}
+		vector<SymbolTree *> childList = root->sortedChildren();
+		for (vector<SymbolTree *>::reverse_iterator iter = childList.rbegin(); iter != childList.rend(); iter++) {
+			workStack.push_back(make_pair(*iter, make_pair(root, (root == stRoot) ? noOwner : owner)));
+		}
+	}
+	// the pipes themselves come after all of the symbol tree nodes, as in semPipes()
+	for (unsigned int i = 0; i < pipes.size(); i++) {
+		units.push_back(new SemUnit(NULL, NULL, pipes[i], i));
+	}
+	// group the units into components, keeping them in order within each one
+	semComponents.clear();
+	vector<unsigned int> setComponents(pipeSets.size(), UINT_MAX); // the component of each set representative
+	for (vector<SemUnit *>::const_iterator unitIter = units.begin(); unitIter != units.end(); unitIter++) {
+		unsigned int set = findPipeSet(pipeSets, (*unitIter)->owner);
+		if (setComponents[set] == UINT_MAX) {
+			setComponents[set] = semComponents.size();
+			semComponents.push_back(vector<SemUnit *>());
+		}
+		semComponents[setComponents[set]].push_back(*unitIter);
+	}
+	// hand out the biggest components first, so that a long one doesn't hold up the end of the run
+	sort(semComponents.begin(), semComponents.end(), largerComponent);
+	// derive the components on the thread pool
+	unsigned int numWorkers = max(1, min(numJobs, (int)semComponents.size()));
+	vector<SemWorker *> workers;
+	for (unsigned int i = 0; i < numWorkers; i++) {
+		workers.push_back(new SemWorker());
+	}
+	int priorErrorCode = semmerErrorCode;
+	atomTable.shared = true;
+	typeTable.shared = true;
+	nextSemComponent = 0;
+	vector<pthread_t> threads;
+	for (unsigned int i = 1; i < numWorkers; i++) {
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, semWorkerThread, workers[i]) == 0) { // if we managed to start the thread, log it
+			threads.push_back(thread);
+		} // else if we couldn't start the thread, the remaining threads simply pick up its share of the work
+	}
+	semWorkerThread(workers[0]); // pitch in on the calling thread
+	for (unsigned int i = 0; i < threads.size(); i++) {
+		pthread_join(threads[i], NULL);
+	}
+	atomTable.shared = false;
+	typeTable.shared = false;
+	semmerErrorStream = &cerr;
+	semmerErrorCode = priorErrorCode;
+	// replay the units' errors in the order that the serial analysis would have reported them
+	for (vector<SemUnit *>::const_iterator unitIter = units.begin(); unitIter != units.end(); unitIter++) {
+		cerr << (*unitIter)->errors.str();
+		semmerErrorCode += (*unitIter)->errorCode;
+		delete (*unitIter);
+	}
+	semComponents.clear();
+	// latch the threads' fake nodes into the symbol tree, and tally their name resolution statistics
+	for (vector<SemWorker *>::const_iterator workerIter = workers.begin(); workerIter != workers.end(); workerIter++) {
+		for (map<pair<SymbolTree *, Atom>, SymbolTree *>::const_iterator fakeIter = (*workerIter)->fakes.begin(); fakeIter != (*workerIter)->fakes.end(); fakeIter++) {
+			*((*fakeIter).first.first) *= (*fakeIter).second;
+		}
+		bindingCache.hits += (*workerIter)->bindingCache.hits;
+		bindingCache.misses += (*workerIter)->bindingCache.misses;
+		bindingCache.invalidations += (*workerIter)->bindingCache.invalidations;
+		delete (*workerIter);
+	}
+}
+
 // creates the top-level SchedTree containing all of the LabelTrees that should be initially scheduled
 SchedTree *genCodeRoot(Tree *treeRoot) {
 	// build the list of labels that should be initially scheduled
 	vector<LabelTree *> labelList;
 	for (Tree *programCur = treeRoot; programCur != NULL; programCur = programCur->next) {
 		for (Tree *pipeCur = programCur->child->child; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
-			labelList.push_back(new LabelTree((SeqTree *)(pipeCur->status.code)));
+			labelList.push_back(new LabelTree((SeqTree *)(pipeCur->status().code)));
 		}
 	}
 	// finally, return the resulting SchedTree
@@ -2759,10 +3347,17 @@ int sem(Tree *treeRoot, SymbolTree *&stRoot, SchedTree *&codeRoot) {
 
 	VERBOSE( printNotice("tracing data flow..."); )
 
-	// perform semantic analysis (derivation of Type trees and offsets) on the entire SymbolTree
-	semSt(stRoot);
-	// perform semantic analysis (derivation of Type and IR trees) on the remaining pipes
-	semPipes(treeRoot);
+	if (numJobs > 1) { // if we're allowed multiple jobs, do both of the below steps at once, deriving independent declarations in parallel
+		semParallel(stRoot, treeRoot);
+	} else {
+		// perform semantic analysis (derivation of Type trees and offsets) on the entire SymbolTree
+		semSt(stRoot);
+		// perform semantic analysis (derivation of Type and IR trees) on the remaining pipes
+		semPipes(treeRoot);
+	}
+
+	VERBOSE( printNotice("name resolution cache: " << bindingCache.hits << " hits, " << bindingCache.misses << " misses, " << bindingCache.invalidations << " invalidations"); )
+	VERBOSE( printNotice("type table: " << typeTable.count << " canonical types, " << typeTable.hits << " hits, " << typeTable.misses << " misses"); )
 	
 	// build the root-level IRTree node at which assembly dumping will start
 	codeRoot = genCodeRoot(treeRoot);
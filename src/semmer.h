@@ -24,15 +24,62 @@
 #define KIND_INSTANTIATION 11
 #define KIND_FAKE 12
 
+// well-known identifier atoms, interned up front by AtomTable's constructor
+#define ATOM_RECALL 0 /* .. */
+#define ATOM_SUBSCRIPT 1 /* [] */
+#define ATOM_RANGE 2 /* [:] */
+
+// an interned identifier component; equal atoms denote equal strings
+typedef unsigned int Atom;
+
+class AtomTable {
+	public:
+		// data members
+		deque<string> strings; // the string of each atom, indexed by atom
+		vector<pair<unsigned int, Atom> > slots; // open-addressed hash table of (string hash, atom plus one) pairs, where an atom of 0 marks an empty slot; its size is a power of two
+		bool shared; // whether multiple threads are using the table, in which case all accesses lock the mutex
+		mutable pthread_mutex_t mutex;
+		// allocators/deallocators
+		AtomTable();
+		~AtomTable();
+		// core methods
+		Atom intern(const char *str, unsigned int len);
+		Atom intern(const string &s);
+		const string &operator[](Atom atom) const;
+};
+
+class AtomPath {
+	public:
+		// data members
+		vector<Atom> components; // the identifier's period-delimited components, in order
+		Atom path; // the atom of the whole identifier, including its periods
+};
+
+class AtomMap {
+	public:
+		// data members
+		vector<pair<Atom, SymbolTree *> > slots; // open-addressed hash table of (atom, node) pairs, where a NULL node marks an empty slot; its size is zero or a power of two
+		unsigned int count; // the number of mappings in the table
+		// allocators/deallocators
+		AtomMap();
+		~AtomMap();
+		// core methods
+		SymbolTree *find(Atom atom) const;
+		void insert(Atom atom, SymbolTree *st);
+		void erase(Atom atom);
+		unsigned int size() const;
+};
+
 class SymbolTree {
 	public:
 		// data members
 		int kind; // node kind
 		string id; // string representation of this node used for binding
+		Atom atom; // interned form of the above
 		Tree *defSite; // where the symbol is defined in the Tree (Declaration or Param)
 		SymbolTree *copyImportSite; // if this node is a copy-import, the node from which we're importing; NULL otherwise
 		SymbolTree *parent; // pointer ot the parent of this node; populated during SymbolTree status derivation
-		map<string, SymbolTree *> children; // list of this node's children
+		AtomMap children; // list of this node's children, keyed by the atoms of their identifiers
 		int offsetKindInternal; // the kind of child this node apprears as to its lexical parent
 		unsigned int offsetIndexInternal; // the offset of this child in the lexical parent's offset kind
 		unsigned int numRaws; // the number of raw-represented children for this node
@@ -55,6 +102,7 @@ class SymbolTree {
 		int offsetKind();
 		Tree *offsetExp() const;
 		unsigned int offsetIndex();
+		vector<SymbolTree *> sortedChildren() const;
 		string toString(unsigned int tabDepth);
 		// operators
 		SymbolTree &operator=(const SymbolTree &st);
@@ -62,6 +110,67 @@ class SymbolTree {
 		operator string();
 };
 
+// memoized name resolution
+
+class BindingCacheEntry {
+	public:
+		// data members
+		SymbolTree *env; // the scope in which the identifier was bound
+		Atom path; // the atom of the whole identifier, including its periods
+		unsigned int generation; // the symbol tree generation in which the binding was made
+		pair<SymbolTree *, bool> binding; // the result of the binding
+		// allocators/deallocators
+		BindingCacheEntry();
+		~BindingCacheEntry();
+};
+
+class BindingCache {
+	public:
+		// data members
+		vector<BindingCacheEntry> entries; // direct-mapped table of bindings, indexed by a hash of their (env, path) keys
+		unsigned int generation; // bumped whenever the symbol tree changes, which invalidates all of the bindings made before then
+		bool dirty; // whether any bindings have been made in the current generation
+		unsigned long long hits; // the number of lookups that found a valid binding
+		unsigned long long misses; // the number of lookups that didn't
+		unsigned long long invalidations; // the number of times that a change to the symbol tree discarded bindings
+		// allocators/deallocators
+		BindingCache();
+		~BindingCache();
+		// core methods
+		bool find(SymbolTree *env, Atom path, pair<SymbolTree *, bool> &binding);
+		void insert(SymbolTree *env, Atom path, const pair<SymbolTree *, bool> &binding);
+		void invalidate();
+};
+
+// parallel semantic analysis
+
+class SemUnit {
+	public:
+		// data members
+		SymbolTree *root; // the symbol tree node whose status this unit derives, or NULL if it derives a top-level pipe
+		SymbolTree *parent;
+		Tree *pipe; // the top-level pipe whose status this unit derives, if root is NULL
+		unsigned int owner; // the index of the top-level pipe whose parse tree this unit derives
+		ostringstream errors; // the errors reported while deriving this unit, replayed in order once all of the units are done
+		int errorCode; // the number of errors reported while deriving this unit
+		// allocators/deallocators
+		SemUnit(SymbolTree *root, SymbolTree *parent, Tree *pipe, unsigned int owner);
+		~SemUnit();
+		// core methods
+		void run();
+};
+
+class SemWorker {
+	public:
+		// data members
+		TreeArena *arena; // holds the Tree nodes that this thread synthesizes; never freed, since the derived statuses refer to them
+		BindingCache bindingCache; // this thread's name resolution cache
+		map<pair<SymbolTree *, Atom>, SymbolTree *> fakes; // the fake nodes made by this thread, keyed by parent and atom; the symbol tree is shared, so these are only latched into it once all threads are done
+		// allocators/deallocators
+		SemWorker();
+		~SemWorker();
+};
+
 // forward declarations of mutually recursive typing functions
 
 TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeStatus &inStatus = TypeStatus(nullType, errType));
@@ -70,6 +179,7 @@ TypeStatus getStatusPrimaryBase(Tree *tree, const TypeStatus &inStatus = TypeSta
 TypeStatus getStatusPrimary(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusBracketedExp(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
+void checkArrayAccess(const Tree *arrayAccess);
 TypeStatus getStatusPrimOpNode(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusPrimLiteral(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusBlock(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
@@ -105,61 +215,61 @@ TypeStatus getStatusPipe(Tree *tree, const TypeStatus &inStatus = TypeStatus(nul
 
 #define GET_STATUS_HEADER \
 	/* if the type is memoized, short-circuit evaluate */\
-	if (tree->status.type != NULL) {\
-		return (tree->status);\
+	if (tree->status().type != NULL) {\
+		return (tree->status());\
 	}\
 	/* otherwise, compute the type normally */
 
 #define GET_STATUS_SYMBOL_TREE_HEADER \
 	/* if the type is memoized, skip over type derivation */\
 	Tree *tree = root->defSite;\
-	if (tree->status.type != NULL) {\
+	if (tree->status().type != NULL) {\
 		goto endTypeDerivation;\
 	}\
 	/* otherwise, compute the type normally */
 
 #define returnType(x) \
 	/* memoize the return value and jump to the intermediate code generation point */\
-	tree->status = TypeStatus((x), inStatus.retType);\
+	tree->status() = TypeStatus((x), inStatus.retType);\
 	goto endTypeDerivation
 
 #define returnTypeRet(x,y) \
 	/* memoize the return value and jump to the intermediate code generation point */\
-	tree->status = TypeStatus((x),(y));\
+	tree->status() = TypeStatus((x),(y));\
 	goto endTypeDerivation
 
 #define returnStatus(x) \
 	/* memoize the return value and jump to the intermediate code generation point */\
-	tree->status = (x);\
+	tree->status() = (x);\
 	goto endTypeDerivation
 
 #define GET_STATUS_CODE \
 	/* if we failed to do a returnType, returnTypeRet, or returnStatus, memoize the error type and return from this function */\
-	tree->status = TypeStatus(errType, NULL);\
-	return (tree->status);\
+	tree->status() = TypeStatus(errType, NULL);\
+	return (tree->status());\
 	/* label the exit point of type derivation (i.e. the entry point for code generation) */\
 	endTypeDerivation:\
 	/* if we derived a valid return status, proceed to build the intermediate code tree */\
-	if (tree->status.type->category != CATEGORY_ERRORTYPE) {
+	if (tree->status().type->category != CATEGORY_ERRORTYPE) {
 
 #define returnCode(x) \
 	/* memoize the intermediate code tree and return from this function */\
-	tree->status.code = (x);\
-	return (tree->status)
+	tree->status().code = (x);\
+	return (tree->status())
 
 #define GET_STATUS_FOOTER \
 	/* close the if-statement */\
 	}\
 	/* if we failed to do a returnCode, returnKind, or returnKindIndex, simply return from this function */\
-	return (tree->status)
+	return (tree->status())
 
 #define GET_STATUS_NO_CODE_FOOTER \
 	/* if we failed to do a returnType, returnTypeRet, or returnStatus, memoize the error type and return from this function */\
-	tree->status = TypeStatus(errType, NULL);\
+	tree->status() = TypeStatus(errType, NULL);\
 	/* label the exit point for type derivation */\
 	endTypeDerivation:\
 	/* return from this function */\
-	return (tree->status)
+	return (tree->status())
 	
 // main semantic analysis function
 
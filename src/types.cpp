@@ -4,7 +4,7 @@
 
 // Type functions
 Type::Type(int category, int suffix, int depth, Tree *offsetExp) : category(category), suffix(suffix), depth(depth), offsetExp(offsetExp),
-	referensible(true), instantiable(true), toStringHandled(false) {}
+	referensible(true), instantiable(true), toStringHandled(false), canonical(false) {}
 bool Type::baseEquals(const Type &otherType) const {return (suffix == otherType.suffix && depth == otherType.depth);}
 bool Type::baseSendable(const Type &otherType) const {
 	return (
@@ -92,6 +92,28 @@ void Type::latchize() {
 	suffix = SUFFIX_LATCH;
 	depth = 0;
 }
+Type *Type::constantized() const {
+	if (category == CATEGORY_STDTYPE) { // if it's a standard type, mutate a temporary and look up its canonical equivalent
+		StdType result(*((const StdType *)this));
+		result.constantize();
+		return typeTable.intern(result);
+	} else { // else if it's some other kind of type, mutate a fresh copy
+		Type *retVal = copy();
+		retVal->constantize();
+		return retVal;
+	}
+}
+Type *Type::latchized() const {
+	if (category == CATEGORY_STDTYPE) { // if it's a standard type, mutate a temporary and look up its canonical equivalent
+		StdType result(*((const StdType *)this));
+		result.latchize();
+		return typeTable.intern(result);
+	} else { // else if it's some other kind of type, mutate a fresh copy
+		Type *retVal = copy();
+		retVal->latchize();
+		return retVal;
+	}
+}
 void Type::poolize(Tree *offsetExp) {
 	suffix = SUFFIX_POOL;
 	this->offsetExp = offsetExp;
@@ -319,7 +341,7 @@ int StdType::kindCast(const StdType &otherType) const {
 		return STD_NULL;
 	}
 }
-pair<Type *, bool> StdType::stdFlowDerivation(const TypeStatus &prevTermStatus, Tree *nextTerm) const {
+pair<Type *, bool> StdType::stdFlowDerivation(const TypeStatus &prevTermStatus, AstTerm *nextTerm) const {
 	// derive the nextTermStatus if we'll subsequently need it
 	TypeStatus nextTermStatus = errType;
 	switch(kind) {
@@ -336,13 +358,8 @@ pair<Type *, bool> StdType::stdFlowDerivation(const TypeStatus &prevTermStatus,
 		case STD_MOD:
 		case STD_PLUS:
 		case STD_MINUS:
-			if (nextTerm != NULL &&
-					*(nextTerm->child->child) == TOKEN_SimpleTerm &&
-					*(nextTerm->child->child->child) == TOKEN_StaticTerm && 
-					!(*(nextTerm->child->child->child->child->child) == TOKEN_Node &&
-					*(nextTerm->child->child->child->child->child->child) == TOKEN_Instantiation &&
-					*(nextTerm->child->child->child->child->child->child->child->next->child) == TOKEN_RARROW)) {
-				nextTermStatus = getStatusTerm(nextTerm, prevTermStatus);	
+			if (nextTerm != NULL && nextTerm->isStaticOperand()) {
+				nextTermStatus = getStatusTerm(nextTerm->term, prevTermStatus);
 			}
 			break;
 		default:
@@ -360,14 +377,14 @@ pair<Type *, bool> StdType::stdFlowDerivation(const TypeStatus &prevTermStatus,
 				if (prevTermStatus.type->category == CATEGORY_STDTYPE && (prevTermStatus.type->suffix == SUFFIX_CONSTANT || prevTermStatus.type->suffix == SUFFIX_LATCH) &&
 						nextTermStatus.type->category == CATEGORY_STDTYPE && (nextTermStatus.type->suffix == SUFFIX_CONSTANT || nextTermStatus.type->suffix == SUFFIX_LATCH) &&
 						((StdType *)(prevTermStatus.type))->kindCast(*((StdType *)(nextTermStatus.type)))) { // if the terms are comparable, return bool
-					return make_pair(new StdType(STD_BOOL, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_BOOL, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
 				}
 			}
 			break;
 		case STD_LS:
 		case STD_RS:
 			if ((*prevTermStatus >> *stdIntType) && (*nextTermStatus >> *stdIntType)) { // if both terms can be converted to int, return int
-				return make_pair(new StdType(STD_INT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
+				return make_pair(typeTable.stdType(STD_INT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
 			}
 			break;
 		case STD_TIMES:
@@ -377,31 +394,31 @@ pair<Type *, bool> StdType::stdFlowDerivation(const TypeStatus &prevTermStatus,
 		case STD_MINUS:
 			if (*nextTermStatus) {
 				if ((*prevTermStatus >> *stdIntType) && (*nextTermStatus >> *stdIntType)) { // if both terms can be converted to int, return int
-					return make_pair(new StdType(STD_INT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_INT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
 				}
 				if ((*prevTermStatus >> *stdFloatType) && (*nextTermStatus >> *stdFloatType)) { // if both terms can be converted to float, return float
-					return make_pair(new StdType(STD_FLOAT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_FLOAT, SUFFIX_LATCH), true); // return true, since we're consuming the nextTerm
 				}
 				// if this is the + operator and both terms are convertible to string, return string
 				if (kind == STD_PLUS &&
 						((*prevTermStatus >> *stdStringType) && (*nextTermStatus >> *stdStringType))) {
-					return make_pair(new StdType(STD_STRING, SUFFIX_LATCH), true); // return true, since were consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_STRING, SUFFIX_LATCH), true); // return true, since were consuming the nextTerm
 				}
 			}
 			// if we got here, we failed to derive a three-term type, so now we try using STD_PLUS and STD_MINUS in their unary form
 			if (kind == STD_PLUS || kind == STD_MINUS) { // if it's an operator with a unary form that accepts both ints an floats
 				if (*prevTermStatus >> *stdIntType) { // if both terms can be converted to int, return int
-					return make_pair(new StdType(STD_INT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_INT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
 				}
 				if (*prevTermStatus >> *stdFloatType) { // if both terms can be converted to float, return float
-					return make_pair(new StdType(STD_FLOAT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
+					return make_pair(typeTable.stdType(STD_FLOAT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
 				}
 			}
 			break;
 		case STD_DPLUS:
 		case STD_DMINUS:
 			if (*prevTermStatus >> *stdIntType) { // if both terms can be converted to int, return int
-				return make_pair(new StdType(STD_INT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
+				return make_pair(typeTable.stdType(STD_INT, SUFFIX_LATCH), false); // return false, since we're not consuming the nextTerm
 			}
 			break;
 		default:
@@ -492,11 +509,13 @@ bool StdType::objectTypePromotion(Type &otherType) const {
 	// none of the above cases succeeded, so return false
 	return false;
 }
-Type *StdType::copy() const {Type *retVal = new StdType(*this); retVal->referensible = true; retVal->instantiable = true; return retVal;}
-void StdType::erase() {delete this;}
+Type *StdType::copy() const {Type *retVal = new StdType(*this); retVal->referensible = true; retVal->instantiable = true; retVal->canonical = false; return retVal;}
+void StdType::erase() {if (!canonical) {delete this;}}
 void StdType::clear() {}
 bool StdType::operator==(Type &otherType) {
-	if (otherType.category == CATEGORY_STDTYPE) {
+	if (this == &otherType) { // canonical types are equal exactly when they're identical
+		return true;
+	} else if (otherType.category == CATEGORY_STDTYPE) {
 		StdType *otherTypeCast = (StdType *)(&otherType);
 		return (kind == otherTypeCast->kind && baseEquals(otherType));
 	} else {
@@ -629,12 +648,13 @@ string StdType::kindToString() const {
 	}
 }
 string StdType::toString(unsigned int tabDepth) {
-	TYPE_TO_STRING_HEADER;
+	// no recursion detection is needed, since a StdType has no subtypes; this also keeps canonical instances free of writes
+	string acc;
 	COLOR( acc += SET_TERM(BRIGHT_CODE AND CYAN_CODE); )
 	acc += kindToString();
 	COLOR( acc += SET_TERM(RESET_CODE); )
 	acc += suffixString();
-	TYPE_TO_STRING_FOOTER;
+	return acc;
 }
 StdType::operator string() {return toString(1);}
 
@@ -687,16 +707,16 @@ Type *TypeList::operator,(Type &otherType) {
 		if (list.size() == 1 && (list[0])->category == CATEGORY_STDTYPE && ((list[0])->suffix == SUFFIX_CONSTANT || (list[0])->suffix == SUFFIX_LATCH)) {
 			StdType *thisTypeCast = (StdType *)(list[0]);
 			if (otherTypeCast->kind == STD_NOT && (*thisTypeCast >> *stdBoolType)) {
-				return (new StdType(STD_BOOL, SUFFIX_LATCH));
+				return (typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 			} else if (otherTypeCast->kind == STD_COMPLEMENT && (*thisTypeCast >> *stdIntType)) {
-				return (new StdType(STD_INT, SUFFIX_LATCH));
+				return (typeTable.stdType(STD_INT, SUFFIX_LATCH));
 			} else if ((otherTypeCast->kind == STD_DPLUS || otherTypeCast->kind == STD_DMINUS) && (*thisTypeCast >> *stdIntType)) {
-				return (new StdType(STD_INT, SUFFIX_LATCH));
+				return (typeTable.stdType(STD_INT, SUFFIX_LATCH));
 			} else if (otherTypeCast->kind == STD_PLUS || otherTypeCast->kind == STD_MINUS) {
 				if (*thisTypeCast >> *stdIntType) {
-					return (new StdType(STD_INT, SUFFIX_LATCH));
+					return (typeTable.stdType(STD_INT, SUFFIX_LATCH));
 				} else if (*thisTypeCast >> *stdFloatType){
-					return (new StdType(STD_FLOAT, SUFFIX_LATCH));
+					return (typeTable.stdType(STD_FLOAT, SUFFIX_LATCH));
 				} else {
 					return errType;
 				}
@@ -710,24 +730,24 @@ Type *TypeList::operator,(Type &otherType) {
 			StdType *thisTypeCast2 = (StdType *)(list[1]);
 			if ((otherTypeCast->kind == STD_DOR || otherTypeCast->kind == STD_DAND) &&
 					((*thisTypeCast1 >> *stdBoolType) && (*thisTypeCast2 >> *stdBoolType))) {
-				return (new StdType(STD_BOOL, SUFFIX_LATCH));
+				return (typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 			} else if ((otherTypeCast->kind == STD_OR || otherTypeCast->kind == STD_XOR || otherTypeCast->kind == STD_AND) &&
 					((*thisTypeCast1 >> *stdIntType) && (*thisTypeCast2 >> *stdIntType))) {
-				return (new StdType(STD_INT, SUFFIX_LATCH));
+				return (typeTable.stdType(STD_INT, SUFFIX_LATCH));
 			} else if (otherTypeCast->kind == STD_DEQUALS || otherTypeCast->kind == STD_NEQUALS ||
 					otherTypeCast->kind == STD_LT || otherTypeCast->kind == STD_GT ||
 					otherTypeCast->kind == STD_LE || otherTypeCast->kind == STD_GE) {
 				if (thisTypeCast1->kindCast(*thisTypeCast2)) {
-					return (new StdType(STD_BOOL, SUFFIX_LATCH));
+					return (typeTable.stdType(STD_BOOL, SUFFIX_LATCH));
 				} else {
 					return errType;
 				}
 			} else if (otherTypeCast->kind == STD_TIMES || otherTypeCast->kind == STD_DIVIDE || otherTypeCast->kind == STD_MOD ||
 					otherTypeCast->kind == STD_PLUS || otherTypeCast->kind == STD_MINUS) {
 				if ((*thisTypeCast1 >> *stdIntType) && (*thisTypeCast2 >> *stdIntType)) {
-					return (new StdType(STD_INT, SUFFIX_LATCH));
+					return (typeTable.stdType(STD_INT, SUFFIX_LATCH));
 				} else if ((*thisTypeCast1 >> *stdFloatType) && (*thisTypeCast2 >> *stdFloatType)) {
-					return (new StdType(STD_FLOAT, SUFFIX_LATCH));
+					return (typeTable.stdType(STD_FLOAT, SUFFIX_LATCH));
 				} else {
 					return errType;
 				}
@@ -1506,6 +1526,72 @@ string ErrorType::toString(unsigned int tabDepth) {
 }
 ErrorType::operator string() {return toString(1);}
 
+// TypeTable functions
+TypeTable::TypeTable() : slots(TYPE_TABLE_INITIAL_SIZE, (StdType *)NULL), count(0), hits(0), misses(0), shared(false) {
+	pthread_mutex_init(&mutex, NULL);
+}
+TypeTable::~TypeTable() {
+	pthread_mutex_destroy(&mutex);
+}
+// returns the hash of a StdType with the given structure (32-bit FNV-1a over its fields)
+unsigned int hashStdType(int kind, int suffix, int depth, Tree *offsetExp) {
+	unsigned int hash = 2166136261U;
+	hash = (hash ^ (unsigned int)kind) * 16777619U;
+	hash = (hash ^ (unsigned int)suffix) * 16777619U;
+	hash = (hash ^ (unsigned int)depth) * 16777619U;
+	hash = (hash ^ (unsigned int)((uintptr_t)offsetExp / TREE_ARENA_ALIGNMENT)) * 16777619U;
+	return hash;
+}
+StdType *TypeTable::stdType(int kind, int suffix, int depth, Tree *offsetExp) {
+	if (shared) {
+		pthread_mutex_lock(&mutex);
+	}
+	// probe for the type
+	unsigned int mask = slots.size() - 1;
+	unsigned int slot;
+	for (slot = hashStdType(kind, suffix, depth, offsetExp) & mask; slots[slot] != NULL; slot = (slot + 1) & mask) {
+		StdType *cur = slots[slot];
+		if (cur->kind == kind && cur->suffix == suffix && cur->depth == depth && cur->offsetExp == offsetExp) { // if we found the type, we're done
+			break;
+		}
+	}
+	StdType *retVal = slots[slot];
+	if (retVal != NULL) { // if the type was already in the table, return the existing instance
+		hits++;
+	} else { // else if this is a new type, log a canonical instance of it
+		misses++;
+		retVal = new StdType(kind, suffix, depth, offsetExp);
+		retVal->canonical = true;
+		slots[slot] = retVal;
+		count++;
+		// if the table is now over half full, double its size and rehash
+		if (2*count > slots.size()) {
+			vector<StdType *> oldSlots;
+			oldSlots.swap(slots);
+			slots.resize(2*oldSlots.size(), NULL);
+			mask = slots.size() - 1;
+			for (unsigned int i = 0; i < oldSlots.size(); i++) {
+				StdType *cur = oldSlots[i];
+				if (cur != NULL) {
+					for (slot = hashStdType(cur->kind, cur->suffix, cur->depth, cur->offsetExp) & mask; slots[slot] != NULL; slot = (slot + 1) & mask);
+					slots[slot] = cur;
+				}
+			}
+		}
+	}
+	if (shared) {
+		pthread_mutex_unlock(&mutex);
+	}
+	return retVal;
+}
+Type *TypeTable::intern(const Type &type) {
+	if (type.category == CATEGORY_STDTYPE) { // if it's a standard type, return its canonical instance
+		return stdType(((const StdType &)type).kind, type.suffix, type.depth, type.offsetExp);
+	} else { // else if it's some other kind of type, there's no canonical instance, so return a copy
+		return type.copy();
+	}
+}
+
 // TypeStatus functions
 TypeStatus::TypeStatus(Type *type, Type *retType) : type(type), retType(retType), code(NULL) {}
 TypeStatus::TypeStatus(Type *type, const TypeStatus &otherStatus) : type(type), retType(otherStatus.retType), code(NULL) {}
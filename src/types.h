@@ -42,9 +42,12 @@ class Type {
 		bool referensible; // whether a node of this type can be referenced on its own
 		bool instantiable; // whether a node of this type can be instantiated
 		bool toStringHandled; // used for recursion detection in operator string()
+		bool canonical; // whether this is a shared instance owned by the type table, which must never be mutated or deleted
 		// mutators
 		void constantize(); // for when an identifier is present without an accessor or a sub-identifier's type is constrained by upstream identifiers
 		void latchize(); // for when we're instantiating a node with a single initializer
+		Type *constantized() const; // non-mutating versions of the above; these return a canonical type where the type table can provide one, and a fresh copy otherwise
+		Type *latchized() const;
 		void poolize(Tree *offsetExp); // for when we're instantiating a node with a multi initializer
 		void decreaseDepth();
 		bool delatch() const;
@@ -137,7 +140,7 @@ class StdType : public Type {
 		bool isComparable() const;
 		bool isComparable(const Type &otherType) const;
 		int kindCast(const StdType &otherType) const; // returns kind resulting from sending *this to otherType, STD_NULL if the comparison is invalid
-		pair<Type *, bool> stdFlowDerivation(const TypeStatus &prevStatus, Tree *nextTerm) const; // bool is whether we consumed nextTerm in the derivation
+		pair<Type *, bool> stdFlowDerivation(const TypeStatus &prevStatus, AstTerm *nextTerm) const; // bool is whether we consumed nextTerm in the derivation
 		bool objectTypePromotion(Type &otherType) const; // returns whether we can specially promote this StdType to the given ObjectType
 		Type *copy() const;
 		void erase();
@@ -352,6 +355,25 @@ class ErrorType : public Type {
 		operator string();
 };
 
+// hash-consing table of canonical StdType instances
+
+class TypeTable {
+	public:
+		// data members
+		vector<StdType *> slots; // open-addressed hash table of canonical types, where NULL marks an empty slot; its size is a power of two
+		unsigned int count; // the number of canonical types in the table
+		unsigned long long hits; // the number of lookups that found an existing canonical type
+		unsigned long long misses; // the number of lookups that had to create one
+		bool shared; // whether multiple threads are using the table, in which case all accesses lock the mutex
+		mutable pthread_mutex_t mutex;
+		// allocators/deallocators
+		TypeTable();
+		~TypeTable();
+		// core methods
+		StdType *stdType(int kind, int suffix = SUFFIX_CONSTANT, int depth = 0, Tree *offsetExp = NULL);
+		Type *intern(const Type &type); // returns the canonical equivalent of the given type if it's a StdType, or a fresh copy of it otherwise
+};
+
 // typing status class
 
 class TypeStatus {
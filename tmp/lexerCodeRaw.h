@@ -0,0 +1,2124 @@
+/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */
+
+// returns the transition out of the given state on the given character
+inline LexerNode lexerTransition(int state, unsigned char c) {
+	switch (state) {
+		case 0:
+			switch (c) {
+				case '!':
+					return (LexerNode){ TOKEN_NOT, 11 };
+				case '"':
+					return (LexerNode){ TOKEN_SQUOTE, 115 };
+				case '%':
+					return (LexerNode){ TOKEN_MOD, 115 };
+				case '&':
+					return (LexerNode){ TOKEN_AND, 106 };
+				case 39:
+					return (LexerNode){ TOKEN_CQUOTE, 115 };
+				case '(':
+					return (LexerNode){ TOKEN_LBRACKET, 115 };
+				case ')':
+					return (LexerNode){ TOKEN_RBRACKET, 115 };
+				case '*':
+					return (LexerNode){ TOKEN_TIMES, 115 };
+				case '+':
+					return (LexerNode){ TOKEN_PLUS, 103 };
+				case ',':
+					return (LexerNode){ TOKEN_COMMA, 115 };
+				case '-':
+					return (LexerNode){ TOKEN_MINUS, 104 };
+				case '.':
+					return (LexerNode){ TOKEN_PERIOD, 114 };
+				case '/':
+					return (LexerNode){ TOKEN_DIVIDE, 105 };
+				case '0':
+					return (LexerNode){ TOKEN_INUM, 3 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_INUM, 2 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_INUM, 2 };
+				case ':':
+					return (LexerNode){ TOKEN_COLON, 113 };
+				case ';':
+					return (LexerNode){ TOKEN_SEMICOLON, 115 };
+				case '<':
+					return (LexerNode){ TOKEN_LT, 108 };
+				case '=':
+					return (LexerNode){ TOKEN_EQUALS, 10 };
+				case '>':
+					return (LexerNode){ TOKEN_GT, 110 };
+				case '?':
+					return (LexerNode){ TOKEN_QUESTION, 112 };
+				case '@':
+					return (LexerNode){ TOKEN_AT, 115 };
+				case 'A':
+				case 'B':
+				case 'C':
+				case 'D':
+				case 'E':
+				case 'F':
+				case 'a':
+				case 'b':
+				case 'c':
+				case 'd':
+				case 'f':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'G':
+				case 'H':
+				case 'I':
+				case 'J':
+				case 'K':
+				case 'L':
+				case 'M':
+				case 'N':
+				case 'O':
+				case 'P':
+				case 'Q':
+				case 'R':
+				case 'S':
+				case 'T':
+				case 'U':
+				case 'V':
+				case 'W':
+				case 'X':
+				case 'Y':
+				case 'Z':
+				case 'g':
+				case 'h':
+				case 'i':
+				case 'j':
+				case 'k':
+				case 'l':
+				case 'm':
+				case 'n':
+				case 'o':
+				case 'p':
+				case 'q':
+				case 'r':
+				case 's':
+				case 't':
+				case 'u':
+				case 'v':
+				case 'w':
+				case 'y':
+				case 'z':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case '[':
+					return (LexerNode){ TOKEN_LSQUARE, 115 };
+				case 92:
+					return (LexerNode){ TOKEN_SLASH, 102 };
+				case ']':
+					return (LexerNode){ TOKEN_RSQUARE, 115 };
+				case '^':
+					return (LexerNode){ TOKEN_XOR, 115 };
+				case 'e':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'x':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case '{':
+					return (LexerNode){ TOKEN_LCURLY, 115 };
+				case '|':
+					return (LexerNode){ TOKEN_OR, 107 };
+				case '}':
+					return (LexerNode){ TOKEN_RCURLY, 115 };
+				case '~':
+					return (LexerNode){ TOKEN_COMPLEMENT, 115 };
+				default:
+					break;
+			}
+			break;
+		case 1:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'A':
+				case 'B':
+				case 'C':
+				case 'D':
+				case 'E':
+				case 'F':
+				case 'a':
+				case 'b':
+				case 'c':
+				case 'd':
+				case 'f':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'G':
+				case 'H':
+				case 'I':
+				case 'J':
+				case 'K':
+				case 'L':
+				case 'M':
+				case 'N':
+				case 'O':
+				case 'P':
+				case 'Q':
+				case 'R':
+				case 'S':
+				case 'T':
+				case 'U':
+				case 'V':
+				case 'W':
+				case 'X':
+				case 'Y':
+				case 'Z':
+				case 'g':
+				case 'h':
+				case 'i':
+				case 'j':
+				case 'k':
+				case 'l':
+				case 'm':
+				case 'n':
+				case 'o':
+				case 'p':
+				case 'q':
+				case 'r':
+				case 's':
+				case 't':
+				case 'u':
+				case 'v':
+				case 'w':
+				case 'y':
+				case 'z':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case '_':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'e':
+					return (LexerNode){ TOKEN_ID, 1 };
+				case 'x':
+					return (LexerNode){ TOKEN_ID, 1 };
+				default:
+					break;
+			}
+			break;
+		case 2:
+			switch (c) {
+				case '.':
+					return (LexerNode){ TOKEN_ERROR, 4 };
+				case '0':
+					return (LexerNode){ TOKEN_INUM, 2 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_INUM, 2 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_INUM, 2 };
+				case 'e':
+					return (LexerNode){ TOKEN_ERROR, 6 };
+				default:
+					break;
+			}
+			break;
+		case 3:
+			switch (c) {
+				case '.':
+					return (LexerNode){ TOKEN_ERROR, 4 };
+				case '0':
+					return (LexerNode){ TOKEN_FAIL, 115 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_INUM, 8 };
+				case 'x':
+					return (LexerNode){ TOKEN_ERROR, 9 };
+				default:
+					break;
+			}
+			break;
+		case 4:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				default:
+					break;
+			}
+			break;
+		case 5:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_FNUM, 5 };
+				case 'e':
+					return (LexerNode){ TOKEN_ERROR, 6 };
+				default:
+					break;
+			}
+			break;
+		case 6:
+			switch (c) {
+				case '+':
+					return (LexerNode){ TOKEN_ERROR, 7 };
+				case '-':
+					return (LexerNode){ TOKEN_ERROR, 7 };
+				case '0':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				default:
+					break;
+			}
+			break;
+		case 7:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_FNUM, 7 };
+				default:
+					break;
+			}
+			break;
+		case 8:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_INUM, 8 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_INUM, 8 };
+				default:
+					break;
+			}
+			break;
+		case 9:
+			switch (c) {
+				case '0':
+					return (LexerNode){ TOKEN_INUM, 9 };
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					return (LexerNode){ TOKEN_INUM, 9 };
+				case '8':
+				case '9':
+					return (LexerNode){ TOKEN_INUM, 9 };
+				case 'A':
+				case 'B':
+				case 'C':
+				case 'D':
+				case 'E':
+				case 'F':
+				case 'a':
+				case 'b':
+				case 'c':
+				case 'd':
+				case 'f':
+					return (LexerNode){ TOKEN_INUM, 9 };
+				case 'e':
+					return (LexerNode){ TOKEN_INUM, 9 };
+				default:
+					break;
+			}
+			break;
+		case 10:
+			switch (c) {
+				case '=':
+					return (LexerNode){ TOKEN_DEQUALS, 115 };
+				default:
+					break;
+			}
+			break;
+		case 11:
+			switch (c) {
+				case '=':
+					return (LexerNode){ TOKEN_NEQUALS, 115 };
+				default:
+					break;
+			}
+			break;
+		case 102:
+			switch (c) {
+				case 92:
+					return (LexerNode){ TOKEN_DSLASH, 115 };
+				default:
+					break;
+			}
+			break;
+		case 103:
+			switch (c) {
+				case '+':
+					return (LexerNode){ TOKEN_DPLUS, 115 };
+				default:
+					break;
+			}
+			break;
+		case 104:
+			switch (c) {
+				case '-':
+					return (LexerNode){ TOKEN_DMINUS, 111 };
+				case '>':
+					return (LexerNode){ TOKEN_RARROW, 115 };
+				default:
+					break;
+			}
+			break;
+		case 105:
+			switch (c) {
+				case '*':
+					return (LexerNode){ TOKEN_STARCOMMENT, 115 };
+				case '/':
+					return (LexerNode){ TOKEN_REGCOMMENT, 115 };
+				default:
+					break;
+			}
+			break;
+		case 106:
+			switch (c) {
+				case '&':
+					return (LexerNode){ TOKEN_DAND, 115 };
+				default:
+					break;
+			}
+			break;
+		case 107:
+			switch (c) {
+				case '>':
+					return (LexerNode){ TOKEN_RFLAG, 115 };
+				case '|':
+					return (LexerNode){ TOKEN_DOR, 115 };
+				default:
+					break;
+			}
+			break;
+		case 108:
+			switch (c) {
+				case '-':
+					return (LexerNode){ TOKEN_LARROW, 109 };
+				case '<':
+					return (LexerNode){ TOKEN_LS, 115 };
+				case '=':
+					return (LexerNode){ TOKEN_LE, 115 };
+				case '|':
+					return (LexerNode){ TOKEN_LFLAG, 115 };
+				default:
+					break;
+			}
+			break;
+		case 109:
+			switch (c) {
+				case '>':
+					return (LexerNode){ TOKEN_LRARROW, 115 };
+				default:
+					break;
+			}
+			break;
+		case 110:
+			switch (c) {
+				case '=':
+					return (LexerNode){ TOKEN_GE, 115 };
+				case '>':
+					return (LexerNode){ TOKEN_RS, 115 };
+				default:
+					break;
+			}
+			break;
+		case 111:
+			switch (c) {
+				case '>':
+					return (LexerNode){ TOKEN_DRARROW, 115 };
+				default:
+					break;
+			}
+			break;
+		case 112:
+			switch (c) {
+				case '?':
+					return (LexerNode){ TOKEN_DQUESTION, 115 };
+				default:
+					break;
+			}
+			break;
+		case 113:
+			switch (c) {
+				case ':':
+					return (LexerNode){ TOKEN_DCOLON, 115 };
+				default:
+					break;
+			}
+			break;
+		case 114:
+			switch (c) {
+				case '.':
+					return (LexerNode){ TOKEN_DPERIOD, 115 };
+				default:
+					break;
+			}
+			break;
+	}
+	return (LexerNode){ -1, 0 };
+}
+
+// consumes the characters in [cur, limit) that extend the current token through regular transitions, updating state and tokenType
+inline void lexerStep(const char *&cur, const char *limit, int &state, int &tokenType) {
+	const char *p = cur;
+	switch (state) {
+		case 0:
+			goto lexerState0;
+		case 1:
+			goto lexerState1;
+		case 2:
+			goto lexerState2;
+		case 3:
+			goto lexerState3;
+		case 4:
+			goto lexerState4;
+		case 5:
+			goto lexerState5;
+		case 6:
+			goto lexerState6;
+		case 7:
+			goto lexerState7;
+		case 8:
+			goto lexerState8;
+		case 9:
+			goto lexerState9;
+		case 10:
+			goto lexerState10;
+		case 11:
+			goto lexerState11;
+		case 12:
+			goto lexerState12;
+		case 13:
+			goto lexerState13;
+		case 14:
+			goto lexerState14;
+		case 15:
+			goto lexerState15;
+		case 16:
+			goto lexerState16;
+		case 17:
+			goto lexerState17;
+		case 18:
+			goto lexerState18;
+		case 19:
+			goto lexerState19;
+		case 20:
+			goto lexerState20;
+		case 21:
+			goto lexerState21;
+		case 22:
+			goto lexerState22;
+		case 23:
+			goto lexerState23;
+		case 24:
+			goto lexerState24;
+		case 25:
+			goto lexerState25;
+		case 26:
+			goto lexerState26;
+		case 27:
+			goto lexerState27;
+		case 28:
+			goto lexerState28;
+		case 29:
+			goto lexerState29;
+		case 30:
+			goto lexerState30;
+		case 31:
+			goto lexerState31;
+		case 32:
+			goto lexerState32;
+		case 33:
+			goto lexerState33;
+		case 34:
+			goto lexerState34;
+		case 35:
+			goto lexerState35;
+		case 36:
+			goto lexerState36;
+		case 37:
+			goto lexerState37;
+		case 38:
+			goto lexerState38;
+		case 39:
+			goto lexerState39;
+		case 40:
+			goto lexerState40;
+		case 41:
+			goto lexerState41;
+		case 42:
+			goto lexerState42;
+		case 43:
+			goto lexerState43;
+		case 44:
+			goto lexerState44;
+		case 45:
+			goto lexerState45;
+		case 46:
+			goto lexerState46;
+		case 47:
+			goto lexerState47;
+		case 48:
+			goto lexerState48;
+		case 49:
+			goto lexerState49;
+		case 50:
+			goto lexerState50;
+		case 51:
+			goto lexerState51;
+		case 52:
+			goto lexerState52;
+		case 53:
+			goto lexerState53;
+		case 54:
+			goto lexerState54;
+		case 55:
+			goto lexerState55;
+		case 56:
+			goto lexerState56;
+		case 57:
+			goto lexerState57;
+		case 58:
+			goto lexerState58;
+		case 59:
+			goto lexerState59;
+		case 60:
+			goto lexerState60;
+		case 61:
+			goto lexerState61;
+		case 62:
+			goto lexerState62;
+		case 63:
+			goto lexerState63;
+		case 64:
+			goto lexerState64;
+		case 65:
+			goto lexerState65;
+		case 66:
+			goto lexerState66;
+		case 67:
+			goto lexerState67;
+		case 68:
+			goto lexerState68;
+		case 69:
+			goto lexerState69;
+		case 70:
+			goto lexerState70;
+		case 71:
+			goto lexerState71;
+		case 72:
+			goto lexerState72;
+		case 73:
+			goto lexerState73;
+		case 74:
+			goto lexerState74;
+		case 75:
+			goto lexerState75;
+		case 76:
+			goto lexerState76;
+		case 77:
+			goto lexerState77;
+		case 78:
+			goto lexerState78;
+		case 79:
+			goto lexerState79;
+		case 80:
+			goto lexerState80;
+		case 81:
+			goto lexerState81;
+		case 82:
+			goto lexerState82;
+		case 83:
+			goto lexerState83;
+		case 84:
+			goto lexerState84;
+		case 85:
+			goto lexerState85;
+		case 86:
+			goto lexerState86;
+		case 87:
+			goto lexerState87;
+		case 88:
+			goto lexerState88;
+		case 89:
+			goto lexerState89;
+		case 90:
+			goto lexerState90;
+		case 91:
+			goto lexerState91;
+		case 92:
+			goto lexerState92;
+		case 93:
+			goto lexerState93;
+		case 94:
+			goto lexerState94;
+		case 95:
+			goto lexerState95;
+		case 96:
+			goto lexerState96;
+		case 97:
+			goto lexerState97;
+		case 98:
+			goto lexerState98;
+		case 99:
+			goto lexerState99;
+		case 100:
+			goto lexerState100;
+		case 101:
+			goto lexerState101;
+		case 102:
+			goto lexerState102;
+		case 103:
+			goto lexerState103;
+		case 104:
+			goto lexerState104;
+		case 105:
+			goto lexerState105;
+		case 106:
+			goto lexerState106;
+		case 107:
+			goto lexerState107;
+		case 108:
+			goto lexerState108;
+		case 109:
+			goto lexerState109;
+		case 110:
+			goto lexerState110;
+		case 111:
+			goto lexerState111;
+		case 112:
+			goto lexerState112;
+		case 113:
+			goto lexerState113;
+		case 114:
+			goto lexerState114;
+		case 115:
+			goto lexerState115;
+		default:
+			return;
+	}
+lexerState0:
+	if (p == limit) {
+		state = 0; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			p++;
+			goto lexerState1;
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			goto lexerState2;
+		case '0':
+			p++;
+			goto lexerState3;
+		case '=':
+			p++;
+			goto lexerState10;
+		case '!':
+			p++;
+			goto lexerState11;
+		case 92:
+			p++;
+			goto lexerState102;
+		case '+':
+			p++;
+			goto lexerState103;
+		case '-':
+			p++;
+			goto lexerState104;
+		case '/':
+			p++;
+			goto lexerState105;
+		case '&':
+			p++;
+			goto lexerState106;
+		case '|':
+			p++;
+			goto lexerState107;
+		case '<':
+			p++;
+			goto lexerState108;
+		case '>':
+			p++;
+			goto lexerState110;
+		case '?':
+			p++;
+			goto lexerState112;
+		case ':':
+			p++;
+			goto lexerState113;
+		case '.':
+			p++;
+			goto lexerState114;
+		case '(':
+			p++;
+			tokenType = TOKEN_LBRACKET;
+			goto lexerState115;
+		case ')':
+			p++;
+			tokenType = TOKEN_RBRACKET;
+			goto lexerState115;
+		case '[':
+			p++;
+			tokenType = TOKEN_LSQUARE;
+			goto lexerState115;
+		case ']':
+			p++;
+			tokenType = TOKEN_RSQUARE;
+			goto lexerState115;
+		case '{':
+			p++;
+			tokenType = TOKEN_LCURLY;
+			goto lexerState115;
+		case '}':
+			p++;
+			tokenType = TOKEN_RCURLY;
+			goto lexerState115;
+		case ',':
+			p++;
+			tokenType = TOKEN_COMMA;
+			goto lexerState115;
+		case ';':
+			p++;
+			tokenType = TOKEN_SEMICOLON;
+			goto lexerState115;
+		case '@':
+			p++;
+			tokenType = TOKEN_AT;
+			goto lexerState115;
+		case '*':
+			p++;
+			tokenType = TOKEN_TIMES;
+			goto lexerState115;
+		case '%':
+			p++;
+			tokenType = TOKEN_MOD;
+			goto lexerState115;
+		case '~':
+			p++;
+			tokenType = TOKEN_COMPLEMENT;
+			goto lexerState115;
+		case '^':
+			p++;
+			tokenType = TOKEN_XOR;
+			goto lexerState115;
+		default:
+			state = 0; goto lexerStepDone;
+	}
+lexerState1:
+	if (p == limit) {
+		state = 1; tokenType = TOKEN_ID; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			p++;
+			goto lexerState1;
+		default:
+			state = 1; tokenType = TOKEN_ID; goto lexerStepDone;
+	}
+lexerState2:
+	if (p == limit) {
+		state = 2; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			goto lexerState2;
+		case '.':
+			p++;
+			goto lexerState4;
+		case 'e':
+			p++;
+			goto lexerState6;
+		default:
+			state = 2; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+lexerState3:
+	if (p == limit) {
+		state = 3; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '.':
+			p++;
+			goto lexerState4;
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+			p++;
+			goto lexerState8;
+		case 'x':
+			p++;
+			tokenType = TOKEN_ERROR;
+			goto lexerState9;
+		default:
+			state = 3; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+lexerState4:
+	if (p == limit) {
+		state = 4; tokenType = TOKEN_ERROR; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			goto lexerState5;
+		default:
+			state = 4; tokenType = TOKEN_ERROR; goto lexerStepDone;
+	}
+lexerState5:
+	if (p == limit) {
+		state = 5; tokenType = TOKEN_FNUM; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			goto lexerState5;
+		case 'e':
+			p++;
+			goto lexerState6;
+		default:
+			state = 5; tokenType = TOKEN_FNUM; goto lexerStepDone;
+	}
+lexerState6:
+	if (p == limit) {
+		state = 6; tokenType = TOKEN_ERROR; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '+':
+		case '-':
+			p++;
+			tokenType = TOKEN_ERROR;
+			goto lexerState7;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			tokenType = TOKEN_FNUM;
+			goto lexerState7;
+		default:
+			state = 6; tokenType = TOKEN_ERROR; goto lexerStepDone;
+	}
+lexerState7:
+	if (p == limit) {
+		state = 7; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			p++;
+			tokenType = TOKEN_FNUM;
+			goto lexerState7;
+		default:
+			state = 7; goto lexerStepDone;
+	}
+lexerState8:
+	if (p == limit) {
+		state = 8; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+			p++;
+			goto lexerState8;
+		default:
+			state = 8; tokenType = TOKEN_INUM; goto lexerStepDone;
+	}
+lexerState9:
+	if (p == limit) {
+		state = 9; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+			p++;
+			tokenType = TOKEN_INUM;
+			goto lexerState9;
+		default:
+			state = 9; goto lexerStepDone;
+	}
+lexerState10:
+	if (p == limit) {
+		state = 10; tokenType = TOKEN_EQUALS; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '=':
+			p++;
+			tokenType = TOKEN_DEQUALS;
+			goto lexerState115;
+		default:
+			state = 10; tokenType = TOKEN_EQUALS; goto lexerStepDone;
+	}
+lexerState11:
+	if (p == limit) {
+		state = 11; tokenType = TOKEN_NOT; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '=':
+			p++;
+			tokenType = TOKEN_NEQUALS;
+			goto lexerState115;
+		default:
+			state = 11; tokenType = TOKEN_NOT; goto lexerStepDone;
+	}
+lexerState12:
+	if (p == limit) {
+		state = 12; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 12; goto lexerStepDone;
+	}
+lexerState13:
+	if (p == limit) {
+		state = 13; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 13; goto lexerStepDone;
+	}
+lexerState14:
+	if (p == limit) {
+		state = 14; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 14; goto lexerStepDone;
+	}
+lexerState15:
+	if (p == limit) {
+		state = 15; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 15; goto lexerStepDone;
+	}
+lexerState16:
+	if (p == limit) {
+		state = 16; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 16; goto lexerStepDone;
+	}
+lexerState17:
+	if (p == limit) {
+		state = 17; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 17; goto lexerStepDone;
+	}
+lexerState18:
+	if (p == limit) {
+		state = 18; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 18; goto lexerStepDone;
+	}
+lexerState19:
+	if (p == limit) {
+		state = 19; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 19; goto lexerStepDone;
+	}
+lexerState20:
+	if (p == limit) {
+		state = 20; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 20; goto lexerStepDone;
+	}
+lexerState21:
+	if (p == limit) {
+		state = 21; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 21; goto lexerStepDone;
+	}
+lexerState22:
+	if (p == limit) {
+		state = 22; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 22; goto lexerStepDone;
+	}
+lexerState23:
+	if (p == limit) {
+		state = 23; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 23; goto lexerStepDone;
+	}
+lexerState24:
+	if (p == limit) {
+		state = 24; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 24; goto lexerStepDone;
+	}
+lexerState25:
+	if (p == limit) {
+		state = 25; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 25; goto lexerStepDone;
+	}
+lexerState26:
+	if (p == limit) {
+		state = 26; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 26; goto lexerStepDone;
+	}
+lexerState27:
+	if (p == limit) {
+		state = 27; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 27; goto lexerStepDone;
+	}
+lexerState28:
+	if (p == limit) {
+		state = 28; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 28; goto lexerStepDone;
+	}
+lexerState29:
+	if (p == limit) {
+		state = 29; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 29; goto lexerStepDone;
+	}
+lexerState30:
+	if (p == limit) {
+		state = 30; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 30; goto lexerStepDone;
+	}
+lexerState31:
+	if (p == limit) {
+		state = 31; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 31; goto lexerStepDone;
+	}
+lexerState32:
+	if (p == limit) {
+		state = 32; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 32; goto lexerStepDone;
+	}
+lexerState33:
+	if (p == limit) {
+		state = 33; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 33; goto lexerStepDone;
+	}
+lexerState34:
+	if (p == limit) {
+		state = 34; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 34; goto lexerStepDone;
+	}
+lexerState35:
+	if (p == limit) {
+		state = 35; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 35; goto lexerStepDone;
+	}
+lexerState36:
+	if (p == limit) {
+		state = 36; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 36; goto lexerStepDone;
+	}
+lexerState37:
+	if (p == limit) {
+		state = 37; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 37; goto lexerStepDone;
+	}
+lexerState38:
+	if (p == limit) {
+		state = 38; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 38; goto lexerStepDone;
+	}
+lexerState39:
+	if (p == limit) {
+		state = 39; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 39; goto lexerStepDone;
+	}
+lexerState40:
+	if (p == limit) {
+		state = 40; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 40; goto lexerStepDone;
+	}
+lexerState41:
+	if (p == limit) {
+		state = 41; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 41; goto lexerStepDone;
+	}
+lexerState42:
+	if (p == limit) {
+		state = 42; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 42; goto lexerStepDone;
+	}
+lexerState43:
+	if (p == limit) {
+		state = 43; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 43; goto lexerStepDone;
+	}
+lexerState44:
+	if (p == limit) {
+		state = 44; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 44; goto lexerStepDone;
+	}
+lexerState45:
+	if (p == limit) {
+		state = 45; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 45; goto lexerStepDone;
+	}
+lexerState46:
+	if (p == limit) {
+		state = 46; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 46; goto lexerStepDone;
+	}
+lexerState47:
+	if (p == limit) {
+		state = 47; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 47; goto lexerStepDone;
+	}
+lexerState48:
+	if (p == limit) {
+		state = 48; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 48; goto lexerStepDone;
+	}
+lexerState49:
+	if (p == limit) {
+		state = 49; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 49; goto lexerStepDone;
+	}
+lexerState50:
+	if (p == limit) {
+		state = 50; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 50; goto lexerStepDone;
+	}
+lexerState51:
+	if (p == limit) {
+		state = 51; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 51; goto lexerStepDone;
+	}
+lexerState52:
+	if (p == limit) {
+		state = 52; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 52; goto lexerStepDone;
+	}
+lexerState53:
+	if (p == limit) {
+		state = 53; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 53; goto lexerStepDone;
+	}
+lexerState54:
+	if (p == limit) {
+		state = 54; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 54; goto lexerStepDone;
+	}
+lexerState55:
+	if (p == limit) {
+		state = 55; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 55; goto lexerStepDone;
+	}
+lexerState56:
+	if (p == limit) {
+		state = 56; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 56; goto lexerStepDone;
+	}
+lexerState57:
+	if (p == limit) {
+		state = 57; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 57; goto lexerStepDone;
+	}
+lexerState58:
+	if (p == limit) {
+		state = 58; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 58; goto lexerStepDone;
+	}
+lexerState59:
+	if (p == limit) {
+		state = 59; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 59; goto lexerStepDone;
+	}
+lexerState60:
+	if (p == limit) {
+		state = 60; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 60; goto lexerStepDone;
+	}
+lexerState61:
+	if (p == limit) {
+		state = 61; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 61; goto lexerStepDone;
+	}
+lexerState62:
+	if (p == limit) {
+		state = 62; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 62; goto lexerStepDone;
+	}
+lexerState63:
+	if (p == limit) {
+		state = 63; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 63; goto lexerStepDone;
+	}
+lexerState64:
+	if (p == limit) {
+		state = 64; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 64; goto lexerStepDone;
+	}
+lexerState65:
+	if (p == limit) {
+		state = 65; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 65; goto lexerStepDone;
+	}
+lexerState66:
+	if (p == limit) {
+		state = 66; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 66; goto lexerStepDone;
+	}
+lexerState67:
+	if (p == limit) {
+		state = 67; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 67; goto lexerStepDone;
+	}
+lexerState68:
+	if (p == limit) {
+		state = 68; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 68; goto lexerStepDone;
+	}
+lexerState69:
+	if (p == limit) {
+		state = 69; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 69; goto lexerStepDone;
+	}
+lexerState70:
+	if (p == limit) {
+		state = 70; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 70; goto lexerStepDone;
+	}
+lexerState71:
+	if (p == limit) {
+		state = 71; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 71; goto lexerStepDone;
+	}
+lexerState72:
+	if (p == limit) {
+		state = 72; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 72; goto lexerStepDone;
+	}
+lexerState73:
+	if (p == limit) {
+		state = 73; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 73; goto lexerStepDone;
+	}
+lexerState74:
+	if (p == limit) {
+		state = 74; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 74; goto lexerStepDone;
+	}
+lexerState75:
+	if (p == limit) {
+		state = 75; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 75; goto lexerStepDone;
+	}
+lexerState76:
+	if (p == limit) {
+		state = 76; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 76; goto lexerStepDone;
+	}
+lexerState77:
+	if (p == limit) {
+		state = 77; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 77; goto lexerStepDone;
+	}
+lexerState78:
+	if (p == limit) {
+		state = 78; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 78; goto lexerStepDone;
+	}
+lexerState79:
+	if (p == limit) {
+		state = 79; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 79; goto lexerStepDone;
+	}
+lexerState80:
+	if (p == limit) {
+		state = 80; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 80; goto lexerStepDone;
+	}
+lexerState81:
+	if (p == limit) {
+		state = 81; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 81; goto lexerStepDone;
+	}
+lexerState82:
+	if (p == limit) {
+		state = 82; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 82; goto lexerStepDone;
+	}
+lexerState83:
+	if (p == limit) {
+		state = 83; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 83; goto lexerStepDone;
+	}
+lexerState84:
+	if (p == limit) {
+		state = 84; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 84; goto lexerStepDone;
+	}
+lexerState85:
+	if (p == limit) {
+		state = 85; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 85; goto lexerStepDone;
+	}
+lexerState86:
+	if (p == limit) {
+		state = 86; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 86; goto lexerStepDone;
+	}
+lexerState87:
+	if (p == limit) {
+		state = 87; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 87; goto lexerStepDone;
+	}
+lexerState88:
+	if (p == limit) {
+		state = 88; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 88; goto lexerStepDone;
+	}
+lexerState89:
+	if (p == limit) {
+		state = 89; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 89; goto lexerStepDone;
+	}
+lexerState90:
+	if (p == limit) {
+		state = 90; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 90; goto lexerStepDone;
+	}
+lexerState91:
+	if (p == limit) {
+		state = 91; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 91; goto lexerStepDone;
+	}
+lexerState92:
+	if (p == limit) {
+		state = 92; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 92; goto lexerStepDone;
+	}
+lexerState93:
+	if (p == limit) {
+		state = 93; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 93; goto lexerStepDone;
+	}
+lexerState94:
+	if (p == limit) {
+		state = 94; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 94; goto lexerStepDone;
+	}
+lexerState95:
+	if (p == limit) {
+		state = 95; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 95; goto lexerStepDone;
+	}
+lexerState96:
+	if (p == limit) {
+		state = 96; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 96; goto lexerStepDone;
+	}
+lexerState97:
+	if (p == limit) {
+		state = 97; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 97; goto lexerStepDone;
+	}
+lexerState98:
+	if (p == limit) {
+		state = 98; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 98; goto lexerStepDone;
+	}
+lexerState99:
+	if (p == limit) {
+		state = 99; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 99; goto lexerStepDone;
+	}
+lexerState100:
+	if (p == limit) {
+		state = 100; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 100; goto lexerStepDone;
+	}
+lexerState101:
+	if (p == limit) {
+		state = 101; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 101; goto lexerStepDone;
+	}
+lexerState102:
+	if (p == limit) {
+		state = 102; tokenType = TOKEN_SLASH; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case 92:
+			p++;
+			tokenType = TOKEN_DSLASH;
+			goto lexerState115;
+		default:
+			state = 102; tokenType = TOKEN_SLASH; goto lexerStepDone;
+	}
+lexerState103:
+	if (p == limit) {
+		state = 103; tokenType = TOKEN_PLUS; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '+':
+			p++;
+			tokenType = TOKEN_DPLUS;
+			goto lexerState115;
+		default:
+			state = 103; tokenType = TOKEN_PLUS; goto lexerStepDone;
+	}
+lexerState104:
+	if (p == limit) {
+		state = 104; tokenType = TOKEN_MINUS; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '-':
+			p++;
+			goto lexerState111;
+		case '>':
+			p++;
+			tokenType = TOKEN_RARROW;
+			goto lexerState115;
+		default:
+			state = 104; tokenType = TOKEN_MINUS; goto lexerStepDone;
+	}
+lexerState105:
+	if (p == limit) {
+		state = 105; tokenType = TOKEN_DIVIDE; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 105; tokenType = TOKEN_DIVIDE; goto lexerStepDone;
+	}
+lexerState106:
+	if (p == limit) {
+		state = 106; tokenType = TOKEN_AND; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '&':
+			p++;
+			tokenType = TOKEN_DAND;
+			goto lexerState115;
+		default:
+			state = 106; tokenType = TOKEN_AND; goto lexerStepDone;
+	}
+lexerState107:
+	if (p == limit) {
+		state = 107; tokenType = TOKEN_OR; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '|':
+			p++;
+			tokenType = TOKEN_DOR;
+			goto lexerState115;
+		case '>':
+			p++;
+			tokenType = TOKEN_RFLAG;
+			goto lexerState115;
+		default:
+			state = 107; tokenType = TOKEN_OR; goto lexerStepDone;
+	}
+lexerState108:
+	if (p == limit) {
+		state = 108; tokenType = TOKEN_LT; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '-':
+			p++;
+			goto lexerState109;
+		case '<':
+			p++;
+			tokenType = TOKEN_LS;
+			goto lexerState115;
+		case '=':
+			p++;
+			tokenType = TOKEN_LE;
+			goto lexerState115;
+		case '|':
+			p++;
+			tokenType = TOKEN_LFLAG;
+			goto lexerState115;
+		default:
+			state = 108; tokenType = TOKEN_LT; goto lexerStepDone;
+	}
+lexerState109:
+	if (p == limit) {
+		state = 109; tokenType = TOKEN_LARROW; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '>':
+			p++;
+			tokenType = TOKEN_LRARROW;
+			goto lexerState115;
+		default:
+			state = 109; tokenType = TOKEN_LARROW; goto lexerStepDone;
+	}
+lexerState110:
+	if (p == limit) {
+		state = 110; tokenType = TOKEN_GT; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '>':
+			p++;
+			tokenType = TOKEN_RS;
+			goto lexerState115;
+		case '=':
+			p++;
+			tokenType = TOKEN_GE;
+			goto lexerState115;
+		default:
+			state = 110; tokenType = TOKEN_GT; goto lexerStepDone;
+	}
+lexerState111:
+	if (p == limit) {
+		state = 111; tokenType = TOKEN_DMINUS; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '>':
+			p++;
+			tokenType = TOKEN_DRARROW;
+			goto lexerState115;
+		default:
+			state = 111; tokenType = TOKEN_DMINUS; goto lexerStepDone;
+	}
+lexerState112:
+	if (p == limit) {
+		state = 112; tokenType = TOKEN_QUESTION; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '?':
+			p++;
+			tokenType = TOKEN_DQUESTION;
+			goto lexerState115;
+		default:
+			state = 112; tokenType = TOKEN_QUESTION; goto lexerStepDone;
+	}
+lexerState113:
+	if (p == limit) {
+		state = 113; tokenType = TOKEN_COLON; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case ':':
+			p++;
+			tokenType = TOKEN_DCOLON;
+			goto lexerState115;
+		default:
+			state = 113; tokenType = TOKEN_COLON; goto lexerStepDone;
+	}
+lexerState114:
+	if (p == limit) {
+		state = 114; tokenType = TOKEN_PERIOD; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		case '.':
+			p++;
+			tokenType = TOKEN_DPERIOD;
+			goto lexerState115;
+		default:
+			state = 114; tokenType = TOKEN_PERIOD; goto lexerStepDone;
+	}
+lexerState115:
+	if (p == limit) {
+		state = 115; goto lexerStepDone;
+	}
+	switch ((unsigned char)*p) {
+		default:
+			state = 115; goto lexerStepDone;
+	}
+lexerStepDone:
+	cur = p;
+}
@@ -0,0 +1,4790 @@
+/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */
+
+#define LEXER_NUM_STATES 116
+#define LEXER_NUM_CLASSES 37
+
+static const unsigned char lexerClassOf[256] = {
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	2,
+	0,
+	0,
+	3,
+	4,
+	5,
+	6,
+	7,
+	8,
+	9,
+	10,
+	11,
+	12,
+	13,
+	14,
+	15,
+	15,
+	15,
+	15,
+	15,
+	15,
+	15,
+	16,
+	16,
+	17,
+	18,
+	19,
+	20,
+	21,
+	22,
+	23,
+	24,
+	24,
+	24,
+	24,
+	24,
+	24,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	26,
+	27,
+	28,
+	29,
+	30,
+	0,
+	24,
+	24,
+	24,
+	24,
+	31,
+	24,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	25,
+	32,
+	25,
+	25,
+	33,
+	34,
+	35,
+	36,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+};
+
+static const LexerNode lexerNode[LEXER_NUM_STATES][LEXER_NUM_CLASSES] = {
+	{
+		{ -1, 0 },
+		{ 25, 11 },
+		{ 16, 115 },
+		{ 22, 115 },
+		{ 27, 106 },
+		{ 15, 115 },
+		{ 2, 115 },
+		{ 3, 115 },
+		{ 20, 115 },
+		{ 18, 103 },
+		{ 10, 115 },
+		{ 19, 104 },
+		{ 9, 114 },
+		{ 21, 105 },
+		{ 1, 3 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 14, 113 },
+		{ 12, 115 },
+		{ 23, 108 },
+		{ 8, 10 },
+		{ 24, 110 },
+		{ 13, 112 },
+		{ 17, 115 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 4, 115 },
+		{ 11, 102 },
+		{ 5, 115 },
+		{ 29, 115 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 6, 115 },
+		{ 28, 107 },
+		{ 7, 115 },
+		{ 26, 115 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 4 },
+		{ -1, 0 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 6 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 4 },
+		{ -1, 0 },
+		{ 31, 115 },
+		{ 1, 8 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 6 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 7 },
+		{ -1, 0 },
+		{ 30, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 33, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 34, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 35, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 36, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 37, 111 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 38, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 40, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 39, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 41, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 43, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 42, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 47, 109 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 44, 115 },
+		{ 45, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 46, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 48, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 50, 115 },
+		{ 49, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 51, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 52, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 53, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 54, 115 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+};
@@ -0,0 +1,73 @@
+/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */
+
+#ifndef _LEXER_STRUCT_H_
+#define _LEXER_STRUCT_H_
+
+#include "../src/globalDefs.h"
+
+#include "../src/lexerNodeStruct.h"
+
+#define NUM_TOKENS 57
+
+#define TOKEN_AND 27
+#define TOKEN_AT 17
+#define TOKEN_COLON 14
+#define TOKEN_COMMA 10
+#define TOKEN_COMPLEMENT 26
+#define TOKEN_CQUOTE 15
+#define TOKEN_DAND 41
+#define TOKEN_DCOLON 53
+#define TOKEN_DEQUALS 33
+#define TOKEN_DIVIDE 21
+#define TOKEN_DMINUS 37
+#define TOKEN_DOR 42
+#define TOKEN_DPERIOD 54
+#define TOKEN_DPLUS 36
+#define TOKEN_DQUESTION 52
+#define TOKEN_DRARROW 51
+#define TOKEN_DSLASH 35
+#define TOKEN_EQUALS 8
+#define TOKEN_ERROR 30
+#define TOKEN_FAIL 31
+#define TOKEN_FNUM 32
+#define TOKEN_GE 50
+#define TOKEN_GT 24
+#define TOKEN_ID 0
+#define TOKEN_INUM 1
+#define TOKEN_LARROW 47
+#define TOKEN_LBRACKET 2
+#define TOKEN_LCURLY 6
+#define TOKEN_LE 45
+#define TOKEN_LFLAG 46
+#define TOKEN_LRARROW 48
+#define TOKEN_LS 44
+#define TOKEN_LSQUARE 4
+#define TOKEN_LT 23
+#define TOKEN_MINUS 19
+#define TOKEN_MOD 22
+#define TOKEN_NEQUALS 34
+#define TOKEN_NOT 25
+#define TOKEN_OR 28
+#define TOKEN_PERIOD 9
+#define TOKEN_PLUS 18
+#define TOKEN_QUESTION 13
+#define TOKEN_RARROW 38
+#define TOKEN_RBRACKET 3
+#define TOKEN_RCURLY 7
+#define TOKEN_REGCOMMENT 39
+#define TOKEN_RFLAG 43
+#define TOKEN_RS 49
+#define TOKEN_RSQUARE 5
+#define TOKEN_SEMICOLON 12
+#define TOKEN_SLASH 11
+#define TOKEN_SQUOTE 16
+#define TOKEN_STARCOMMENT 40
+#define TOKEN_TIMES 20
+#define TOKEN_XOR 29
+#define TOKEN_END 55
+#define TOKEN_STD 56
+
+const char *tokenType2String(int tokenType);
+unsigned int string2TokenType(string s);
+
+#endif
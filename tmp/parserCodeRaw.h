@@ -0,0 +1,7455 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+#define NUM_STATES 383
+
+// returns the parse table entry for the given state and label
+inline ParserNode parserTransition(unsigned int state, unsigned int label) {
+	switch (state) {
+		case 0:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_Program:
+					return (ParserNode){ ACTION_GOTO, 1 };
+				case TOKEN_Pipes:
+					return (ParserNode){ ACTION_GOTO, 2 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 3 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 4 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 2 };
+		case 1:
+			switch (label) {
+				case TOKEN_END:
+					return (ParserNode){ ACTION_ACCEPT, 5 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 2:
+			return (ParserNode){ ACTION_REDUCE, 1 };
+		case 3:
+			return (ParserNode){ ACTION_REDUCE, 3 };
+		case 4:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_NonEmptyPipes:
+					return (ParserNode){ ACTION_GOTO, 89 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 90 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 91 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 4 };
+		case 5:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 92 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 11 };
+		case 6:
+			return (ParserNode){ ACTION_REDUCE, 9 };
+		case 7:
+			switch (label) {
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Terms:
+					return (ParserNode){ ACTION_GOTO, 93 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 94 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 24 };
+		case 8:
+			switch (label) {
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 97 };
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 99 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 96 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 98 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 9:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 101 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 105 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 106 };
+				case TOKEN_ImportIdentifier:
+					return (ParserNode){ ACTION_GOTO, 100 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 102 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 103 };
+				case TOKEN_OpenIdentifier:
+					return (ParserNode){ ACTION_GOTO, 104 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 10:
+			return (ParserNode){ ACTION_REDUCE, 26 };
+		case 11:
+			return (ParserNode){ ACTION_REDUCE, 27 };
+		case 12:
+			return (ParserNode){ ACTION_REDUCE, 28 };
+		case 13:
+			return (ParserNode){ ACTION_REDUCE, 29 };
+		case 14:
+			return (ParserNode){ ACTION_REDUCE, 30 };
+		case 15:
+			return (ParserNode){ ACTION_REDUCE, 31 };
+		case 16:
+			return (ParserNode){ ACTION_REDUCE, 32 };
+		case 17:
+			return (ParserNode){ ACTION_REDUCE, 50 };
+		case 18:
+			return (ParserNode){ ACTION_REDUCE, 51 };
+		case 19:
+			return (ParserNode){ ACTION_REDUCE, 52 };
+		case 20:
+			return (ParserNode){ ACTION_REDUCE, 53 };
+		case 21:
+			return (ParserNode){ ACTION_REDUCE, 54 };
+		case 22:
+			return (ParserNode){ ACTION_REDUCE, 55 };
+		case 23:
+			return (ParserNode){ ACTION_REDUCE, 56 };
+		case 24:
+			return (ParserNode){ ACTION_REDUCE, 57 };
+		case 25:
+			return (ParserNode){ ACTION_REDUCE, 36 };
+		case 26:
+			return (ParserNode){ ACTION_REDUCE, 37 };
+		case 27:
+			switch (label) {
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 107 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 108 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 28:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_SingleStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 109 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 110 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 111 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 29:
+			return (ParserNode){ ACTION_REDUCE, 254 };
+		case 30:
+			return (ParserNode){ ACTION_REDUCE, 255 };
+		case 31:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 113 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 32:
+			return (ParserNode){ ACTION_REDUCE, 257 };
+		case 33:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 114 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 34:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 115 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 35:
+			return (ParserNode){ ACTION_REDUCE, 260 };
+		case 36:
+			return (ParserNode){ ACTION_REDUCE, 38 };
+		case 37:
+			return (ParserNode){ ACTION_REDUCE, 39 };
+		case 38:
+			return (ParserNode){ ACTION_REDUCE, 40 };
+		case 39:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 116 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 40:
+			return (ParserNode){ ACTION_REDUCE, 58 };
+		case 41:
+			return (ParserNode){ ACTION_REDUCE, 59 };
+		case 42:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 117 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 43:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 118 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 44:
+			return (ParserNode){ ACTION_REDUCE, 99 };
+		case 45:
+			return (ParserNode){ ACTION_REDUCE, 100 };
+		case 46:
+			return (ParserNode){ ACTION_REDUCE, 101 };
+		case 47:
+			return (ParserNode){ ACTION_REDUCE, 102 };
+		case 48:
+			return (ParserNode){ ACTION_REDUCE, 103 };
+		case 49:
+			return (ParserNode){ ACTION_REDUCE, 104 };
+		case 50:
+			return (ParserNode){ ACTION_REDUCE, 105 };
+		case 51:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_RBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 120 };
+				case TOKEN_ExpList:
+					return (ParserNode){ ACTION_GOTO, 119 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 121 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 52:
+			return (ParserNode){ ACTION_REDUCE, 250 };
+		case 53:
+			return (ParserNode){ ACTION_REDUCE, 251 };
+		case 54:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 144 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 146 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 147 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 151 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_ParamList:
+					return (ParserNode){ ACTION_GOTO, 136 };
+				case TOKEN_RetList:
+					return (ParserNode){ ACTION_GOTO, 137 };
+				case TOKEN_CloneInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 138 };
+				case TOKEN_CopyInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 139 };
+				case TOKEN_MultiFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 140 };
+				case TOKEN_MultiInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 141 };
+				case TOKEN_SingleFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 142 };
+				case TOKEN_SingleInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 143 };
+				case TOKEN_Param:
+					return (ParserNode){ ACTION_GOTO, 145 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 148 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 149 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 150 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 55:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 99 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 158 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 159 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 56:
+			return (ParserNode){ ACTION_REDUCE, 175 };
+		case 57:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 160 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 58:
+			return (ParserNode){ ACTION_REDUCE, 141 };
+		case 59:
+			return (ParserNode){ ACTION_REDUCE, 142 };
+		case 60:
+			return (ParserNode){ ACTION_REDUCE, 143 };
+		case 61:
+			return (ParserNode){ ACTION_REDUCE, 144 };
+		case 62:
+			return (ParserNode){ ACTION_REDUCE, 171 };
+		case 63:
+			return (ParserNode){ ACTION_REDUCE, 172 };
+		case 64:
+			return (ParserNode){ ACTION_REDUCE, 173 };
+		case 65:
+			return (ParserNode){ ACTION_REDUCE, 174 };
+		case 66:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 3 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 4 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Pipes:
+					return (ParserNode){ ACTION_GOTO, 161 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 2 };
+		case 67:
+			return (ParserNode){ ACTION_REDUCE, 145 };
+		case 68:
+			return (ParserNode){ ACTION_REDUCE, 146 };
+		case 69:
+			return (ParserNode){ ACTION_REDUCE, 147 };
+		case 70:
+			return (ParserNode){ ACTION_REDUCE, 148 };
+		case 71:
+			return (ParserNode){ ACTION_REDUCE, 149 };
+		case 72:
+			return (ParserNode){ ACTION_REDUCE, 150 };
+		case 73:
+			return (ParserNode){ ACTION_REDUCE, 151 };
+		case 74:
+			return (ParserNode){ ACTION_REDUCE, 152 };
+		case 75:
+			return (ParserNode){ ACTION_REDUCE, 153 };
+		case 76:
+			return (ParserNode){ ACTION_REDUCE, 154 };
+		case 77:
+			return (ParserNode){ ACTION_REDUCE, 155 };
+		case 78:
+			return (ParserNode){ ACTION_REDUCE, 156 };
+		case 79:
+			return (ParserNode){ ACTION_REDUCE, 157 };
+		case 80:
+			return (ParserNode){ ACTION_REDUCE, 158 };
+		case 81:
+			return (ParserNode){ ACTION_REDUCE, 159 };
+		case 82:
+			return (ParserNode){ ACTION_REDUCE, 160 };
+		case 83:
+			return (ParserNode){ ACTION_REDUCE, 161 };
+		case 84:
+			return (ParserNode){ ACTION_REDUCE, 162 };
+		case 85:
+			return (ParserNode){ ACTION_REDUCE, 163 };
+		case 86:
+			return (ParserNode){ ACTION_REDUCE, 164 };
+		case 87:
+			return (ParserNode){ ACTION_REDUCE, 165 };
+		case 88:
+			return (ParserNode){ ACTION_REDUCE, 166 };
+		case 89:
+			return (ParserNode){ ACTION_REDUCE, 5 };
+		case 90:
+			return (ParserNode){ ACTION_REDUCE, 6 };
+		case 91:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 90 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 91 };
+				case TOKEN_NonEmptyPipes:
+					return (ParserNode){ ACTION_GOTO, 162 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 7 };
+		case 92:
+			return (ParserNode){ ACTION_REDUCE, 10 };
+		case 93:
+			return (ParserNode){ ACTION_REDUCE, 23 };
+		case 94:
+			switch (label) {
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 94 };
+				case TOKEN_Terms:
+					return (ParserNode){ ACTION_GOTO, 163 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 24 };
+		case 95:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 99 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 96 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 98 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 96:
+			return (ParserNode){ ACTION_REDUCE, 108 };
+		case 97:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 166 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_BlankInstantiation:
+					return (ParserNode){ ACTION_GOTO, 164 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 165 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 98:
+			return (ParserNode){ ACTION_REDUCE, 106 };
+		case 99:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 168 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 169 };
+				case TOKEN_ArrayAccess:
+					return (ParserNode){ ACTION_GOTO, 167 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 100:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 170 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 16 };
+		case 101:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 105 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 106 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 102 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 103 };
+				case TOKEN_OpenIdentifier:
+					return (ParserNode){ ACTION_GOTO, 104 };
+				case TOKEN_ImportIdentifier:
+					return (ParserNode){ ACTION_GOTO, 171 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 102:
+			return (ParserNode){ ACTION_REDUCE, 20 };
+		case 103:
+			return (ParserNode){ ACTION_REDUCE, 21 };
+		case 104:
+			return (ParserNode){ ACTION_REDUCE, 22 };
+		case 105:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 173 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 96 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 98 };
+				case TOKEN_OpenIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 172 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 106:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 173 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 158 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 159 };
+				case TOKEN_OpenIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 174 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 107:
+			switch (label) {
+				case TOKEN_COLON:
+					return (ParserNode){ ACTION_SHIFT, 175 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 26 };
+		case 108:
+			return (ParserNode){ ACTION_REDUCE, 33 };
+		case 109:
+			return (ParserNode){ ACTION_REDUCE, 253 };
+		case 110:
+			return (ParserNode){ ACTION_REDUCE, 41 };
+		case 111:
+			return (ParserNode){ ACTION_REDUCE, 42 };
+		case 112:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 146 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 147 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 151 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 176 };
+				case TOKEN_ParamList:
+					return (ParserNode){ ACTION_GOTO, 136 };
+				case TOKEN_RetList:
+					return (ParserNode){ ACTION_GOTO, 137 };
+				case TOKEN_CloneInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 138 };
+				case TOKEN_CopyInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 139 };
+				case TOKEN_MultiFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 140 };
+				case TOKEN_MultiInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 141 };
+				case TOKEN_SingleFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 142 };
+				case TOKEN_SingleInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 143 };
+				case TOKEN_Param:
+					return (ParserNode){ ACTION_GOTO, 145 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 148 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 149 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 150 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 113:
+			return (ParserNode){ ACTION_REDUCE, 256 };
+		case 114:
+			return (ParserNode){ ACTION_REDUCE, 258 };
+		case 115:
+			return (ParserNode){ ACTION_REDUCE, 259 };
+		case 116:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_COLON:
+					return (ParserNode){ ACTION_SHIFT, 180 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LabeledTerms:
+					return (ParserNode){ ACTION_GOTO, 177 };
+				case TOKEN_LastLabeledTerm:
+					return (ParserNode){ ACTION_GOTO, 178 };
+				case TOKEN_LabeledTerm:
+					return (ParserNode){ ACTION_GOTO, 179 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 181 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 117:
+			return (ParserNode){ ACTION_REDUCE, 248 };
+		case 118:
+			return (ParserNode){ ACTION_REDUCE, 249 };
+		case 119:
+			switch (label) {
+				case TOKEN_RBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 182 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 120:
+			return (ParserNode){ ACTION_REDUCE, 60 };
+		case 121:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 187 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 201 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 66 };
+		case 122:
+			return (ParserNode){ ACTION_REDUCE, 68 };
+		case 123:
+			switch (label) {
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 202 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 87 };
+		case 124:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 203 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 125:
+			return (ParserNode){ ACTION_REDUCE, 89 };
+		case 126:
+			return (ParserNode){ ACTION_REDUCE, 90 };
+		case 127:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 204 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 205 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 128:
+			return (ParserNode){ ACTION_REDUCE, 93 };
+		case 129:
+			return (ParserNode){ ACTION_REDUCE, 94 };
+		case 130:
+			return (ParserNode){ ACTION_REDUCE, 95 };
+		case 131:
+			return (ParserNode){ ACTION_REDUCE, 96 };
+		case 132:
+			return (ParserNode){ ACTION_REDUCE, 97 };
+		case 133:
+			return (ParserNode){ ACTION_REDUCE, 167 };
+		case 134:
+			return (ParserNode){ ACTION_REDUCE, 168 };
+		case 135:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 206 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 136:
+			switch (label) {
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 146 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 207 };
+				case TOKEN_RetList:
+					return (ParserNode){ ACTION_GOTO, 208 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 137:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 209 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 138:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 210 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 139:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 211 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 140:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 212 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 141:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 213 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 142:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 214 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 143:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 215 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 144:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 216 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 252 };
+		case 145:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 217 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 183 };
+		case 146:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 218 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 219 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 147:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 222 };
+				case TOKEN_MultiInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 223 };
+				case TOKEN_SingleInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 224 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 225 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 148:
+			switch (label) {
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 226 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 227 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 149:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 231 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 235 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_REDUCE, 190 };
+				case TOKEN_MultiInitInstantiationTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 228 };
+				case TOKEN_TypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 229 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 230 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 232 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 233 };
+				case TOKEN_PoolTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 234 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 132 };
+		case 150:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 237 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 151:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 238 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 152:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 239 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 98 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 153:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 239 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 159 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 154:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 231 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 235 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 232 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 233 };
+				case TOKEN_PoolTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 234 };
+				case TOKEN_TypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 240 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 241 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 191 };
+		case 155:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 231 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 235 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 232 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 233 };
+				case TOKEN_PoolTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 234 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 241 };
+				case TOKEN_TypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 242 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 192 };
+		case 156:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 245 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_ExplicitRetList:
+					return (ParserNode){ ACTION_GOTO, 243 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 244 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 157:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 247 };
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 251 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 252 };
+				case TOKEN_ObjectTypeList:
+					return (ParserNode){ ACTION_GOTO, 246 };
+				case TOKEN_InstructorType:
+					return (ParserNode){ ACTION_GOTO, 248 };
+				case TOKEN_OutstructorType:
+					return (ParserNode){ ACTION_GOTO, 249 };
+				case TOKEN_MemberType:
+					return (ParserNode){ ACTION_GOTO, 250 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 158:
+			return (ParserNode){ ACTION_REDUCE, 109 };
+		case 159:
+			return (ParserNode){ ACTION_REDUCE, 107 };
+		case 160:
+			return (ParserNode){ ACTION_REDUCE, 176 };
+		case 161:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 253 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 162:
+			return (ParserNode){ ACTION_REDUCE, 8 };
+		case 163:
+			return (ParserNode){ ACTION_REDUCE, 25 };
+		case 164:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 254 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 14 };
+		case 165:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 255 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 12 };
+		case 166:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 146 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 147 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 151 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 176 };
+				case TOKEN_ParamList:
+					return (ParserNode){ ACTION_GOTO, 136 };
+				case TOKEN_RetList:
+					return (ParserNode){ ACTION_GOTO, 137 };
+				case TOKEN_CloneInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 138 };
+				case TOKEN_CopyInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 139 };
+				case TOKEN_MultiFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 140 };
+				case TOKEN_MultiInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 141 };
+				case TOKEN_SingleFlowInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 142 };
+				case TOKEN_SingleInitInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 143 };
+				case TOKEN_Param:
+					return (ParserNode){ ACTION_GOTO, 145 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 148 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 150 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_BlankInstantiationSource:
+					return (ParserNode){ ACTION_GOTO, 256 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 257 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 167:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 259 };
+				case TOKEN_IdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 258 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 118 };
+		case 168:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 99 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 260 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 261 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 169:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 262 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 170:
+			return (ParserNode){ ACTION_REDUCE, 17 };
+		case 171:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 263 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 172:
+			return (ParserNode){ ACTION_REDUCE, 110 };
+		case 173:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 169 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 264 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 265 };
+				case TOKEN_ArrayAccess:
+					return (ParserNode){ ACTION_GOTO, 167 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 174:
+			return (ParserNode){ ACTION_REDUCE, 111 };
+		case 175:
+			switch (label) {
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 266 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 267 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 176:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 216 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 177:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 268 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 178:
+			return (ParserNode){ ACTION_REDUCE, 44 };
+		case 179:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_COLON:
+					return (ParserNode){ ACTION_SHIFT, 180 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LastLabeledTerm:
+					return (ParserNode){ ACTION_GOTO, 178 };
+				case TOKEN_LabeledTerm:
+					return (ParserNode){ ACTION_GOTO, 179 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 181 };
+				case TOKEN_LabeledTerms:
+					return (ParserNode){ ACTION_GOTO, 269 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 180:
+			switch (label) {
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 270 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 181:
+			switch (label) {
+				case TOKEN_COLON:
+					return (ParserNode){ ACTION_SHIFT, 271 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 182:
+			return (ParserNode){ ACTION_REDUCE, 61 };
+		case 183:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 272 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 184:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 273 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 185:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 274 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 186:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 275 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 187:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 276 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 188:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 277 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 189:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 278 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 190:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 279 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 191:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 280 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 192:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 281 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 193:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 282 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 194:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 283 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 195:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 284 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 196:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 285 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 197:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 286 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 198:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 287 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 199:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 288 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 200:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 289 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 201:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 121 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_ExpList:
+					return (ParserNode){ ACTION_GOTO, 290 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 202:
+			return (ParserNode){ ACTION_REDUCE, 98 };
+		case 203:
+			return (ParserNode){ ACTION_REDUCE, 88 };
+		case 204:
+			return (ParserNode){ ACTION_REDUCE, 92 };
+		case 205:
+			return (ParserNode){ ACTION_REDUCE, 91 };
+		case 206:
+			return (ParserNode){ ACTION_REDUCE, 177 };
+		case 207:
+			return (ParserNode){ ACTION_REDUCE, 178 };
+		case 208:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 291 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 209:
+			return (ParserNode){ ACTION_REDUCE, 180 };
+		case 210:
+			return (ParserNode){ ACTION_REDUCE, 130 };
+		case 211:
+			return (ParserNode){ ACTION_REDUCE, 129 };
+		case 212:
+			return (ParserNode){ ACTION_REDUCE, 128 };
+		case 213:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 292 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 125 };
+		case 214:
+			return (ParserNode){ ACTION_REDUCE, 127 };
+		case 215:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 295 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 293 };
+				case TOKEN_CurlyBracketedExp:
+					return (ParserNode){ ACTION_GOTO, 294 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 122 };
+		case 216:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 302 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_ObjectPipes:
+					return (ParserNode){ ACTION_GOTO, 296 };
+				case TOKEN_LastInstructor:
+					return (ParserNode){ ACTION_GOTO, 297 };
+				case TOKEN_Instructor:
+					return (ParserNode){ ACTION_GOTO, 298 };
+				case TOKEN_Outstructor:
+					return (ParserNode){ ACTION_GOTO, 299 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 300 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 301 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 217:
+			switch (label) {
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 151 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_Param:
+					return (ParserNode){ ACTION_GOTO, 145 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 150 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_ParamList:
+					return (ParserNode){ ACTION_GOTO, 303 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 218:
+			return (ParserNode){ ACTION_REDUCE, 186 };
+		case 219:
+			return (ParserNode){ ACTION_REDUCE, 185 };
+		case 220:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 304 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 228 };
+		case 221:
+			switch (label) {
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 231 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 235 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_TypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 229 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 232 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 233 };
+				case TOKEN_PoolTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 234 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 241 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 190 };
+		case 222:
+			return (ParserNode){ ACTION_REDUCE, 138 };
+		case 223:
+			return (ParserNode){ ACTION_REDUCE, 135 };
+		case 224:
+			return (ParserNode){ ACTION_REDUCE, 134 };
+		case 225:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 306 };
+				case TOKEN_MultiInitInstantiationTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 228 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 305 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 132 };
+		case 226:
+			return (ParserNode){ ACTION_REDUCE, 137 };
+		case 227:
+			return (ParserNode){ ACTION_REDUCE, 136 };
+		case 228:
+			return (ParserNode){ ACTION_REDUCE, 133 };
+		case 229:
+			return (ParserNode){ ACTION_REDUCE, 193 };
+		case 230:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_REDUCE, 204 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 199 };
+		case 231:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 307 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 196 };
+		case 232:
+			return (ParserNode){ ACTION_REDUCE, 197 };
+		case 233:
+			return (ParserNode){ ACTION_REDUCE, 198 };
+		case 234:
+			return (ParserNode){ ACTION_REDUCE, 200 };
+		case 235:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 309 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 308 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 236:
+			switch (label) {
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 310 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 207 };
+		case 237:
+			return (ParserNode){ ACTION_REDUCE, 188 };
+		case 238:
+			return (ParserNode){ ACTION_REDUCE, 189 };
+		case 239:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 311 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 240:
+			return (ParserNode){ ACTION_REDUCE, 194 };
+		case 241:
+			return (ParserNode){ ACTION_REDUCE, 199 };
+		case 242:
+			return (ParserNode){ ACTION_REDUCE, 195 };
+		case 243:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 312 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 244:
+			switch (label) {
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 245 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 314 };
+				case TOKEN_ExplicitRetList:
+					return (ParserNode){ ACTION_GOTO, 313 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 245:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 315 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 246:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 316 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 247:
+			return (ParserNode){ ACTION_REDUCE, 216 };
+		case 248:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 317 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 218 };
+		case 249:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 318 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 220 };
+		case 250:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 319 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 222 };
+		case 251:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 320 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 224 };
+		case 252:
+			switch (label) {
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 321 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 253:
+			return (ParserNode){ ACTION_REDUCE, 230 };
+		case 254:
+			return (ParserNode){ ACTION_REDUCE, 15 };
+		case 255:
+			return (ParserNode){ ACTION_REDUCE, 13 };
+		case 256:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 322 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 257:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 235 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 236 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 324 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_REDUCE, 190 };
+				case TOKEN_MultiInitInstantiationTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 228 };
+				case TOKEN_TypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 229 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 230 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 232 };
+				case TOKEN_BlankInstantiationTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 323 };
+				case TOKEN_StreamTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 325 };
+				case TOKEN_PoolTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 326 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 132 };
+		case 258:
+			return (ParserNode){ ACTION_REDUCE, 115 };
+		case 259:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 169 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 328 };
+				case TOKEN_ArrayAccess:
+					return (ParserNode){ ACTION_GOTO, 327 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 260:
+			return (ParserNode){ ACTION_REDUCE, 114 };
+		case 261:
+			return (ParserNode){ ACTION_REDUCE, 113 };
+		case 262:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 187 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				case TOKEN_COLON:
+					return (ParserNode){ ACTION_SHIFT, 329 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 330 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 263:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 331 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 18 };
+		case 264:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 173 };
+				case TOKEN_ArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 260 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 261 };
+				case TOKEN_OpenIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 332 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 265:
+			return (ParserNode){ ACTION_REDUCE, 116 };
+		case 266:
+			return (ParserNode){ ACTION_REDUCE, 34 };
+		case 267:
+			return (ParserNode){ ACTION_REDUCE, 35 };
+		case 268:
+			return (ParserNode){ ACTION_REDUCE, 43 };
+		case 269:
+			return (ParserNode){ ACTION_REDUCE, 45 };
+		case 270:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 333 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 48 };
+		case 271:
+			switch (label) {
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 334 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 272:
+			switch (label) {
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 73 };
+		case 273:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 70 };
+		case 274:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 74 };
+		case 275:
+			return (ParserNode){ ACTION_REDUCE, 83 };
+		case 276:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 69 };
+		case 277:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 79 };
+		case 278:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 77 };
+		case 279:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 78 };
+		case 280:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 80 };
+		case 281:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 76 };
+		case 282:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 86 };
+		case 283:
+			return (ParserNode){ ACTION_REDUCE, 84 };
+		case 284:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 75 };
+		case 285:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 71 };
+		case 286:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 85 };
+		case 287:
+			switch (label) {
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 81 };
+		case 288:
+			return (ParserNode){ ACTION_REDUCE, 82 };
+		case 289:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 72 };
+		case 290:
+			return (ParserNode){ ACTION_REDUCE, 67 };
+		case 291:
+			return (ParserNode){ ACTION_REDUCE, 179 };
+		case 292:
+			return (ParserNode){ ACTION_REDUCE, 126 };
+		case 293:
+			return (ParserNode){ ACTION_REDUCE, 123 };
+		case 294:
+			return (ParserNode){ ACTION_REDUCE, 124 };
+		case 295:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 295 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 121 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_CurlyBracketedExpList:
+					return (ParserNode){ ACTION_GOTO, 335 };
+				case TOKEN_ExpList:
+					return (ParserNode){ ACTION_GOTO, 336 };
+				case TOKEN_CurlyBracketedExp:
+					return (ParserNode){ ACTION_GOTO, 337 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 296:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 338 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 297:
+			return (ParserNode){ ACTION_REDUCE, 232 };
+		case 298:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 302 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LastInstructor:
+					return (ParserNode){ ACTION_GOTO, 297 };
+				case TOKEN_Instructor:
+					return (ParserNode){ ACTION_GOTO, 298 };
+				case TOKEN_Outstructor:
+					return (ParserNode){ ACTION_GOTO, 299 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 300 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 301 };
+				case TOKEN_ObjectPipes:
+					return (ParserNode){ ACTION_GOTO, 339 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 233 };
+		case 299:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 302 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LastInstructor:
+					return (ParserNode){ ACTION_GOTO, 297 };
+				case TOKEN_Instructor:
+					return (ParserNode){ ACTION_GOTO, 298 };
+				case TOKEN_Outstructor:
+					return (ParserNode){ ACTION_GOTO, 299 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 300 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 301 };
+				case TOKEN_ObjectPipes:
+					return (ParserNode){ ACTION_GOTO, 340 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 235 };
+		case 300:
+			return (ParserNode){ ACTION_REDUCE, 237 };
+		case 301:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 8 };
+				case TOKEN_AT:
+					return (ParserNode){ ACTION_SHIFT, 9 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 27 };
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 28 };
+				case TOKEN_RFLAG:
+					return (ParserNode){ ACTION_SHIFT, 29 };
+				case TOKEN_LFLAG:
+					return (ParserNode){ ACTION_SHIFT, 30 };
+				case TOKEN_DCOLON:
+					return (ParserNode){ ACTION_SHIFT, 31 };
+				case TOKEN_LARROW:
+					return (ParserNode){ ACTION_SHIFT, 32 };
+				case TOKEN_RARROW:
+					return (ParserNode){ ACTION_SHIFT, 33 };
+				case TOKEN_LRARROW:
+					return (ParserNode){ ACTION_SHIFT, 34 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 35 };
+				case TOKEN_DQUESTION:
+					return (ParserNode){ ACTION_SHIFT, 39 };
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DSLASH:
+					return (ParserNode){ ACTION_SHIFT, 53 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 54 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 69 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 70 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 71 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 72 };
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 73 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 74 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 75 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 76 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 77 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 78 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 79 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 80 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 81 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 82 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 83 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 84 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_DPLUS:
+					return (ParserNode){ ACTION_SHIFT, 87 };
+				case TOKEN_DMINUS:
+					return (ParserNode){ ACTION_SHIFT, 88 };
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 302 };
+				case TOKEN_NonEmptyTerms:
+					return (ParserNode){ ACTION_GOTO, 5 };
+				case TOKEN_Declaration:
+					return (ParserNode){ ACTION_GOTO, 6 };
+				case TOKEN_Term:
+					return (ParserNode){ ACTION_GOTO, 7 };
+				case TOKEN_ClosedTerm:
+					return (ParserNode){ ACTION_GOTO, 10 };
+				case TOKEN_OpenTerm:
+					return (ParserNode){ ACTION_GOTO, 11 };
+				case TOKEN_DynamicTerm:
+					return (ParserNode){ ACTION_GOTO, 12 };
+				case TOKEN_SimpleTerm:
+					return (ParserNode){ ACTION_GOTO, 13 };
+				case TOKEN_ClosedCondTerm:
+					return (ParserNode){ ACTION_GOTO, 14 };
+				case TOKEN_SimpleCondTerm:
+					return (ParserNode){ ACTION_GOTO, 15 };
+				case TOKEN_OpenCondTerm:
+					return (ParserNode){ ACTION_GOTO, 16 };
+				case TOKEN_Compound:
+					return (ParserNode){ ACTION_GOTO, 17 };
+				case TOKEN_Pack:
+					return (ParserNode){ ACTION_GOTO, 18 };
+				case TOKEN_Unpack:
+					return (ParserNode){ ACTION_GOTO, 19 };
+				case TOKEN_Link:
+					return (ParserNode){ ACTION_GOTO, 20 };
+				case TOKEN_Loopback:
+					return (ParserNode){ ACTION_GOTO, 21 };
+				case TOKEN_Send:
+					return (ParserNode){ ACTION_GOTO, 22 };
+				case TOKEN_Swap:
+					return (ParserNode){ ACTION_GOTO, 23 };
+				case TOKEN_Return:
+					return (ParserNode){ ACTION_GOTO, 24 };
+				case TOKEN_StaticTerm:
+					return (ParserNode){ ACTION_GOTO, 25 };
+				case TOKEN_SwitchTerm:
+					return (ParserNode){ ACTION_GOTO, 26 };
+				case TOKEN_TypedStaticTerm:
+					return (ParserNode){ ACTION_GOTO, 36 };
+				case TOKEN_SingleAccess:
+					return (ParserNode){ ACTION_GOTO, 37 };
+				case TOKEN_MultiAccess:
+					return (ParserNode){ ACTION_GOTO, 38 };
+				case TOKEN_Node:
+					return (ParserNode){ ACTION_GOTO, 40 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 41 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 42 };
+				case TOKEN_MultiAccessor:
+					return (ParserNode){ ACTION_GOTO, 43 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 44 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 45 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 46 };
+				case TOKEN_Filter:
+					return (ParserNode){ ACTION_GOTO, 47 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 48 };
+				case TOKEN_PrimOpNode:
+					return (ParserNode){ ACTION_GOTO, 49 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 50 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 56 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 57 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 58 };
+				case TOKEN_InfixOp:
+					return (ParserNode){ ACTION_GOTO, 59 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 60 };
+				case TOKEN_PostfixOp:
+					return (ParserNode){ ACTION_GOTO, 61 };
+				case TOKEN_LastInstructor:
+					return (ParserNode){ ACTION_GOTO, 297 };
+				case TOKEN_Instructor:
+					return (ParserNode){ ACTION_GOTO, 298 };
+				case TOKEN_Outstructor:
+					return (ParserNode){ ACTION_GOTO, 299 };
+				case TOKEN_LastPipe:
+					return (ParserNode){ ACTION_GOTO, 300 };
+				case TOKEN_Pipe:
+					return (ParserNode){ ACTION_GOTO, 301 };
+				case TOKEN_ObjectPipes:
+					return (ParserNode){ ACTION_GOTO, 341 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 238 };
+		case 302:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 344 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 346 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 342 };
+				case TOKEN_NonRetFilterHeader:
+					return (ParserNode){ ACTION_GOTO, 343 };
+				case TOKEN_RetFilterHeader:
+					return (ParserNode){ ACTION_GOTO, 345 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 244 };
+		case 303:
+			return (ParserNode){ ACTION_REDUCE, 184 };
+		case 304:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 347 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 305:
+			return (ParserNode){ ACTION_REDUCE, 204 };
+		case 306:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 308 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 307:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 348 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 308:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 187 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 349 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 309:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 351 };
+				case TOKEN_ListTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 350 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 205 };
+		case 310:
+			return (ParserNode){ ACTION_REDUCE, 208 };
+		case 311:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 239 };
+				case TOKEN_NonArrayedIdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 261 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 112 };
+		case 312:
+			return (ParserNode){ ACTION_REDUCE, 215 };
+		case 313:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 352 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 314:
+			return (ParserNode){ ACTION_REDUCE, 213 };
+		case 315:
+			return (ParserNode){ ACTION_REDUCE, 187 };
+		case 316:
+			return (ParserNode){ ACTION_REDUCE, 217 };
+		case 317:
+			switch (label) {
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 251 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 252 };
+				case TOKEN_InstructorType:
+					return (ParserNode){ ACTION_GOTO, 248 };
+				case TOKEN_OutstructorType:
+					return (ParserNode){ ACTION_GOTO, 249 };
+				case TOKEN_MemberType:
+					return (ParserNode){ ACTION_GOTO, 250 };
+				case TOKEN_ObjectTypeList:
+					return (ParserNode){ ACTION_GOTO, 353 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 318:
+			switch (label) {
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 251 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 252 };
+				case TOKEN_InstructorType:
+					return (ParserNode){ ACTION_GOTO, 248 };
+				case TOKEN_OutstructorType:
+					return (ParserNode){ ACTION_GOTO, 249 };
+				case TOKEN_MemberType:
+					return (ParserNode){ ACTION_GOTO, 250 };
+				case TOKEN_ObjectTypeList:
+					return (ParserNode){ ACTION_GOTO, 354 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 319:
+			switch (label) {
+				case TOKEN_EQUALS:
+					return (ParserNode){ ACTION_SHIFT, 251 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 252 };
+				case TOKEN_InstructorType:
+					return (ParserNode){ ACTION_GOTO, 248 };
+				case TOKEN_OutstructorType:
+					return (ParserNode){ ACTION_GOTO, 249 };
+				case TOKEN_MemberType:
+					return (ParserNode){ ACTION_GOTO, 250 };
+				case TOKEN_ObjectTypeList:
+					return (ParserNode){ ACTION_GOTO, 355 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 320:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 357 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 356 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 321:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 358 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 322:
+			return (ParserNode){ ACTION_REDUCE, 121 };
+		case 323:
+			return (ParserNode){ ACTION_REDUCE, 131 };
+		case 324:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 307 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_REDUCE, 201 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 196 };
+		case 325:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_REDUCE, 202 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 198 };
+		case 326:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_REDUCE, 203 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 200 };
+		case 327:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 259 };
+				case TOKEN_IdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 359 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 118 };
+		case 328:
+			switch (label) {
+				case TOKEN_PERIOD:
+					return (ParserNode){ ACTION_SHIFT, 259 };
+				case TOKEN_IdentifierSuffix:
+					return (ParserNode){ ACTION_GOTO, 360 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 118 };
+		case 329:
+			switch (label) {
+				case TOKEN_LBRACKET:
+					return (ParserNode){ ACTION_SHIFT, 51 };
+				case TOKEN_SLASH:
+					return (ParserNode){ ACTION_SHIFT, 52 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 55 };
+				case TOKEN_INUM:
+					return (ParserNode){ ACTION_SHIFT, 62 };
+				case TOKEN_FNUM:
+					return (ParserNode){ ACTION_SHIFT, 63 };
+				case TOKEN_CQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 64 };
+				case TOKEN_SQUOTE:
+					return (ParserNode){ ACTION_SHIFT, 65 };
+				case TOKEN_NOT:
+					return (ParserNode){ ACTION_SHIFT, 67 };
+				case TOKEN_COMPLEMENT:
+					return (ParserNode){ ACTION_SHIFT, 68 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 85 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 86 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 95 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 112 };
+				case TOKEN_Primary:
+					return (ParserNode){ ACTION_GOTO, 122 };
+				case TOKEN_PrimaryBase:
+					return (ParserNode){ ACTION_GOTO, 123 };
+				case TOKEN_PrefixOrMultiOp:
+					return (ParserNode){ ACTION_GOTO, 124 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 125 };
+				case TOKEN_ArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 126 };
+				case TOKEN_SingleAccessor:
+					return (ParserNode){ ACTION_GOTO, 127 };
+				case TOKEN_Instantiation:
+					return (ParserNode){ ACTION_GOTO, 128 };
+				case TOKEN_ExplicitFilter:
+					return (ParserNode){ ACTION_GOTO, 129 };
+				case TOKEN_Object:
+					return (ParserNode){ ACTION_GOTO, 130 };
+				case TOKEN_PrimLiteral:
+					return (ParserNode){ ACTION_GOTO, 131 };
+				case TOKEN_BracketedExp:
+					return (ParserNode){ ACTION_GOTO, 132 };
+				case TOKEN_PrefixOp:
+					return (ParserNode){ ACTION_GOTO, 133 };
+				case TOKEN_MultiOp:
+					return (ParserNode){ ACTION_GOTO, 134 };
+				case TOKEN_FilterHeader:
+					return (ParserNode){ ACTION_GOTO, 135 };
+				case TOKEN_Exp:
+					return (ParserNode){ ACTION_GOTO, 361 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 330:
+			return (ParserNode){ ACTION_REDUCE, 139 };
+		case 331:
+			return (ParserNode){ ACTION_REDUCE, 19 };
+		case 332:
+			return (ParserNode){ ACTION_REDUCE, 117 };
+		case 333:
+			return (ParserNode){ ACTION_REDUCE, 49 };
+		case 334:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 362 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 46 };
+		case 335:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 363 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 336:
+			switch (label) {
+				case TOKEN_RCURLY:
+					return (ParserNode){ ACTION_SHIFT, 364 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 337:
+			switch (label) {
+				case TOKEN_COMMA:
+					return (ParserNode){ ACTION_SHIFT, 365 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 62 };
+		case 338:
+			return (ParserNode){ ACTION_REDUCE, 231 };
+		case 339:
+			return (ParserNode){ ACTION_REDUCE, 234 };
+		case 340:
+			return (ParserNode){ ACTION_REDUCE, 236 };
+		case 341:
+			return (ParserNode){ ACTION_REDUCE, 239 };
+		case 342:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 366 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 245 };
+		case 343:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 367 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 344:
+			return (ParserNode){ ACTION_REDUCE, 240 };
+		case 345:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 66 };
+				case TOKEN_Block:
+					return (ParserNode){ ACTION_GOTO, 368 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 346:
+			switch (label) {
+				case TOKEN_DRARROW:
+					return (ParserNode){ ACTION_SHIFT, 146 };
+				case TOKEN_QUESTION:
+					return (ParserNode){ ACTION_SHIFT, 151 };
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_Param:
+					return (ParserNode){ ACTION_GOTO, 145 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 150 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_ParamList:
+					return (ParserNode){ ACTION_GOTO, 369 };
+				case TOKEN_RetList:
+					return (ParserNode){ ACTION_GOTO, 370 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 347:
+			return (ParserNode){ ACTION_REDUCE, 229 };
+		case 348:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 187 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 371 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 349:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 306 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 372 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 209 };
+		case 350:
+			return (ParserNode){ ACTION_REDUCE, 206 };
+		case 351:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 309 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 352:
+			return (ParserNode){ ACTION_REDUCE, 214 };
+		case 353:
+			return (ParserNode){ ACTION_REDUCE, 219 };
+		case 354:
+			return (ParserNode){ ACTION_REDUCE, 221 };
+		case 355:
+			return (ParserNode){ ACTION_REDUCE, 223 };
+		case 356:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 373 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 357:
+			switch (label) {
+				case TOKEN_ID:
+					return (ParserNode){ ACTION_SHIFT, 152 };
+				case TOKEN_DPERIOD:
+					return (ParserNode){ ACTION_SHIFT, 153 };
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 156 };
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 157 };
+				case TOKEN_FilterType:
+					return (ParserNode){ ACTION_GOTO, 154 };
+				case TOKEN_ObjectType:
+					return (ParserNode){ ACTION_GOTO, 155 };
+				case TOKEN_Type:
+					return (ParserNode){ ACTION_GOTO, 220 };
+				case TOKEN_NonArrayedIdentifier:
+					return (ParserNode){ ACTION_GOTO, 221 };
+				case TOKEN_TypeList:
+					return (ParserNode){ ACTION_GOTO, 374 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 358:
+			return (ParserNode){ ACTION_REDUCE, 227 };
+		case 359:
+			return (ParserNode){ ACTION_REDUCE, 120 };
+		case 360:
+			return (ParserNode){ ACTION_REDUCE, 119 };
+		case 361:
+			switch (label) {
+				case TOKEN_AND:
+					return (ParserNode){ ACTION_SHIFT, 183 };
+				case TOKEN_DAND:
+					return (ParserNode){ ACTION_SHIFT, 184 };
+				case TOKEN_DEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 185 };
+				case TOKEN_DIVIDE:
+					return (ParserNode){ ACTION_SHIFT, 186 };
+				case TOKEN_DOR:
+					return (ParserNode){ ACTION_SHIFT, 187 };
+				case TOKEN_GE:
+					return (ParserNode){ ACTION_SHIFT, 188 };
+				case TOKEN_GT:
+					return (ParserNode){ ACTION_SHIFT, 189 };
+				case TOKEN_LE:
+					return (ParserNode){ ACTION_SHIFT, 190 };
+				case TOKEN_LS:
+					return (ParserNode){ ACTION_SHIFT, 191 };
+				case TOKEN_LT:
+					return (ParserNode){ ACTION_SHIFT, 192 };
+				case TOKEN_MINUS:
+					return (ParserNode){ ACTION_SHIFT, 193 };
+				case TOKEN_MOD:
+					return (ParserNode){ ACTION_SHIFT, 194 };
+				case TOKEN_NEQUALS:
+					return (ParserNode){ ACTION_SHIFT, 195 };
+				case TOKEN_OR:
+					return (ParserNode){ ACTION_SHIFT, 196 };
+				case TOKEN_PLUS:
+					return (ParserNode){ ACTION_SHIFT, 197 };
+				case TOKEN_RS:
+					return (ParserNode){ ACTION_SHIFT, 198 };
+				case TOKEN_TIMES:
+					return (ParserNode){ ACTION_SHIFT, 199 };
+				case TOKEN_XOR:
+					return (ParserNode){ ACTION_SHIFT, 200 };
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 375 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 362:
+			return (ParserNode){ ACTION_REDUCE, 47 };
+		case 363:
+			return (ParserNode){ ACTION_REDUCE, 65 };
+		case 364:
+			return (ParserNode){ ACTION_REDUCE, 64 };
+		case 365:
+			switch (label) {
+				case TOKEN_LCURLY:
+					return (ParserNode){ ACTION_SHIFT, 295 };
+				case TOKEN_CurlyBracketedExp:
+					return (ParserNode){ ACTION_GOTO, 337 };
+				case TOKEN_CurlyBracketedExpList:
+					return (ParserNode){ ACTION_GOTO, 376 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 366:
+			return (ParserNode){ ACTION_REDUCE, 241 };
+		case 367:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 377 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 242 };
+		case 368:
+			switch (label) {
+				case TOKEN_SEMICOLON:
+					return (ParserNode){ ACTION_SHIFT, 378 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 246 };
+		case 369:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 379 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 370:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 380 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 371:
+			switch (label) {
+				case TOKEN_LSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 306 };
+				case TOKEN_ArrayTypeSuffix:
+					return (ParserNode){ ACTION_GOTO, 381 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_REDUCE, 211 };
+		case 372:
+			return (ParserNode){ ACTION_REDUCE, 210 };
+		case 373:
+			return (ParserNode){ ACTION_REDUCE, 225 };
+		case 374:
+			switch (label) {
+				case TOKEN_RSQUARE:
+					return (ParserNode){ ACTION_SHIFT, 382 };
+				default:
+					break;
+			}
+			return (ParserNode){ ACTION_ERROR, 0 };
+		case 375:
+			return (ParserNode){ ACTION_REDUCE, 140 };
+		case 376:
+			return (ParserNode){ ACTION_REDUCE, 63 };
+		case 377:
+			return (ParserNode){ ACTION_REDUCE, 243 };
+		case 378:
+			return (ParserNode){ ACTION_REDUCE, 247 };
+		case 379:
+			return (ParserNode){ ACTION_REDUCE, 181 };
+		case 380:
+			return (ParserNode){ ACTION_REDUCE, 182 };
+		case 381:
+			return (ParserNode){ ACTION_REDUCE, 212 };
+		case 382:
+			return (ParserNode){ ACTION_REDUCE, 226 };
+		default:
+			return (ParserNode){ ACTION_ERROR, 0 };
+	}
+}
@@ -0,0 +1,1512 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+#define NUM_STATES 383
+#define PARSER_TABLE_SIZE 5838
+
+static const unsigned short parserDefault[NUM_STATES] = {
+	16386, /* [0] */
+	40960, /* [1] */
+	16385, /* [2] */
+	16387, /* [3] */
+	16388, /* [4] */
+	16395, /* [5] */
+	16393, /* [6] */
+	16408, /* [7] */
+	16496, /* [8] */
+	40960, /* [9] */
+	16410, /* [10] */
+	16411, /* [11] */
+	16412, /* [12] */
+	16413, /* [13] */
+	16414, /* [14] */
+	16415, /* [15] */
+	16416, /* [16] */
+	16434, /* [17] */
+	16435, /* [18] */
+	16436, /* [19] */
+	16437, /* [20] */
+	16438, /* [21] */
+	16439, /* [22] */
+	16440, /* [23] */
+	16441, /* [24] */
+	16420, /* [25] */
+	16421, /* [26] */
+	40960, /* [27] */
+	40960, /* [28] */
+	16638, /* [29] */
+	16639, /* [30] */
+	40960, /* [31] */
+	16641, /* [32] */
+	40960, /* [33] */
+	40960, /* [34] */
+	16644, /* [35] */
+	16422, /* [36] */
+	16423, /* [37] */
+	16424, /* [38] */
+	40960, /* [39] */
+	16442, /* [40] */
+	16443, /* [41] */
+	40960, /* [42] */
+	40960, /* [43] */
+	16483, /* [44] */
+	16484, /* [45] */
+	16485, /* [46] */
+	16486, /* [47] */
+	16487, /* [48] */
+	16488, /* [49] */
+	16489, /* [50] */
+	40960, /* [51] */
+	16634, /* [52] */
+	16635, /* [53] */
+	40960, /* [54] */
+	16496, /* [55] */
+	16559, /* [56] */
+	40960, /* [57] */
+	16525, /* [58] */
+	16526, /* [59] */
+	16527, /* [60] */
+	16528, /* [61] */
+	16555, /* [62] */
+	16556, /* [63] */
+	16557, /* [64] */
+	16558, /* [65] */
+	16386, /* [66] */
+	16529, /* [67] */
+	16530, /* [68] */
+	16531, /* [69] */
+	16532, /* [70] */
+	16533, /* [71] */
+	16534, /* [72] */
+	16535, /* [73] */
+	16536, /* [74] */
+	16537, /* [75] */
+	16538, /* [76] */
+	16539, /* [77] */
+	16540, /* [78] */
+	16541, /* [79] */
+	16542, /* [80] */
+	16543, /* [81] */
+	16544, /* [82] */
+	16545, /* [83] */
+	16546, /* [84] */
+	16547, /* [85] */
+	16548, /* [86] */
+	16549, /* [87] */
+	16550, /* [88] */
+	16389, /* [89] */
+	16390, /* [90] */
+	16391, /* [91] */
+	16394, /* [92] */
+	16407, /* [93] */
+	16408, /* [94] */
+	16496, /* [95] */
+	16492, /* [96] */
+	40960, /* [97] */
+	16490, /* [98] */
+	40960, /* [99] */
+	16400, /* [100] */
+	40960, /* [101] */
+	16404, /* [102] */
+	16405, /* [103] */
+	16406, /* [104] */
+	16496, /* [105] */
+	16496, /* [106] */
+	16410, /* [107] */
+	16417, /* [108] */
+	16637, /* [109] */
+	16425, /* [110] */
+	16426, /* [111] */
+	40960, /* [112] */
+	16640, /* [113] */
+	16642, /* [114] */
+	16643, /* [115] */
+	40960, /* [116] */
+	16632, /* [117] */
+	16633, /* [118] */
+	40960, /* [119] */
+	16444, /* [120] */
+	16450, /* [121] */
+	16452, /* [122] */
+	16471, /* [123] */
+	40960, /* [124] */
+	16473, /* [125] */
+	16474, /* [126] */
+	40960, /* [127] */
+	16477, /* [128] */
+	16478, /* [129] */
+	16479, /* [130] */
+	16480, /* [131] */
+	16481, /* [132] */
+	16551, /* [133] */
+	16552, /* [134] */
+	40960, /* [135] */
+	40960, /* [136] */
+	40960, /* [137] */
+	40960, /* [138] */
+	40960, /* [139] */
+	40960, /* [140] */
+	40960, /* [141] */
+	40960, /* [142] */
+	40960, /* [143] */
+	16636, /* [144] */
+	16567, /* [145] */
+	40960, /* [146] */
+	40960, /* [147] */
+	40960, /* [148] */
+	16516, /* [149] */
+	40960, /* [150] */
+	40960, /* [151] */
+	16496, /* [152] */
+	16496, /* [153] */
+	16575, /* [154] */
+	16576, /* [155] */
+	40960, /* [156] */
+	40960, /* [157] */
+	16493, /* [158] */
+	16491, /* [159] */
+	16560, /* [160] */
+	40960, /* [161] */
+	16392, /* [162] */
+	16409, /* [163] */
+	16398, /* [164] */
+	16396, /* [165] */
+	40960, /* [166] */
+	16502, /* [167] */
+	16496, /* [168] */
+	40960, /* [169] */
+	16401, /* [170] */
+	40960, /* [171] */
+	16494, /* [172] */
+	40960, /* [173] */
+	16495, /* [174] */
+	40960, /* [175] */
+	40960, /* [176] */
+	40960, /* [177] */
+	16428, /* [178] */
+	40960, /* [179] */
+	40960, /* [180] */
+	40960, /* [181] */
+	16445, /* [182] */
+	40960, /* [183] */
+	40960, /* [184] */
+	40960, /* [185] */
+	40960, /* [186] */
+	40960, /* [187] */
+	40960, /* [188] */
+	40960, /* [189] */
+	40960, /* [190] */
+	40960, /* [191] */
+	40960, /* [192] */
+	40960, /* [193] */
+	40960, /* [194] */
+	40960, /* [195] */
+	40960, /* [196] */
+	40960, /* [197] */
+	40960, /* [198] */
+	40960, /* [199] */
+	40960, /* [200] */
+	40960, /* [201] */
+	16482, /* [202] */
+	16472, /* [203] */
+	16476, /* [204] */
+	16475, /* [205] */
+	16561, /* [206] */
+	16562, /* [207] */
+	40960, /* [208] */
+	16564, /* [209] */
+	16514, /* [210] */
+	16513, /* [211] */
+	16512, /* [212] */
+	16509, /* [213] */
+	16511, /* [214] */
+	16506, /* [215] */
+	40960, /* [216] */
+	40960, /* [217] */
+	16570, /* [218] */
+	16569, /* [219] */
+	16612, /* [220] */
+	16574, /* [221] */
+	16522, /* [222] */
+	16519, /* [223] */
+	16518, /* [224] */
+	16516, /* [225] */
+	16521, /* [226] */
+	16520, /* [227] */
+	16517, /* [228] */
+	16577, /* [229] */
+	16583, /* [230] */
+	16580, /* [231] */
+	16581, /* [232] */
+	16582, /* [233] */
+	16584, /* [234] */
+	40960, /* [235] */
+	16591, /* [236] */
+	16572, /* [237] */
+	16573, /* [238] */
+	40960, /* [239] */
+	16578, /* [240] */
+	16583, /* [241] */
+	16579, /* [242] */
+	40960, /* [243] */
+	40960, /* [244] */
+	40960, /* [245] */
+	40960, /* [246] */
+	16600, /* [247] */
+	16602, /* [248] */
+	16604, /* [249] */
+	16606, /* [250] */
+	16608, /* [251] */
+	40960, /* [252] */
+	16614, /* [253] */
+	16399, /* [254] */
+	16397, /* [255] */
+	40960, /* [256] */
+	16516, /* [257] */
+	16499, /* [258] */
+	40960, /* [259] */
+	16498, /* [260] */
+	16497, /* [261] */
+	40960, /* [262] */
+	16402, /* [263] */
+	16496, /* [264] */
+	16500, /* [265] */
+	16418, /* [266] */
+	16419, /* [267] */
+	16427, /* [268] */
+	16429, /* [269] */
+	16432, /* [270] */
+	40960, /* [271] */
+	16457, /* [272] */
+	16454, /* [273] */
+	16458, /* [274] */
+	16467, /* [275] */
+	16453, /* [276] */
+	16463, /* [277] */
+	16461, /* [278] */
+	16462, /* [279] */
+	16464, /* [280] */
+	16460, /* [281] */
+	16470, /* [282] */
+	16468, /* [283] */
+	16459, /* [284] */
+	16455, /* [285] */
+	16469, /* [286] */
+	16465, /* [287] */
+	16466, /* [288] */
+	16456, /* [289] */
+	16451, /* [290] */
+	16563, /* [291] */
+	16510, /* [292] */
+	16507, /* [293] */
+	16508, /* [294] */
+	40960, /* [295] */
+	40960, /* [296] */
+	16616, /* [297] */
+	16617, /* [298] */
+	16619, /* [299] */
+	16621, /* [300] */
+	16622, /* [301] */
+	16628, /* [302] */
+	16568, /* [303] */
+	40960, /* [304] */
+	16588, /* [305] */
+	40960, /* [306] */
+	40960, /* [307] */
+	40960, /* [308] */
+	16589, /* [309] */
+	16592, /* [310] */
+	16496, /* [311] */
+	16599, /* [312] */
+	40960, /* [313] */
+	16597, /* [314] */
+	16571, /* [315] */
+	16601, /* [316] */
+	40960, /* [317] */
+	40960, /* [318] */
+	40960, /* [319] */
+	40960, /* [320] */
+	40960, /* [321] */
+	16505, /* [322] */
+	16515, /* [323] */
+	16580, /* [324] */
+	16582, /* [325] */
+	16584, /* [326] */
+	16502, /* [327] */
+	16502, /* [328] */
+	40960, /* [329] */
+	16523, /* [330] */
+	16403, /* [331] */
+	16501, /* [332] */
+	16433, /* [333] */
+	16430, /* [334] */
+	40960, /* [335] */
+	40960, /* [336] */
+	16446, /* [337] */
+	16615, /* [338] */
+	16618, /* [339] */
+	16620, /* [340] */
+	16623, /* [341] */
+	16629, /* [342] */
+	40960, /* [343] */
+	16624, /* [344] */
+	40960, /* [345] */
+	40960, /* [346] */
+	16613, /* [347] */
+	40960, /* [348] */
+	16593, /* [349] */
+	16590, /* [350] */
+	40960, /* [351] */
+	16598, /* [352] */
+	16603, /* [353] */
+	16605, /* [354] */
+	16607, /* [355] */
+	40960, /* [356] */
+	40960, /* [357] */
+	16611, /* [358] */
+	16504, /* [359] */
+	16503, /* [360] */
+	40960, /* [361] */
+	16431, /* [362] */
+	16449, /* [363] */
+	16448, /* [364] */
+	40960, /* [365] */
+	16625, /* [366] */
+	16626, /* [367] */
+	16630, /* [368] */
+	40960, /* [369] */
+	40960, /* [370] */
+	16595, /* [371] */
+	16594, /* [372] */
+	16609, /* [373] */
+	40960, /* [374] */
+	16524, /* [375] */
+	16447, /* [376] */
+	16627, /* [377] */
+	16631, /* [378] */
+	16565, /* [379] */
+	16566, /* [380] */
+	16596, /* [381] */
+	16610, /* [382] */
+};
+
+static const unsigned short parserBase[NUM_STATES] = {
+	624, /* [0] */
+	524, /* [1] */
+	0, /* [2] */
+	0, /* [3] */
+	1092, /* [4] */
+	561, /* [5] */
+	0, /* [6] */
+	1404, /* [7] */
+	259, /* [8] */
+	542, /* [9] */
+	0, /* [10] */
+	0, /* [11] */
+	0, /* [12] */
+	0, /* [13] */
+	0, /* [14] */
+	0, /* [15] */
+	0, /* [16] */
+	0, /* [17] */
+	0, /* [18] */
+	0, /* [19] */
+	0, /* [20] */
+	0, /* [21] */
+	0, /* [22] */
+	0, /* [23] */
+	0, /* [24] */
+	0, /* [25] */
+	0, /* [26] */
+	1560, /* [27] */
+	2559, /* [28] */
+	0, /* [29] */
+	0, /* [30] */
+	2160, /* [31] */
+	0, /* [32] */
+	3200, /* [33] */
+	3075, /* [34] */
+	0, /* [35] */
+	0, /* [36] */
+	0, /* [37] */
+	0, /* [38] */
+	561, /* [39] */
+	0, /* [40] */
+	0, /* [41] */
+	2950, /* [42] */
+	2825, /* [43] */
+	0, /* [44] */
+	0, /* [45] */
+	0, /* [46] */
+	0, /* [47] */
+	0, /* [48] */
+	0, /* [49] */
+	0, /* [50] */
+	3378, /* [51] */
+	0, /* [52] */
+	0, /* [53] */
+	5489, /* [54] */
+	627, /* [55] */
+	0, /* [56] */
+	277, /* [57] */
+	0, /* [58] */
+	0, /* [59] */
+	0, /* [60] */
+	0, /* [61] */
+	0, /* [62] */
+	0, /* [63] */
+	0, /* [64] */
+	0, /* [65] */
+	936, /* [66] */
+	0, /* [67] */
+	0, /* [68] */
+	0, /* [69] */
+	0, /* [70] */
+	0, /* [71] */
+	0, /* [72] */
+	0, /* [73] */
+	0, /* [74] */
+	0, /* [75] */
+	0, /* [76] */
+	0, /* [77] */
+	0, /* [78] */
+	0, /* [79] */
+	0, /* [80] */
+	0, /* [81] */
+	0, /* [82] */
+	0, /* [83] */
+	0, /* [84] */
+	0, /* [85] */
+	0, /* [86] */
+	0, /* [87] */
+	0, /* [88] */
+	0, /* [89] */
+	0, /* [90] */
+	780, /* [91] */
+	0, /* [92] */
+	0, /* [93] */
+	1248, /* [94] */
+	618, /* [95] */
+	0, /* [96] */
+	2700, /* [97] */
+	0, /* [98] */
+	597, /* [99] */
+	554, /* [100] */
+	30, /* [101] */
+	0, /* [102] */
+	0, /* [103] */
+	0, /* [104] */
+	743, /* [105] */
+	654, /* [106] */
+	550, /* [107] */
+	0, /* [108] */
+	0, /* [109] */
+	0, /* [110] */
+	0, /* [111] */
+	5452, /* [112] */
+	0, /* [113] */
+	0, /* [114] */
+	0, /* [115] */
+	2434, /* [116] */
+	0, /* [117] */
+	0, /* [118] */
+	552, /* [119] */
+	0, /* [120] */
+	2987, /* [121] */
+	0, /* [122] */
+	462, /* [123] */
+	5302, /* [124] */
+	0, /* [125] */
+	0, /* [126] */
+	343, /* [127] */
+	0, /* [128] */
+	0, /* [129] */
+	0, /* [130] */
+	0, /* [131] */
+	0, /* [132] */
+	0, /* [133] */
+	0, /* [134] */
+	233, /* [135] */
+	110, /* [136] */
+	540, /* [137] */
+	539, /* [138] */
+	528, /* [139] */
+	526, /* [140] */
+	522, /* [141] */
+	502, /* [142] */
+	477, /* [143] */
+	474, /* [144] */
+	467, /* [145] */
+	1928, /* [146] */
+	1858, /* [147] */
+	187, /* [148] */
+	910, /* [149] */
+	475, /* [150] */
+	449, /* [151] */
+	379, /* [152] */
+	234, /* [153] */
+	1491, /* [154] */
+	1335, /* [155] */
+	5445, /* [156] */
+	78, /* [157] */
+	0, /* [158] */
+	0, /* [159] */
+	0, /* [160] */
+	435, /* [161] */
+	0, /* [162] */
+	0, /* [163] */
+	427, /* [164] */
+	426, /* [165] */
+	5416, /* [166] */
+	224, /* [167] */
+	30, /* [168] */
+	5262, /* [169] */
+	0, /* [170] */
+	426, /* [171] */
+	0, /* [172] */
+	91, /* [173] */
+	0, /* [174] */
+	1716, /* [175] */
+	424, /* [176] */
+	420, /* [177] */
+	0, /* [178] */
+	2308, /* [179] */
+	2012, /* [180] */
+	410, /* [181] */
+	0, /* [182] */
+	5145, /* [183] */
+	5105, /* [184] */
+	4988, /* [185] */
+	4948, /* [186] */
+	4831, /* [187] */
+	4791, /* [188] */
+	4674, /* [189] */
+	4634, /* [190] */
+	4517, /* [191] */
+	4477, /* [192] */
+	4360, /* [193] */
+	4320, /* [194] */
+	4203, /* [195] */
+	4163, /* [196] */
+	4046, /* [197] */
+	4006, /* [198] */
+	3889, /* [199] */
+	3849, /* [200] */
+	3535, /* [201] */
+	0, /* [202] */
+	0, /* [203] */
+	0, /* [204] */
+	0, /* [205] */
+	0, /* [206] */
+	0, /* [207] */
+	418, /* [208] */
+	0, /* [209] */
+	0, /* [210] */
+	0, /* [211] */
+	0, /* [212] */
+	392, /* [213] */
+	0, /* [214] */
+	157, /* [215] */
+	468, /* [216] */
+	5390, /* [217] */
+	0, /* [218] */
+	0, /* [219] */
+	407, /* [220] */
+	1179, /* [221] */
+	0, /* [222] */
+	0, /* [223] */
+	0, /* [224] */
+	311, /* [225] */
+	0, /* [226] */
+	0, /* [227] */
+	0, /* [228] */
+	0, /* [229] */
+	403, /* [230] */
+	395, /* [231] */
+	0, /* [232] */
+	0, /* [233] */
+	0, /* [234] */
+	3418, /* [235] */
+	151, /* [236] */
+	0, /* [237] */
+	0, /* [238] */
+	389, /* [239] */
+	0, /* [240] */
+	0, /* [241] */
+	0, /* [242] */
+	381, /* [243] */
+	7, /* [244] */
+	1407, /* [245] */
+	370, /* [246] */
+	0, /* [247] */
+	365, /* [248] */
+	332, /* [249] */
+	314, /* [250] */
+	317, /* [251] */
+	309, /* [252] */
+	0, /* [253] */
+	0, /* [254] */
+	0, /* [255] */
+	270, /* [256] */
+	754, /* [257] */
+	0, /* [258] */
+	595, /* [259] */
+	0, /* [260] */
+	0, /* [261] */
+	2202, /* [262] */
+	262, /* [263] */
+	499, /* [264] */
+	0, /* [265] */
+	0, /* [266] */
+	0, /* [267] */
+	0, /* [268] */
+	0, /* [269] */
+	259, /* [270] */
+	1864, /* [271] */
+	2357, /* [272] */
+	5595, /* [273] */
+	236, /* [274] */
+	0, /* [275] */
+	3112, /* [276] */
+	541, /* [277] */
+	392, /* [278] */
+	385, /* [279] */
+	532, /* [280] */
+	229, /* [281] */
+	271, /* [282] */
+	0, /* [283] */
+	80, /* [284] */
+	5628, /* [285] */
+	267, /* [286] */
+	426, /* [287] */
+	0, /* [288] */
+	5647, /* [289] */
+	0, /* [290] */
+	0, /* [291] */
+	0, /* [292] */
+	0, /* [293] */
+	0, /* [294] */
+	3261, /* [295] */
+	254, /* [296] */
+	0, /* [297] */
+	312, /* [298] */
+	156, /* [299] */
+	0, /* [300] */
+	0, /* [301] */
+	278, /* [302] */
+	0, /* [303] */
+	1251, /* [304] */
+	0, /* [305] */
+	3732, /* [306] */
+	3692, /* [307] */
+	2867, /* [308] */
+	10, /* [309] */
+	0, /* [310] */
+	78, /* [311] */
+	0, /* [312] */
+	247, /* [313] */
+	0, /* [314] */
+	0, /* [315] */
+	0, /* [316] */
+	435, /* [317] */
+	390, /* [318] */
+	234, /* [319] */
+	1853, /* [320] */
+	3, /* [321] */
+	0, /* [322] */
+	0, /* [323] */
+	72, /* [324] */
+	227, /* [325] */
+	216, /* [326] */
+	73, /* [327] */
+	22, /* [328] */
+	3575, /* [329] */
+	0, /* [330] */
+	0, /* [331] */
+	0, /* [332] */
+	0, /* [333] */
+	124, /* [334] */
+	126, /* [335] */
+	120, /* [336] */
+	108, /* [337] */
+	0, /* [338] */
+	0, /* [339] */
+	0, /* [340] */
+	0, /* [341] */
+	100, /* [342] */
+	77, /* [343] */
+	0, /* [344] */
+	57, /* [345] */
+	5682, /* [346] */
+	0, /* [347] */
+	2742, /* [348] */
+	90, /* [349] */
+	0, /* [350] */
+	100, /* [351] */
+	0, /* [352] */
+	0, /* [353] */
+	0, /* [354] */
+	0, /* [355] */
+	91, /* [356] */
+	1095, /* [357] */
+	0, /* [358] */
+	0, /* [359] */
+	0, /* [360] */
+	2601, /* [361] */
+	0, /* [362] */
+	0, /* [363] */
+	0, /* [364] */
+	49, /* [365] */
+	0, /* [366] */
+	62, /* [367] */
+	53, /* [368] */
+	54, /* [369] */
+	51, /* [370] */
+	36, /* [371] */
+	0, /* [372] */
+	0, /* [373] */
+	0, /* [374] */
+	0, /* [375] */
+	0, /* [376] */
+	0, /* [377] */
+	0, /* [378] */
+	0, /* [379] */
+	0, /* [380] */
+	0, /* [381] */
+	0, /* [382] */
+};
+
+static const unsigned short parserCheck[PARSER_TABLE_SIZE] = {
+	301, 301, 301, 321, 301, 374, 301, 321, 301, 321, 301, 301, 244, 301, 309, 301,
+	301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 101, 328,
+	301, 301, 301, 301, 301, 301, 301, 168, 371, 301, 301, 301, 301, 301, 301, 301,
+	301, 301, 301, 301, 301, 301, 301, 365, 370, 321, 244, 369, 301, 301, 301, 345,
+	301, 368, 301, 301, 301, 301, 301, 301, 301, 301, 367, 301, 324, 324, 157, 301,
+	301, 301, 327, 343, 101, 157, 157, 311, 301, 301, 301, 173, 321, 101, 349, 173,
+	356, 301, 284, 284, 284, 284, 284, 284, 284, 351, 301, 301, 301, 301, 301, 173,
+	342, 301, 301, 136, 301, 328, 337, 101, 101, 101, 168, 168, 284, 284, 321, 336,
+	244, 284, 284, 365, 365, 335, 321, 321, 334, 309, 301, 301, 301, 301, 301, 301,
+	301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 301, 299, 299, 299, 215,
+	299, 136, 299, 215, 299, 371, 299, 299, 327, 299, 311, 299, 299, 299, 299, 299,
+	299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 236, 148, 299, 299, 299, 299,
+	299, 299, 299, 345, 173, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299,
+	299, 299, 299, 157, 157, 157, 157, 343, 299, 299, 299, 349, 299, 326, 299, 299,
+	299, 299, 299, 299, 299, 299, 136, 299, 325, 167, 319, 299, 299, 299, 215, 135,
+	215, 148, 319, 153, 299, 299, 299, 281, 281, 281, 281, 281, 313, 299, 274, 274,
+	274, 274, 274, 274, 274, 296, 299, 299, 299, 299, 299, 8, 8, 299, 299, 270,
+	299, 281, 263, 256, 148, 148, 281, 236, 274, 274, 302, 57, 302, 274, 274, 286,
+	286, 286, 302, 282, 282, 282, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299,
+	299, 299, 299, 299, 299, 299, 299, 299, 298, 298, 298, 225, 298, 252, 298, 167,
+	298, 251, 298, 298, 250, 298, 153, 298, 298, 298, 298, 298, 298, 298, 298, 298,
+	298, 298, 298, 298, 298, 298, 249, 127, 298, 298, 298, 298, 298, 298, 298, 8,
+	8, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 319,
+	319, 319, 319, 135, 298, 298, 298, 248, 298, 246, 298, 298, 298, 298, 298, 298,
+	298, 298, 243, 298, 152, 239, 318, 298, 298, 298, 213, 302, 302, 127, 318, 231,
+	298, 298, 298, 279, 279, 279, 279, 279, 230, 298, 278, 278, 278, 278, 278, 57,
+	302, 220, 298, 298, 298, 298, 298, 208, 181, 298, 298, 177, 298, 279, 176, 171,
+	127, 127, 279, 317, 278, 225, 165, 164, 225, 278, 161, 317, 287, 287, 287, 287,
+	287, 151, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298,
+	298, 298, 298, 298, 216, 216, 216, 152, 216, 213, 216, 150, 216, 145, 216, 216,
+	144, 216, 143, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 123, 123, 216, 216, 216, 216, 216, 216, 216, 142, 264, 216, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 318, 318, 318, 318, 141,
+	216, 216, 216, 140, 216, 139, 216, 216, 216, 216, 216, 216, 216, 216, 9, 216,
+	138, 137, 9, 216, 216, 216, 280, 280, 280, 280, 280, 119, 216, 216, 216, 277,
+	277, 277, 277, 277, 107, 216, 100, 39, 317, 317, 317, 317, 123, 5, 216, 216,
+	216, 216, 216, 1, 65535, 216, 216, 65535, 216, 277, 65535, 65535, 65535, 65535, 277, 264,
+	264, 264, 65535, 259, 9, 99, 65535, 259, 65535, 99, 65535, 65535, 65535, 9, 216, 216,
+	216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	0, 0, 0, 95, 0, 65535, 0, 9, 9, 9, 0, 0, 55, 0, 65535, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 65535,
+	0, 0, 0, 0, 0, 0, 0, 106, 65535, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 65535, 65535, 0, 0, 65535, 0, 0, 0, 65535,
+	0, 65535, 0, 0, 0, 0, 0, 0, 0, 0, 65535, 0, 259, 65535, 99, 0,
+	0, 0, 65535, 65535, 65535, 65535, 95, 95, 0, 0, 0, 65535, 65535, 65535, 65535, 55,
+	55, 0, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 0, 0, 0, 0, 65535,
+	65535, 0, 0, 65535, 0, 65535, 65535, 65535, 65535, 65535, 106, 106, 106, 65535, 65535, 65535,
+	105, 65535, 257, 65535, 65535, 65535, 257, 65535, 65535, 65535, 0, 0, 65535, 257, 65535, 65535,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 91, 91, 65535,
+	91, 65535, 91, 65535, 65535, 257, 91, 91, 65535, 91, 65535, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 65535, 65535, 91, 91, 91, 91,
+	91, 91, 91, 65535, 65535, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 105, 105, 105, 65535, 91, 91, 91, 91, 65535, 91, 65535, 91, 91,
+	91, 91, 91, 91, 91, 91, 65535, 91, 65535, 65535, 65535, 91, 91, 91, 65535, 65535,
+	65535, 65535, 65535, 65535, 91, 91, 91, 65535, 65535, 65535, 65535, 65535, 65535, 91, 257, 257,
+	257, 257, 257, 257, 257, 65535, 91, 91, 91, 91, 91, 65535, 65535, 91, 91, 65535,
+	91, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 149, 65535,
+	65535, 65535, 149, 65535, 65535, 65535, 91, 91, 65535, 149, 65535, 65535, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 66, 66, 66, 65535, 66, 65535, 66, 65535,
+	65535, 149, 66, 66, 65535, 66, 65535, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+	66, 66, 66, 66, 66, 66, 65535, 65535, 66, 66, 66, 66, 66, 66, 66, 65535,
+	65535, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 65535,
+	65535, 65535, 66, 65535, 66, 66, 66, 65535, 66, 65535, 66, 66, 66, 66, 66, 66,
+	66, 66, 65535, 66, 65535, 65535, 65535, 66, 66, 66, 65535, 65535, 65535, 65535, 65535, 65535,
+	66, 66, 66, 65535, 65535, 65535, 65535, 65535, 65535, 66, 149, 65535, 149, 149, 149, 149,
+	149, 65535, 66, 66, 66, 66, 66, 65535, 65535, 66, 66, 65535, 66, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 66, 66, 65535, 65535, 65535, 65535, 66, 66, 66, 66, 66, 66, 66, 66,
+	66, 66, 66, 66, 4, 4, 4, 357, 4, 65535, 4, 357, 65535, 357, 4, 4,
+	65535, 4, 65535, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 65535, 65535, 4, 4, 4, 4, 4, 4, 4, 65535, 65535, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 65535, 65535, 357, 65535, 4,
+	4, 4, 4, 65535, 4, 65535, 4, 4, 4, 4, 4, 4, 4, 4, 65535, 4,
+	65535, 65535, 65535, 4, 4, 4, 65535, 65535, 65535, 65535, 65535, 65535, 4, 4, 4, 221,
+	357, 65535, 65535, 65535, 65535, 4, 221, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4, 4,
+	4, 4, 4, 65535, 65535, 4, 4, 65535, 4, 65535, 65535, 65535, 65535, 65535, 221, 65535,
+	65535, 65535, 357, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 357, 357, 65535, 65535, 4, 4,
+	357, 65535, 65535, 65535, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	94, 94, 94, 304, 94, 65535, 94, 304, 65535, 304, 94, 94, 65535, 94, 65535, 94,
+	94, 65535, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 65535, 65535,
+	94, 94, 94, 94, 94, 94, 94, 65535, 65535, 94, 94, 94, 94, 94, 94, 94,
+	94, 94, 94, 94, 94, 94, 94, 221, 65535, 304, 221, 221, 221, 221, 65535, 65535,
+	65535, 94, 94, 94, 94, 94, 94, 94, 94, 94, 65535, 94, 65535, 65535, 65535, 94,
+	94, 94, 65535, 65535, 65535, 65535, 65535, 65535, 94, 94, 94, 155, 304, 65535, 65535, 65535,
+	65535, 94, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 94, 94, 94, 94, 94, 65535,
+	65535, 94, 94, 65535, 94, 65535, 65535, 65535, 65535, 65535, 155, 65535, 65535, 65535, 304, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 304, 304, 65535, 65535, 94, 94, 304, 65535, 65535, 65535,
+	94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 7, 7, 7, 245,
+	7, 65535, 7, 245, 65535, 245, 7, 7, 65535, 7, 65535, 7, 7, 65535, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 65535, 65535, 7, 7, 7, 7,
+	7, 7, 7, 65535, 65535, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 155, 65535, 245, 155, 155, 155, 155, 65535, 65535, 65535, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 65535, 7, 65535, 65535, 65535, 7, 7, 7, 65535, 65535,
+	65535, 65535, 65535, 65535, 7, 7, 7, 154, 245, 65535, 65535, 65535, 65535, 7, 154, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 7, 7, 7, 7, 7, 65535, 65535, 7, 7, 65535,
+	7, 65535, 65535, 65535, 65535, 65535, 154, 65535, 65535, 65535, 245, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 245, 245, 65535, 65535, 7, 7, 245, 65535, 65535, 65535, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 27, 27, 27, 65535, 27, 65535, 27, 65535,
+	65535, 65535, 27, 27, 65535, 27, 65535, 27, 27, 65535, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 65535, 65535, 27, 27, 27, 27, 27, 27, 27, 65535,
+	65535, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 154,
+	65535, 65535, 154, 154, 154, 154, 65535, 65535, 65535, 65535, 27, 27, 27, 27, 27, 27,
+	27, 27, 65535, 27, 65535, 65535, 65535, 27, 27, 27, 65535, 65535, 65535, 65535, 65535, 65535,
+	27, 27, 27, 65535, 65535, 65535, 65535, 65535, 65535, 27, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 27, 27, 27, 27, 27, 65535, 65535, 27, 27, 65535, 27, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 27, 27, 65535, 65535, 65535, 65535, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 175, 175, 175, 65535, 175, 65535, 175, 65535, 65535, 65535, 65535, 175,
+	65535, 175, 65535, 175, 175, 65535, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+	175, 175, 65535, 65535, 175, 175, 175, 175, 175, 175, 65535, 65535, 65535, 175, 175, 65535,
+	175, 175, 65535, 65535, 65535, 175, 175, 65535, 175, 65535, 175, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 175, 175, 175, 175, 175, 175, 175, 65535, 175,
+	65535, 65535, 65535, 65535, 175, 175, 65535, 65535, 65535, 65535, 65535, 65535, 175, 175, 175, 65535,
+	65535, 65535, 65535, 65535, 65535, 175, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 175, 175,
+	175, 175, 175, 65535, 65535, 175, 175, 65535, 175, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 320, 175, 175,
+	65535, 320, 147, 320, 175, 175, 175, 175, 271, 271, 271, 65535, 271, 147, 271, 65535,
+	65535, 65535, 65535, 271, 65535, 65535, 65535, 271, 271, 65535, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 65535, 65535, 271, 271, 271, 271, 271, 271, 65535, 65535,
+	320, 271, 271, 320, 271, 271, 65535, 65535, 147, 271, 271, 65535, 271, 65535, 271, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 146, 65535, 65535, 65535, 146, 65535, 146, 65535,
+	271, 271, 65535, 271, 65535, 146, 320, 65535, 271, 271, 65535, 147, 65535, 65535, 65535, 65535,
+	271, 271, 271, 65535, 65535, 147, 147, 65535, 65535, 271, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 271, 271, 271, 271, 271, 65535, 320, 271, 271, 65535, 271, 65535, 146, 65535,
+	320, 320, 65535, 65535, 65535, 65535, 320, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 271, 271, 147, 65535, 65535, 65535, 271, 271, 271, 271, 180, 180, 180, 65535,
+	180, 146, 180, 65535, 65535, 65535, 65535, 180, 65535, 65535, 65535, 180, 180, 65535, 180, 180,
+	180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 65535, 65535, 180, 180, 180, 180,
+	180, 180, 65535, 146, 65535, 180, 180, 65535, 180, 180, 65535, 146, 146, 180, 180, 65535,
+	180, 146, 180, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 180, 180, 65535, 180, 65535, 65535, 65535, 65535, 180, 180, 65535, 65535,
+	65535, 65535, 65535, 65535, 180, 180, 180, 65535, 65535, 65535, 65535, 65535, 65535, 180, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 180, 180, 180, 180, 180, 65535, 65535, 180, 180, 65535,
+	180, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 180, 180, 65535, 65535, 65535, 65535, 180, 180, 180, 180,
+	31, 31, 31, 65535, 31, 65535, 31, 65535, 65535, 65535, 65535, 31, 65535, 65535, 65535, 31,
+	31, 65535, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 65535, 65535,
+	31, 31, 31, 31, 31, 31, 65535, 65535, 65535, 31, 31, 65535, 31, 31, 65535, 262,
+	65535, 31, 31, 65535, 65535, 65535, 31, 65535, 262, 65535, 65535, 65535, 262, 262, 262, 262,
+	262, 262, 262, 65535, 65535, 262, 262, 262, 65535, 31, 65535, 262, 262, 65535, 65535, 65535,
+	31, 31, 65535, 262, 262, 65535, 262, 262, 31, 31, 31, 262, 262, 65535, 65535, 65535,
+	65535, 31, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31, 31, 31, 31, 31, 65535,
+	65535, 31, 31, 65535, 31, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31, 31, 65535, 65535, 65535, 65535,
+	31, 31, 31, 31, 179, 179, 179, 65535, 179, 65535, 179, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 179, 179, 179, 65535, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 65535, 65535, 179, 179, 179, 65535, 179, 179, 65535, 65535, 65535, 179, 179, 65535,
+	179, 179, 65535, 65535, 65535, 179, 179, 65535, 65535, 65535, 179, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 272, 272, 272, 272, 272, 272, 272, 65535, 65535,
+	179, 179, 179, 65535, 179, 179, 272, 272, 65535, 65535, 65535, 65535, 179, 179, 179, 65535,
+	65535, 272, 272, 65535, 65535, 179, 272, 272, 65535, 65535, 65535, 65535, 65535, 65535, 179, 179,
+	179, 179, 179, 65535, 65535, 179, 179, 65535, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 116, 116, 116, 65535, 116, 65535, 116, 65535, 65535, 65535, 65535, 65535, 179, 179,
+	116, 116, 116, 65535, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+	65535, 65535, 116, 116, 116, 65535, 116, 116, 65535, 65535, 65535, 116, 116, 65535, 116, 116,
+	65535, 65535, 65535, 116, 116, 65535, 65535, 65535, 116, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 116, 116,
+	116, 65535, 116, 116, 65535, 65535, 65535, 65535, 65535, 65535, 116, 116, 116, 65535, 65535, 65535,
+	65535, 65535, 65535, 116, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 116, 116, 116, 116,
+	116, 65535, 65535, 116, 116, 65535, 116, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28,
+	28, 28, 65535, 28, 65535, 28, 65535, 65535, 65535, 65535, 28, 65535, 116, 116, 28, 28,
+	65535, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 65535, 65535, 28,
+	28, 28, 65535, 28, 28, 65535, 65535, 65535, 28, 28, 65535, 28, 28, 65535, 361, 65535,
+	28, 28, 65535, 65535, 65535, 28, 65535, 65535, 65535, 65535, 65535, 361, 361, 361, 361, 361,
+	361, 361, 65535, 65535, 361, 361, 361, 65535, 65535, 28, 361, 361, 65535, 65535, 65535, 28,
+	28, 65535, 361, 361, 65535, 361, 361, 28, 28, 28, 361, 361, 65535, 65535, 65535, 65535,
+	28, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28, 28, 28, 28, 28, 65535, 65535,
+	28, 28, 65535, 28, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 28, 28, 65535, 97, 97, 97, 28,
+	97, 28, 97, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 97, 97, 65535, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 65535, 65535, 97, 97, 97, 65535,
+	97, 97, 65535, 65535, 65535, 97, 97, 65535, 97, 97, 65535, 348, 65535, 97, 97, 65535,
+	65535, 65535, 97, 65535, 65535, 65535, 65535, 65535, 348, 348, 348, 348, 348, 348, 348, 65535,
+	65535, 348, 348, 348, 65535, 65535, 65535, 348, 348, 65535, 65535, 65535, 97, 97, 65535, 348,
+	348, 65535, 348, 348, 97, 97, 97, 348, 348, 65535, 65535, 65535, 97, 97, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 97, 97, 97, 97, 97, 65535, 65535, 97, 97, 65535,
+	97, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 43, 43, 65535, 65535, 43, 65535, 43,
+	65535, 65535, 65535, 65535, 65535, 65535, 97, 97, 43, 43, 65535, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 65535, 65535, 43, 43, 43, 65535, 43, 43, 65535,
+	65535, 65535, 43, 43, 65535, 43, 43, 65535, 308, 65535, 43, 43, 65535, 65535, 65535, 43,
+	65535, 65535, 65535, 65535, 65535, 308, 308, 308, 308, 308, 308, 308, 65535, 65535, 308, 308,
+	308, 65535, 65535, 65535, 308, 308, 65535, 65535, 65535, 65535, 65535, 65535, 308, 308, 65535, 308,
+	308, 43, 43, 43, 308, 308, 65535, 65535, 65535, 65535, 43, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 43, 43, 43, 43, 43, 65535, 65535, 43, 43, 65535, 43, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 42, 42, 65535, 65535, 42, 65535, 42, 65535, 65535, 65535,
+	65535, 65535, 65535, 43, 43, 42, 42, 65535, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 65535, 65535, 42, 42, 42, 65535, 42, 42, 65535, 65535, 65535, 42,
+	42, 65535, 42, 42, 65535, 121, 65535, 42, 42, 65535, 65535, 65535, 42, 121, 121, 121,
+	121, 121, 121, 121, 65535, 65535, 121, 121, 121, 65535, 65535, 65535, 121, 121, 65535, 65535,
+	65535, 65535, 65535, 65535, 121, 121, 65535, 121, 121, 65535, 65535, 65535, 121, 121, 42, 42,
+	42, 65535, 65535, 65535, 65535, 65535, 65535, 42, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	42, 42, 42, 42, 42, 65535, 65535, 42, 42, 65535, 42, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 34, 34, 65535, 65535, 34, 65535, 34, 65535, 65535, 65535, 65535, 65535, 65535,
+	42, 42, 34, 34, 65535, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+	34, 65535, 65535, 34, 34, 34, 65535, 34, 34, 65535, 65535, 65535, 34, 34, 65535, 34,
+	34, 65535, 65535, 65535, 34, 34, 65535, 65535, 65535, 34, 276, 276, 276, 276, 276, 276,
+	276, 65535, 65535, 276, 276, 276, 65535, 65535, 65535, 276, 276, 65535, 65535, 65535, 65535, 65535,
+	65535, 276, 65535, 65535, 276, 276, 65535, 65535, 65535, 276, 276, 34, 34, 34, 65535, 65535,
+	65535, 65535, 65535, 65535, 34, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 34, 34, 34,
+	34, 34, 65535, 65535, 34, 34, 65535, 34, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	33, 33, 65535, 65535, 33, 65535, 33, 65535, 65535, 65535, 65535, 65535, 65535, 34, 34, 33,
+	33, 65535, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 65535, 65535,
+	33, 33, 33, 65535, 33, 33, 65535, 65535, 65535, 33, 33, 65535, 33, 33, 65535, 65535,
+	65535, 33, 33, 65535, 65535, 65535, 33, 65535, 65535, 65535, 65535, 65535, 65535, 295, 295, 295,
+	65535, 295, 65535, 295, 65535, 65535, 65535, 65535, 295, 65535, 65535, 65535, 295, 295, 65535, 295,
+	295, 65535, 65535, 65535, 65535, 65535, 295, 295, 33, 33, 33, 65535, 65535, 295, 65535, 65535,
+	65535, 33, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33, 33, 33, 33, 33, 65535,
+	65535, 33, 33, 295, 33, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 33, 33, 65535, 65535, 295, 295,
+	295, 295, 295, 295, 295, 65535, 295, 295, 65535, 65535, 65535, 65535, 65535, 65535, 295, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 295, 65535, 295, 65535, 295, 65535, 295, 65535,
+	295, 295, 51, 51, 51, 51, 51, 65535, 65535, 65535, 65535, 65535, 65535, 51, 65535, 65535,
+	65535, 51, 51, 65535, 51, 51, 65535, 65535, 295, 65535, 65535, 51, 51, 65535, 65535, 295,
+	65535, 65535, 51, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 235, 235, 235, 65535, 235, 235,
+	65535, 65535, 65535, 65535, 65535, 235, 65535, 65535, 51, 235, 235, 65535, 235, 235, 65535, 65535,
+	65535, 65535, 65535, 235, 235, 65535, 65535, 65535, 65535, 65535, 235, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 51, 65535, 65535, 51, 51, 51, 51, 65535, 51, 51, 65535, 65535, 65535,
+	235, 65535, 65535, 51, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 51, 65535, 51,
+	65535, 51, 65535, 51, 65535, 51, 51, 65535, 65535, 65535, 65535, 235, 65535, 65535, 65535, 235,
+	235, 235, 65535, 235, 235, 65535, 65535, 65535, 65535, 65535, 65535, 235, 65535, 51, 65535, 65535,
+	65535, 65535, 65535, 65535, 51, 235, 65535, 235, 65535, 235, 65535, 235, 65535, 235, 235, 201,
+	201, 201, 65535, 201, 65535, 65535, 65535, 65535, 65535, 65535, 201, 65535, 65535, 65535, 201, 201,
+	65535, 201, 201, 65535, 65535, 235, 65535, 65535, 201, 201, 65535, 65535, 235, 65535, 65535, 201,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 329, 329, 329, 65535, 329, 65535, 65535, 65535, 65535,
+	65535, 65535, 329, 65535, 65535, 201, 329, 329, 65535, 329, 329, 65535, 65535, 65535, 65535, 65535,
+	329, 329, 65535, 65535, 65535, 65535, 65535, 329, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	201, 65535, 65535, 201, 201, 201, 201, 65535, 201, 201, 65535, 65535, 65535, 329, 65535, 65535,
+	201, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 201, 65535, 201, 65535, 201, 65535,
+	201, 65535, 201, 201, 65535, 65535, 65535, 65535, 329, 65535, 65535, 65535, 329, 329, 329, 65535,
+	329, 329, 65535, 65535, 65535, 65535, 65535, 65535, 329, 65535, 201, 65535, 65535, 65535, 65535, 65535,
+	65535, 201, 329, 65535, 329, 65535, 329, 65535, 329, 65535, 329, 329, 307, 307, 307, 65535,
+	307, 65535, 65535, 65535, 65535, 65535, 65535, 307, 65535, 65535, 65535, 307, 307, 65535, 307, 307,
+	65535, 65535, 329, 65535, 65535, 307, 307, 65535, 65535, 329, 65535, 65535, 307, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 306, 306, 306, 65535, 306, 65535, 65535, 65535, 65535, 65535, 65535, 306,
+	65535, 65535, 307, 306, 306, 65535, 306, 306, 65535, 65535, 65535, 65535, 65535, 306, 306, 65535,
+	65535, 65535, 65535, 65535, 306, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 307, 65535, 65535,
+	65535, 307, 307, 307, 65535, 307, 307, 65535, 65535, 65535, 306, 65535, 65535, 307, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 307, 65535, 307, 65535, 307, 65535, 307, 65535, 307,
+	307, 65535, 65535, 65535, 65535, 306, 65535, 65535, 65535, 306, 306, 306, 65535, 306, 306, 65535,
+	65535, 65535, 65535, 65535, 65535, 306, 65535, 307, 65535, 65535, 65535, 65535, 65535, 65535, 307, 306,
+	65535, 306, 65535, 306, 65535, 306, 65535, 306, 306, 200, 200, 200, 65535, 200, 65535, 65535,
+	65535, 65535, 65535, 65535, 200, 65535, 65535, 65535, 200, 200, 65535, 200, 200, 65535, 65535, 306,
+	65535, 65535, 200, 200, 65535, 65535, 306, 65535, 65535, 200, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 199, 199, 199, 65535, 199, 65535, 65535, 65535, 65535, 65535, 65535, 199, 65535, 65535, 200,
+	199, 199, 65535, 199, 199, 65535, 65535, 65535, 65535, 65535, 199, 199, 65535, 65535, 65535, 65535,
+	65535, 199, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 200, 65535, 65535, 65535, 200, 200,
+	200, 65535, 200, 200, 65535, 65535, 65535, 199, 65535, 65535, 200, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 200, 65535, 200, 65535, 200, 65535, 200, 65535, 200, 200, 65535, 65535,
+	65535, 65535, 199, 65535, 65535, 65535, 199, 199, 199, 65535, 199, 199, 65535, 65535, 65535, 65535,
+	65535, 65535, 199, 65535, 200, 65535, 65535, 65535, 65535, 65535, 65535, 200, 199, 65535, 199, 65535,
+	199, 65535, 199, 65535, 199, 199, 198, 198, 198, 65535, 198, 65535, 65535, 65535, 65535, 65535,
+	65535, 198, 65535, 65535, 65535, 198, 198, 65535, 198, 198, 65535, 65535, 199, 65535, 65535, 198,
+	198, 65535, 65535, 199, 65535, 65535, 198, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 197, 197,
+	197, 65535, 197, 65535, 65535, 65535, 65535, 65535, 65535, 197, 65535, 65535, 198, 197, 197, 65535,
+	197, 197, 65535, 65535, 65535, 65535, 65535, 197, 197, 65535, 65535, 65535, 65535, 65535, 197, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 198, 65535, 65535, 65535, 198, 198, 198, 65535, 198,
+	198, 65535, 65535, 65535, 197, 65535, 65535, 198, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 198, 65535, 198, 65535, 198, 65535, 198, 65535, 198, 198, 65535, 65535, 65535, 65535, 197,
+	65535, 65535, 65535, 197, 197, 197, 65535, 197, 197, 65535, 65535, 65535, 65535, 65535, 65535, 197,
+	65535, 198, 65535, 65535, 65535, 65535, 65535, 65535, 198, 197, 65535, 197, 65535, 197, 65535, 197,
+	65535, 197, 197, 196, 196, 196, 65535, 196, 65535, 65535, 65535, 65535, 65535, 65535, 196, 65535,
+	65535, 65535, 196, 196, 65535, 196, 196, 65535, 65535, 197, 65535, 65535, 196, 196, 65535, 65535,
+	197, 65535, 65535, 196, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 195, 195, 195, 65535, 195,
+	65535, 65535, 65535, 65535, 65535, 65535, 195, 65535, 65535, 196, 195, 195, 65535, 195, 195, 65535,
+	65535, 65535, 65535, 65535, 195, 195, 65535, 65535, 65535, 65535, 65535, 195, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 196, 65535, 65535, 65535, 196, 196, 196, 65535, 196, 196, 65535, 65535,
+	65535, 195, 65535, 65535, 196, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 196, 65535,
+	196, 65535, 196, 65535, 196, 65535, 196, 196, 65535, 65535, 65535, 65535, 195, 65535, 65535, 65535,
+	195, 195, 195, 65535, 195, 195, 65535, 65535, 65535, 65535, 65535, 65535, 195, 65535, 196, 65535,
+	65535, 65535, 65535, 65535, 65535, 196, 195, 65535, 195, 65535, 195, 65535, 195, 65535, 195, 195,
+	194, 194, 194, 65535, 194, 65535, 65535, 65535, 65535, 65535, 65535, 194, 65535, 65535, 65535, 194,
+	194, 65535, 194, 194, 65535, 65535, 195, 65535, 65535, 194, 194, 65535, 65535, 195, 65535, 65535,
+	194, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 193, 193, 193, 65535, 193, 65535, 65535, 65535,
+	65535, 65535, 65535, 193, 65535, 65535, 194, 193, 193, 65535, 193, 193, 65535, 65535, 65535, 65535,
+	65535, 193, 193, 65535, 65535, 65535, 65535, 65535, 193, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 194, 65535, 65535, 65535, 194, 194, 194, 65535, 194, 194, 65535, 65535, 65535, 193, 65535,
+	65535, 194, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 194, 65535, 194, 65535, 194,
+	65535, 194, 65535, 194, 194, 65535, 65535, 65535, 65535, 193, 65535, 65535, 65535, 193, 193, 193,
+	65535, 193, 193, 65535, 65535, 65535, 65535, 65535, 65535, 193, 65535, 194, 65535, 65535, 65535, 65535,
+	65535, 65535, 194, 193, 65535, 193, 65535, 193, 65535, 193, 65535, 193, 193, 192, 192, 192,
+	65535, 192, 65535, 65535, 65535, 65535, 65535, 65535, 192, 65535, 65535, 65535, 192, 192, 65535, 192,
+	192, 65535, 65535, 193, 65535, 65535, 192, 192, 65535, 65535, 193, 65535, 65535, 192, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 191, 191, 191, 65535, 191, 65535, 65535, 65535, 65535, 65535, 65535,
+	191, 65535, 65535, 192, 191, 191, 65535, 191, 191, 65535, 65535, 65535, 65535, 65535, 191, 191,
+	65535, 65535, 65535, 65535, 65535, 191, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 192, 65535,
+	65535, 65535, 192, 192, 192, 65535, 192, 192, 65535, 65535, 65535, 191, 65535, 65535, 192, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 192, 65535, 192, 65535, 192, 65535, 192, 65535,
+	192, 192, 65535, 65535, 65535, 65535, 191, 65535, 65535, 65535, 191, 191, 191, 65535, 191, 191,
+	65535, 65535, 65535, 65535, 65535, 65535, 191, 65535, 192, 65535, 65535, 65535, 65535, 65535, 65535, 192,
+	191, 65535, 191, 65535, 191, 65535, 191, 65535, 191, 191, 190, 190, 190, 65535, 190, 65535,
+	65535, 65535, 65535, 65535, 65535, 190, 65535, 65535, 65535, 190, 190, 65535, 190, 190, 65535, 65535,
+	191, 65535, 65535, 190, 190, 65535, 65535, 191, 65535, 65535, 190, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 189, 189, 189, 65535, 189, 65535, 65535, 65535, 65535, 65535, 65535, 189, 65535, 65535,
+	190, 189, 189, 65535, 189, 189, 65535, 65535, 65535, 65535, 65535, 189, 189, 65535, 65535, 65535,
+	65535, 65535, 189, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 190, 65535, 65535, 65535, 190,
+	190, 190, 65535, 190, 190, 65535, 65535, 65535, 189, 65535, 65535, 190, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 190, 65535, 190, 65535, 190, 65535, 190, 65535, 190, 190, 65535,
+	65535, 65535, 65535, 189, 65535, 65535, 65535, 189, 189, 189, 65535, 189, 189, 65535, 65535, 65535,
+	65535, 65535, 65535, 189, 65535, 190, 65535, 65535, 65535, 65535, 65535, 65535, 190, 189, 65535, 189,
+	65535, 189, 65535, 189, 65535, 189, 189, 188, 188, 188, 65535, 188, 65535, 65535, 65535, 65535,
+	65535, 65535, 188, 65535, 65535, 65535, 188, 188, 65535, 188, 188, 65535, 65535, 189, 65535, 65535,
+	188, 188, 65535, 65535, 189, 65535, 65535, 188, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 187,
+	187, 187, 65535, 187, 65535, 65535, 65535, 65535, 65535, 65535, 187, 65535, 65535, 188, 187, 187,
+	65535, 187, 187, 65535, 65535, 65535, 65535, 65535, 187, 187, 65535, 65535, 65535, 65535, 65535, 187,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 188, 65535, 65535, 65535, 188, 188, 188, 65535,
+	188, 188, 65535, 65535, 65535, 187, 65535, 65535, 188, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 188, 65535, 188, 65535, 188, 65535, 188, 65535, 188, 188, 65535, 65535, 65535, 65535,
+	187, 65535, 65535, 65535, 187, 187, 187, 65535, 187, 187, 65535, 65535, 65535, 65535, 65535, 65535,
+	187, 65535, 188, 65535, 65535, 65535, 65535, 65535, 65535, 188, 187, 65535, 187, 65535, 187, 65535,
+	187, 65535, 187, 187, 186, 186, 186, 65535, 186, 65535, 65535, 65535, 65535, 65535, 65535, 186,
+	65535, 65535, 65535, 186, 186, 65535, 186, 186, 65535, 65535, 187, 65535, 65535, 186, 186, 65535,
+	65535, 187, 65535, 65535, 186, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 185, 185, 185, 65535,
+	185, 65535, 65535, 65535, 65535, 65535, 65535, 185, 65535, 65535, 186, 185, 185, 65535, 185, 185,
+	65535, 65535, 65535, 65535, 65535, 185, 185, 65535, 65535, 65535, 65535, 65535, 185, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 186, 65535, 65535, 65535, 186, 186, 186, 65535, 186, 186, 65535,
+	65535, 65535, 185, 65535, 65535, 186, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 186,
+	65535, 186, 65535, 186, 65535, 186, 65535, 186, 186, 65535, 65535, 65535, 65535, 185, 65535, 65535,
+	65535, 185, 185, 185, 65535, 185, 185, 65535, 65535, 65535, 65535, 65535, 65535, 185, 65535, 186,
+	65535, 65535, 65535, 65535, 65535, 65535, 186, 185, 65535, 185, 65535, 185, 65535, 185, 65535, 185,
+	185, 184, 184, 184, 65535, 184, 65535, 65535, 65535, 65535, 65535, 65535, 184, 65535, 65535, 65535,
+	184, 184, 65535, 184, 184, 65535, 65535, 185, 65535, 65535, 184, 184, 65535, 65535, 185, 65535,
+	65535, 184, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 183, 183, 183, 65535, 183, 65535, 65535,
+	65535, 65535, 65535, 65535, 183, 65535, 65535, 184, 183, 183, 65535, 183, 183, 65535, 65535, 65535,
+	65535, 65535, 183, 183, 65535, 65535, 65535, 65535, 65535, 183, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 184, 65535, 65535, 65535, 184, 184, 184, 65535, 184, 184, 65535, 65535, 65535, 183,
+	65535, 65535, 184, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 184, 65535, 184, 65535,
+	184, 65535, 184, 65535, 184, 184, 65535, 65535, 65535, 65535, 183, 65535, 65535, 65535, 183, 183,
+	183, 65535, 183, 183, 65535, 65535, 65535, 65535, 65535, 65535, 183, 65535, 184, 65535, 65535, 65535,
+	65535, 65535, 65535, 184, 183, 65535, 183, 65535, 183, 65535, 183, 65535, 183, 183, 169, 169,
+	169, 65535, 169, 65535, 65535, 65535, 65535, 65535, 65535, 169, 65535, 65535, 65535, 169, 169, 65535,
+	169, 169, 65535, 65535, 183, 65535, 65535, 169, 169, 65535, 65535, 183, 65535, 65535, 169, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 124, 124, 124, 65535, 124, 65535, 65535, 65535, 65535, 65535,
+	65535, 124, 65535, 65535, 169, 124, 124, 65535, 124, 124, 65535, 65535, 65535, 65535, 65535, 124,
+	124, 65535, 65535, 65535, 65535, 65535, 124, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 169,
+	65535, 65535, 65535, 169, 169, 169, 65535, 169, 169, 65535, 65535, 65535, 124, 65535, 65535, 169,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 169, 65535, 169, 65535, 169, 65535, 169,
+	65535, 169, 169, 65535, 65535, 65535, 65535, 124, 65535, 65535, 65535, 65535, 124, 124, 217, 124,
+	124, 65535, 217, 65535, 217, 65535, 65535, 124, 65535, 169, 65535, 217, 65535, 65535, 65535, 65535,
+	169, 124, 65535, 124, 65535, 124, 65535, 124, 166, 124, 124, 65535, 166, 166, 166, 65535,
+	65535, 65535, 65535, 166, 65535, 166, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 124, 65535, 65535, 217, 156, 65535, 65535, 124, 156, 65535, 156, 112, 65535, 166, 65535,
+	112, 112, 112, 65535, 65535, 65535, 65535, 112, 65535, 112, 65535, 166, 65535, 65535, 166, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 217, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 54, 112, 65535, 65535, 54, 54, 54, 156, 65535, 65535, 156, 54, 65535, 54, 112,
+	65535, 166, 112, 65535, 65535, 217, 65535, 65535, 217, 217, 166, 166, 166, 166, 166, 166,
+	166, 217, 217, 65535, 65535, 65535, 65535, 54, 65535, 65535, 65535, 65535, 65535, 65535, 156, 166,
+	166, 65535, 166, 166, 54, 112, 65535, 54, 65535, 65535, 65535, 166, 166, 65535, 65535, 112,
+	112, 112, 112, 112, 112, 65535, 65535, 65535, 65535, 65535, 166, 65535, 65535, 65535, 156, 65535,
+	156, 65535, 65535, 112, 112, 65535, 112, 112, 156, 156, 54, 65535, 65535, 65535, 156, 112,
+	112, 65535, 65535, 65535, 54, 54, 54, 54, 54, 54, 65535, 65535, 65535, 65535, 112, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 54, 54, 65535, 54, 54, 273, 273, 273,
+	273, 273, 273, 273, 54, 54, 273, 273, 273, 65535, 65535, 65535, 273, 273, 65535, 65535,
+	65535, 65535, 65535, 54, 65535, 65535, 65535, 273, 273, 65535, 65535, 65535, 273, 273, 285, 285,
+	285, 285, 285, 285, 285, 65535, 65535, 285, 65535, 285, 65535, 65535, 65535, 285, 285, 65535,
+	65535, 289, 289, 289, 289, 289, 289, 289, 285, 285, 289, 65535, 65535, 285, 285, 65535,
+	289, 289, 346, 65535, 65535, 65535, 346, 65535, 346, 65535, 65535, 289, 289, 65535, 65535, 346,
+	289, 289, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 346, 65535, 65535, 346, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 346, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 346, 346, 65535, 346, 346, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 346, 346, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+
+static const unsigned short parserNext[PARSER_TABLE_SIZE] = {
+	8200, 8254, 8243, 8344, 8246, 8574, 8258, 8348, 8494, 8349, 8220, 8244, 8506, 8219, 8543, 8256,
+	8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 8297, 8451,
+	8255, 8266, 8267, 8245, 8279, 8280, 8225, 8291, 8498, 8262, 8261, 8221, 8272, 8270, 8222, 8224,
+	8226, 8273, 8271, 8227, 8231, 8223, 8247, 8487, 8572, 8345, 8437, 8571, 33069, 33068, 32774, 8258,
+	32773, 8570, 32775, 32778, 32779, 32783, 32782, 32784, 32781, 32793, 8569, 32794, 8499, 16585, 8444, 32780,
+	32804, 32809, 8451, 8258, 8298, 8439, 8443, 8431, 32808, 32812, 32813, 8456, 32989, 32939, 8498, 8361,
+	8565, 32814, 8389, 8385, 8391, 8378, 8386, 8384, 8381, 8501, 32817, 32826, 32827, 32828, 32829, 8457,
+	8558, 32818, 32815, 8399, 32825, 33128, 8557, 32870, 32871, 32872, 33029, 33028, 8383, 8382, 33126, 8556,
+	33081, 8390, 8380, 33144, 33105, 8555, 32922, 32923, 8554, 33118, 32824, 32816, 33109, 33066, 33065, 33067,
+	32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8200, 8254, 8243, 8243,
+	8246, 8338, 8258, 8487, 8494, 33149, 8220, 8244, 33127, 8219, 33029, 8256, 8257, 8201, 8277, 8278,
+	8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 8428, 8287, 8255, 8266, 8267, 8245,
+	8279, 8280, 8225, 33136, 32935, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227,
+	8231, 8223, 8247, 33014, 33016, 33017, 33018, 33135, 33069, 33068, 32774, 33140, 32773, 16587, 32775, 32778,
+	32779, 32783, 32782, 32784, 32781, 32793, 32976, 32794, 16586, 8451, 8444, 32780, 32804, 32809, 33061, 8258,
+	33062, 8247, 8443, 8431, 32808, 32812, 32813, 8389, 8385, 8391, 8378, 8386, 8544, 32814, 8389, 8385,
+	8391, 8378, 8386, 8384, 8381, 8530, 32817, 32826, 32827, 32828, 32829, 8289, 8291, 32818, 32815, 8525,
+	32825, 8383, 8523, 8514, 32995, 32994, 8390, 33078, 8383, 8382, 8538, 8258, 8258, 8390, 8380, 8391,
+	8378, 8386, 8536, 8391, 8378, 8386, 32824, 32816, 33108, 33066, 33065, 33067, 32805, 32806, 32810, 32811,
+	32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8200, 8254, 8243, 8498, 8246, 8513, 8258, 33026,
+	8494, 8512, 8220, 8244, 8511, 8219, 32927, 8256, 8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268,
+	8269, 8259, 8260, 8265, 8263, 8264, 8510, 8287, 8255, 8266, 8267, 8245, 8279, 8280, 8225, 32866,
+	32864, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227, 8231, 8223, 8247, 33123,
+	33016, 33017, 33018, 32974, 33069, 33068, 32774, 8509, 32773, 8508, 32775, 32778, 32779, 32783, 32782, 32784,
+	32781, 32793, 8504, 32794, 8431, 8503, 8444, 32780, 32804, 32809, 8243, 33111, 33113, 8247, 8443, 8499,
+	32808, 32812, 32813, 8389, 8385, 8391, 8378, 8386, 16588, 32814, 8389, 8385, 8391, 8378, 8386, 32928,
+	33110, 8496, 32817, 32826, 32827, 32828, 32829, 8483, 8463, 32818, 32815, 8460, 32825, 8383, 8408, 8455,
+	32973, 32972, 8390, 8444, 8383, 32996, 8447, 8446, 33073, 8390, 8445, 8443, 8389, 8385, 8391, 8378,
+	8386, 8430, 32824, 32816, 33107, 33066, 33065, 33067, 32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788,
+	32789, 32790, 32791, 32792, 8200, 8254, 8243, 32866, 8246, 33060, 8258, 8429, 8494, 8409, 8220, 8244,
+	8408, 8219, 8407, 8256, 8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265,
+	8263, 8264, 8279, 8280, 8255, 8266, 8267, 8245, 8279, 8280, 8225, 8406, 8365, 8262, 8261, 8221,
+	8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227, 8231, 8223, 8247, 33122, 33016, 33017, 33018, 8405,
+	33069, 33068, 32774, 8404, 32773, 8403, 32775, 32778, 32779, 32783, 32782, 32784, 32781, 32793, 8297, 32794,
+	8402, 8401, 8293, 32780, 32804, 32809, 8389, 8385, 8391, 8378, 8386, 8374, 32808, 32812, 32813, 8389,
+	8385, 8391, 8378, 8386, 8367, 32814, 8362, 8308, 33121, 33016, 33017, 33018, 32970, 8284, 32817, 32826,
+	32827, 32828, 32829, 24581, 40960, 32818, 32815, 40960, 32825, 8383, 40960, 40960, 40960, 40960, 8390, 33029,
+	33028, 33100, 40960, 8520, 8298, 8360, 40960, 8361, 40960, 8361, 40960, 40960, 40960, 32868, 32824, 32816,
+	33064, 33066, 33065, 33067, 32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792,
+	8200, 8254, 8243, 8291, 8246, 40960, 8258, 32870, 32871, 32872, 8220, 8244, 8291, 8219, 40960, 8256,
+	8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960,
+	8255, 8266, 8267, 8245, 8279, 8280, 8225, 8365, 40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224,
+	8226, 8273, 8271, 8227, 8231, 8223, 8247, 40960, 40960, 32769, 32770, 40960, 32772, 32771, 32774, 40960,
+	32773, 40960, 32775, 32778, 32779, 32783, 32782, 32784, 32781, 32793, 40960, 32794, 33095, 40960, 32935, 32780,
+	32804, 32809, 40960, 40960, 40960, 40960, 32866, 32864, 32808, 32812, 32813, 40960, 40960, 40960, 40960, 32927,
+	32926, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960,
+	40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 32927, 32926, 32942, 40960, 40960, 40960,
+	8365, 40960, 16574, 40960, 40960, 40960, 8427, 40960, 40960, 40960, 32824, 32816, 40960, 8516, 40960, 40960,
+	32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8200, 8254, 8243, 40960,
+	8246, 40960, 8258, 40960, 40960, 8428, 8220, 8244, 40960, 8219, 40960, 8256, 8257, 8201, 8277, 8278,
+	8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245,
+	8279, 8280, 8225, 40960, 40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227,
+	8231, 8223, 8247, 32866, 32864, 32940, 40960, 32930, 32859, 32858, 32774, 40960, 32773, 40960, 32775, 32778,
+	32779, 32783, 32782, 32784, 32781, 32793, 40960, 32794, 40960, 40960, 40960, 32780, 32804, 32809, 40960, 40960,
+	40960, 40960, 40960, 40960, 32808, 32812, 32813, 40960, 40960, 40960, 40960, 40960, 40960, 32814, 32997, 33091,
+	32996, 33000, 33093, 32998, 33094, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960,
+	32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 16574, 40960,
+	40960, 40960, 8427, 40960, 40960, 40960, 32824, 32816, 40960, 8423, 40960, 40960, 32805, 32806, 32810, 32811,
+	32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8200, 8254, 8243, 40960, 8246, 40960, 8258, 40960,
+	40960, 8428, 8220, 8244, 40960, 8219, 40960, 8256, 8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268,
+	8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245, 8279, 8280, 8225, 40960,
+	40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227, 8231, 8223, 8247, 40960,
+	40960, 40960, 32929, 40960, 32772, 32771, 32774, 40960, 32773, 40960, 32775, 32778, 32779, 32783, 32782, 32784,
+	32781, 32793, 40960, 32794, 40960, 40960, 40960, 32780, 32804, 32809, 40960, 40960, 40960, 40960, 40960, 40960,
+	32808, 32812, 32813, 40960, 40960, 40960, 40960, 40960, 40960, 32814, 32997, 40960, 32996, 33000, 33001, 32998,
+	33002, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32824, 32816, 40960, 40960, 40960, 40960, 32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788,
+	32789, 32790, 32791, 32792, 8200, 8254, 8243, 8344, 8246, 40960, 8258, 8348, 40960, 8349, 8220, 8244,
+	40960, 8219, 40960, 8256, 8257, 8201, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265,
+	8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245, 8279, 8280, 8225, 40960, 40960, 8262, 8261, 8221,
+	8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227, 8231, 8223, 8247, 40960, 40960, 8345, 40960, 32857,
+	32859, 32858, 32774, 40960, 32773, 40960, 32775, 32778, 32779, 32783, 32782, 32784, 32781, 32793, 40960, 32794,
+	40960, 40960, 40960, 32780, 32804, 32809, 40960, 40960, 40960, 40960, 40960, 40960, 32808, 32812, 32813, 8427,
+	32989, 40960, 40960, 40960, 40960, 32814, 8423, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826,
+	32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 8428, 40960,
+	40960, 40960, 32988, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32922, 32923, 40960, 40960, 32824, 32816,
+	33142, 40960, 40960, 40960, 32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792,
+	8287, 8254, 8243, 8344, 8246, 40960, 8258, 8348, 40960, 8349, 8220, 8244, 40960, 8219, 40960, 8256,
+	8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960,
+	8255, 8266, 8267, 8245, 8279, 8280, 8225, 40960, 40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224,
+	8226, 8273, 8271, 8227, 8231, 8223, 8247, 32997, 40960, 8345, 33000, 33001, 33009, 33002, 40960, 40960,
+	40960, 32931, 32862, 32778, 32779, 32783, 32782, 32784, 32781, 32793, 40960, 32794, 40960, 40960, 40960, 32780,
+	32804, 32809, 40960, 40960, 40960, 40960, 40960, 40960, 32808, 32812, 32813, 8427, 32989, 40960, 40960, 40960,
+	40960, 32814, 8423, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960,
+	40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 8428, 40960, 40960, 40960, 32988, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 32922, 32923, 40960, 40960, 32824, 32816, 33115, 40960, 40960, 40960,
+	32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8287, 8254, 8243, 8344,
+	8246, 40960, 8258, 8348, 40960, 8349, 8220, 8244, 40960, 8219, 40960, 8256, 8257, 40960, 8277, 8278,
+	8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245,
+	8279, 8280, 8225, 40960, 40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227,
+	8231, 8223, 8247, 33010, 40960, 8345, 33000, 33001, 33009, 33002, 40960, 40960, 40960, 32861, 32862, 32778,
+	32779, 32783, 32782, 32784, 32781, 32793, 40960, 32794, 40960, 40960, 40960, 32780, 32804, 32809, 40960, 40960,
+	40960, 40960, 40960, 40960, 32808, 32812, 32813, 8427, 32989, 40960, 40960, 40960, 40960, 32814, 8423, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960,
+	32825, 40960, 40960, 40960, 40960, 40960, 8428, 40960, 40960, 40960, 32988, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32922, 32923, 40960, 40960, 32824, 32816, 33083, 40960, 40960, 40960, 32805, 32806, 32810, 32811,
+	32785, 32786, 32787, 32788, 32789, 32790, 32791, 32792, 8287, 8254, 8243, 40960, 8246, 40960, 8258, 40960,
+	40960, 40960, 8220, 8244, 40960, 8219, 40960, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268,
+	8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245, 8279, 8280, 8225, 40960,
+	40960, 8262, 8261, 8221, 8272, 8270, 8222, 8224, 8226, 8273, 8271, 8227, 8231, 8223, 8247, 33008,
+	40960, 40960, 33000, 33001, 33009, 33002, 40960, 40960, 40960, 40960, 32876, 32875, 32779, 32783, 32782, 32784,
+	32781, 32793, 40960, 32794, 40960, 40960, 40960, 32780, 32804, 32809, 40960, 40960, 40960, 40960, 40960, 40960,
+	32808, 32812, 32813, 40960, 40960, 40960, 40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32824, 32816, 40960, 40960, 40960, 40960, 32805, 32806, 32810, 32811, 32785, 32786, 32787, 32788,
+	32789, 32790, 32791, 32792, 8287, 8254, 8243, 40960, 8246, 40960, 8258, 40960, 40960, 40960, 40960, 8244,
+	40960, 8219, 40960, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265,
+	8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960,
+	8272, 8270, 40960, 40960, 40960, 8273, 8271, 40960, 8231, 40960, 8247, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 33034, 33035, 32783, 32782, 32784, 32781, 32793, 40960, 32794,
+	40960, 40960, 40960, 40960, 32804, 32809, 40960, 40960, 40960, 40960, 40960, 40960, 32808, 32812, 32813, 40960,
+	40960, 40960, 40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826,
+	32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8344, 32824, 32816,
+	40960, 8348, 8344, 8349, 32805, 32806, 32810, 32811, 8287, 8254, 8243, 40960, 8246, 8244, 8258, 40960,
+	40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268,
+	8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245, 8279, 8280, 40960, 40960,
+	8549, 8262, 8261, 8345, 8272, 8270, 40960, 40960, 8345, 8273, 8271, 40960, 8231, 40960, 8247, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8344, 40960, 40960, 40960, 8348, 40960, 8349, 40960,
+	33102, 32793, 40960, 32794, 40960, 8410, 32989, 40960, 32804, 32809, 40960, 32993, 40960, 40960, 40960, 40960,
+	32808, 32812, 32813, 40960, 40960, 32992, 32991, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 32988, 32818, 32815, 40960, 32825, 40960, 8345, 40960,
+	32922, 32923, 40960, 40960, 40960, 40960, 33124, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32824, 32816, 32990, 40960, 40960, 40960, 32805, 32806, 32810, 32811, 8287, 8254, 8243, 40960,
+	8246, 32989, 8258, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278,
+	8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 8245,
+	8279, 8280, 40960, 32988, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 32922, 32923, 8273, 8271, 40960,
+	8231, 32987, 8247, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 33038, 32793, 40960, 32794, 40960, 40960, 40960, 40960, 32804, 32809, 40960, 40960,
+	40960, 40960, 40960, 40960, 32808, 32812, 32813, 40960, 40960, 40960, 40960, 40960, 40960, 32814, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960,
+	32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 40960, 40960, 40960, 40960, 32805, 32806, 32810, 32811,
+	8287, 8254, 8243, 40960, 8246, 40960, 8258, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256,
+	8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960,
+	8255, 8266, 8267, 8245, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 8522,
+	40960, 8273, 8271, 40960, 40960, 40960, 8247, 40960, 8521, 40960, 40960, 40960, 8389, 8385, 8391, 8378,
+	8386, 8384, 8381, 40960, 40960, 8375, 8388, 8392, 40960, 32881, 40960, 8377, 8387, 40960, 40960, 40960,
+	32804, 32809, 40960, 8376, 8379, 40960, 8383, 8382, 32808, 32812, 32813, 8390, 8380, 40960, 40960, 40960,
+	40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960,
+	40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 40960, 40960, 40960, 40960,
+	32805, 32806, 32810, 32811, 8287, 8254, 8243, 40960, 8304, 40960, 8258, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 8372, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265,
+	8263, 8264, 40960, 40960, 8255, 8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960,
+	8272, 8270, 40960, 40960, 40960, 8273, 8271, 40960, 40960, 40960, 8247, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 8389, 8385, 8391, 8378, 8386, 8384, 8381, 40960, 40960,
+	33037, 32947, 32946, 40960, 32949, 32809, 8377, 8387, 40960, 40960, 40960, 40960, 32808, 32812, 32813, 40960,
+	40960, 8383, 8382, 40960, 40960, 32814, 8390, 8380, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826,
+	32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 8258, 40960, 40960, 40960, 40960, 40960, 32824, 32816,
+	8372, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264,
+	40960, 40960, 8255, 8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272, 8270,
+	40960, 40960, 40960, 8273, 8271, 40960, 40960, 40960, 8247, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32945, 32947,
+	32946, 40960, 32949, 32809, 40960, 40960, 40960, 40960, 40960, 40960, 32808, 32812, 32813, 40960, 40960, 40960,
+	40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828,
+	32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287,
+	8254, 8243, 40960, 8304, 40960, 8258, 40960, 40960, 40960, 40960, 8244, 40960, 32824, 32816, 8256, 8257,
+	40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255,
+	8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 8567, 40960,
+	8273, 8271, 40960, 40960, 40960, 8247, 40960, 40960, 40960, 40960, 40960, 8389, 8385, 8391, 8378, 8386,
+	8384, 8381, 40960, 40960, 8375, 8388, 8392, 40960, 40960, 32877, 8377, 8387, 40960, 40960, 40960, 32878,
+	32809, 40960, 8376, 8379, 40960, 8383, 8382, 32808, 32812, 32813, 8390, 8380, 40960, 40960, 40960, 40960,
+	32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960,
+	32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 40960, 8287, 8254, 8243, 32879,
+	8358, 32810, 8258, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278,
+	8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 40960,
+	8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 8563, 40960, 8273, 8271, 40960,
+	40960, 40960, 8247, 40960, 40960, 40960, 40960, 40960, 8389, 8385, 8391, 8378, 8386, 8384, 8381, 40960,
+	40960, 8375, 8388, 8392, 40960, 40960, 40960, 8377, 8387, 40960, 40960, 40960, 32933, 32809, 40960, 8376,
+	8379, 40960, 8383, 8382, 32808, 32812, 32813, 8390, 8380, 40960, 40960, 40960, 32932, 32814, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960,
+	32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 40960, 40960, 8304, 40960, 8258,
+	40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276,
+	8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 40960, 8279, 8280, 40960,
+	40960, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 8541, 40960, 8273, 8271, 40960, 40960, 40960, 8247,
+	40960, 40960, 40960, 40960, 40960, 8389, 8385, 8391, 8378, 8386, 8384, 8381, 40960, 40960, 8375, 8388,
+	8392, 40960, 40960, 40960, 8377, 8387, 40960, 40960, 40960, 40960, 40960, 40960, 8376, 8379, 40960, 8383,
+	8382, 32886, 32812, 32813, 8390, 8380, 40960, 40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 40960, 40960, 8304, 40960, 8258, 40960, 40960, 40960,
+	40960, 40960, 40960, 32824, 32816, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259,
+	8260, 8265, 8263, 8264, 40960, 40960, 8255, 8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262,
+	8261, 40960, 8272, 8270, 40960, 8393, 40960, 8273, 8271, 40960, 40960, 40960, 8247, 8389, 8385, 8391,
+	8378, 8386, 8384, 8381, 40960, 40960, 8375, 8388, 8392, 40960, 40960, 40960, 8377, 8387, 40960, 40960,
+	40960, 40960, 40960, 40960, 8376, 8379, 40960, 8383, 8382, 40960, 40960, 40960, 8390, 8380, 32885, 32812,
+	32813, 40960, 40960, 40960, 40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	32817, 32826, 32827, 32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 8287, 8254, 40960, 40960, 8304, 40960, 8258, 40960, 40960, 40960, 40960, 40960, 40960,
+	32824, 32816, 8256, 8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263,
+	8264, 40960, 40960, 8255, 8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272,
+	8270, 40960, 40960, 40960, 8273, 8271, 40960, 40960, 40960, 8247, 8389, 8385, 8391, 8378, 8386, 8384,
+	8381, 40960, 40960, 8375, 8388, 8392, 40960, 40960, 40960, 8377, 8387, 40960, 40960, 40960, 40960, 40960,
+	40960, 8376, 40960, 40960, 8383, 8382, 40960, 40960, 40960, 8390, 8380, 32883, 32812, 32813, 40960, 40960,
+	40960, 40960, 40960, 40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827,
+	32828, 32829, 40960, 40960, 32818, 32815, 40960, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	8287, 8254, 40960, 40960, 8304, 40960, 8258, 40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 8256,
+	8257, 40960, 8277, 8278, 8274, 8275, 8276, 8268, 8269, 8259, 8260, 8265, 8263, 8264, 40960, 40960,
+	8255, 8266, 8267, 40960, 8279, 8280, 40960, 40960, 40960, 8262, 8261, 40960, 8272, 8270, 40960, 40960,
+	40960, 8273, 8271, 40960, 40960, 40960, 8247, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243,
+	40960, 8304, 40960, 8487, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277,
+	8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 32882, 32812, 32813, 40960, 40960, 8255, 40960, 40960,
+	40960, 32814, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32817, 32826, 32827, 32828, 32829, 40960,
+	40960, 32818, 32815, 8247, 32825, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32824, 32816, 40960, 40960, 32900, 33103,
+	33105, 33104, 32889, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960,
+	32897, 32903, 8287, 8254, 8243, 8312, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960,
+	40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895,
+	40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 8501,
+	40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960,
+	40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 32900, 40960, 40960, 32887, 32889, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960,
+	8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902,
+	40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33076,
+	32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960,
+	40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287,
+	8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257,
+	40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960,
+	40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960,
+	8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	32900, 40960, 40960, 33058, 32889, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960,
+	32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960,
+	32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33129, 32890, 32891, 40960,
+	32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960,
+	40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960,
+	8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278,
+	40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244,
+	40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960,
+	40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960,
+	40960, 33116, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897,
+	32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33076, 32890, 32891, 40960, 32893, 32894, 40960,
+	40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901,
+	40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960,
+	40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898,
+	40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247,
+	8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960,
+	40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33057, 32890,
+	32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960,
+	40960, 40960, 32900, 40960, 40960, 40960, 33056, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960,
+	40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960,
+	32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960,
+	40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259,
+	8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254,
+	8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960,
+	8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33055, 32890, 32891, 40960, 32893,
+	32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900,
+	40960, 40960, 40960, 33054, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896,
+	40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899,
+	40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960,
+	40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960,
+	32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304,
+	40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960,
+	40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33053, 32890, 32891, 40960, 32893, 32894, 40960, 40960,
+	40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960,
+	32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960,
+	33052, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960,
+	40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903,
+	8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256,
+	8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960,
+	8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960,
+	40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960,
+	40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 32900, 40960, 40960, 40960, 33051, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960,
+	40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892,
+	40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33050, 32890, 32891,
+	40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960,
+	40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243,
+	40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277,
+	8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960,
+	8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260,
+	40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960,
+	40960, 40960, 33049, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960,
+	32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33048, 32890, 32891, 40960, 32893, 32894,
+	40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895,
+	32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960,
+	40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960,
+	32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960,
+	8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960,
+	40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33047,
+	32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960,
+	40960, 40960, 40960, 32900, 40960, 40960, 40960, 33046, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960,
+	40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902,
+	40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960,
+	40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960,
+	8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287,
+	8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257,
+	40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33045, 32890, 32891, 40960,
+	32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960,
+	32900, 40960, 40960, 40960, 33044, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960,
+	32896, 40960, 32898, 40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960,
+	32899, 40960, 32897, 32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244,
+	40960, 40960, 40960, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960,
+	40960, 32895, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960,
+	8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278,
+	40960, 40960, 40960, 40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33043, 32890, 32891, 40960, 32893, 32894, 40960,
+	40960, 40960, 8247, 40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901,
+	40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960,
+	40960, 33042, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898,
+	40960, 40960, 40960, 40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897,
+	32903, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960,
+	8256, 8257, 40960, 8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960,
+	40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960,
+	40960, 40960, 40960, 40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960,
+	40960, 40960, 8259, 8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 32900, 40960, 40960, 40960, 33041, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247,
+	40960, 40960, 32896, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960,
+	32892, 40960, 32899, 40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 33040, 32890,
+	32891, 40960, 32893, 32894, 40960, 40960, 40960, 40960, 40960, 40960, 32896, 40960, 32898, 40960, 40960, 40960,
+	40960, 40960, 40960, 32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 40960, 32897, 32903, 8287, 8254,
+	8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960, 40960, 8244, 40960, 40960, 40960, 8256, 8257, 40960,
+	8277, 8278, 40960, 40960, 32898, 40960, 40960, 8259, 8260, 40960, 40960, 32895, 40960, 40960, 8255, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 8287, 8254, 8243, 40960, 8304, 40960, 40960, 40960, 40960, 40960,
+	40960, 8244, 40960, 40960, 8247, 8256, 8257, 40960, 8277, 8278, 40960, 40960, 40960, 40960, 40960, 8259,
+	8260, 40960, 40960, 40960, 40960, 40960, 8255, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32900,
+	40960, 40960, 40960, 33030, 32890, 32891, 40960, 32893, 32894, 40960, 40960, 40960, 8247, 40960, 40960, 32896,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32901, 40960, 32902, 40960, 32892, 40960, 32899,
+	40960, 32897, 32903, 40960, 40960, 40960, 40960, 32900, 40960, 40960, 40960, 40960, 32971, 32891, 8344, 32893,
+	32894, 40960, 8348, 40960, 8349, 40960, 40960, 32896, 40960, 32898, 40960, 8343, 40960, 40960, 40960, 40960,
+	32895, 32901, 40960, 32902, 40960, 32892, 40960, 32899, 8344, 32897, 32903, 40960, 8348, 8368, 8349, 40960,
+	40960, 40960, 40960, 8244, 40960, 8343, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 32898, 40960, 40960, 8345, 8344, 40960, 40960, 32895, 8348, 40960, 8349, 8344, 40960, 8339, 40960,
+	8348, 8368, 8349, 40960, 40960, 40960, 40960, 8244, 40960, 8343, 40960, 8338, 40960, 40960, 8345, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 32989, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 8344, 8339, 40960, 40960, 8348, 8336, 8349, 8437, 40960, 40960, 8345, 8244, 40960, 8343, 8338,
+	40960, 33025, 8345, 40960, 40960, 33071, 40960, 40960, 32913, 32918, 33024, 32911, 32909, 32910, 32908, 32907,
+	32906, 32922, 32923, 40960, 40960, 40960, 40960, 8339, 40960, 40960, 40960, 40960, 40960, 40960, 32989, 32904,
+	32905, 40960, 32913, 32918, 8338, 32917, 40960, 8345, 40960, 40960, 40960, 32922, 32923, 40960, 40960, 32911,
+	32909, 32910, 32908, 32907, 32906, 40960, 40960, 40960, 40960, 40960, 32916, 40960, 40960, 40960, 33011, 40960,
+	32988, 40960, 40960, 32904, 32905, 40960, 32913, 32918, 32922, 32923, 32917, 40960, 40960, 40960, 33012, 32922,
+	32923, 40960, 40960, 40960, 32911, 32909, 32910, 32908, 32907, 32906, 40960, 40960, 40960, 40960, 32916, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32904, 32905, 40960, 32913, 32918, 8389, 8385, 8391,
+	8378, 8386, 8384, 8381, 32922, 32923, 8375, 8388, 8392, 40960, 40960, 40960, 8377, 8387, 40960, 40960,
+	40960, 40960, 40960, 32916, 40960, 40960, 40960, 8383, 8382, 40960, 40960, 40960, 8390, 8380, 8389, 8385,
+	8391, 8378, 8386, 8384, 8381, 40960, 40960, 8375, 40960, 8392, 40960, 40960, 40960, 8377, 8387, 40960,
+	40960, 8389, 8385, 8391, 8378, 8386, 8384, 8381, 8383, 8382, 8375, 40960, 40960, 8390, 8380, 40960,
+	8377, 8387, 8344, 40960, 40960, 40960, 8348, 40960, 8349, 40960, 40960, 8383, 8382, 40960, 40960, 8343,
+	8390, 8380, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 8338, 40960, 40960, 8345, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 32989, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 33137, 33138, 40960, 32913, 32918, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 32922, 32923, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+	40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960, 40960,
+};
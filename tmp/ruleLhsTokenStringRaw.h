@@ -0,0 +1,265 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+static const char *const ruleLhsTokenString[NUM_RULES] = {
+	"",
+	"Program",
+	"Pipes",
+	"Pipes",
+	"Pipes",
+	"Pipes",
+	"NonEmptyPipes",
+	"NonEmptyPipes",
+	"NonEmptyPipes",
+	"Pipe",
+	"Pipe",
+	"LastPipe",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"Declaration",
+	"ImportIdentifier",
+	"ImportIdentifier",
+	"ImportIdentifier",
+	"NonEmptyTerms",
+	"Terms",
+	"Terms",
+	"Term",
+	"Term",
+	"Term",
+	"ClosedTerm",
+	"ClosedTerm",
+	"OpenTerm",
+	"OpenTerm",
+	"SimpleCondTerm",
+	"ClosedCondTerm",
+	"OpenCondTerm",
+	"SimpleTerm",
+	"SimpleTerm",
+	"StaticTerm",
+	"StaticTerm",
+	"StaticTerm",
+	"SingleStaticTerm",
+	"SingleStaticTerm",
+	"SwitchTerm",
+	"LabeledTerms",
+	"LabeledTerms",
+	"LabeledTerm",
+	"LabeledTerm",
+	"LastLabeledTerm",
+	"LastLabeledTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"DynamicTerm",
+	"TypedStaticTerm",
+	"TypedStaticTerm",
+	"BracketedExp",
+	"BracketedExp",
+	"CurlyBracketedExpList",
+	"CurlyBracketedExpList",
+	"CurlyBracketedExp",
+	"CurlyBracketedExp",
+	"ExpList",
+	"ExpList",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Exp",
+	"Primary",
+	"Primary",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"PrimaryBase",
+	"Node",
+	"Node",
+	"Node",
+	"Node",
+	"Node",
+	"Node",
+	"Node",
+	"NonArrayedIdentifier",
+	"NonArrayedIdentifier",
+	"ArrayedIdentifier",
+	"ArrayedIdentifier",
+	"OpenIdentifier",
+	"OpenIdentifier",
+	"NonArrayedIdentifierSuffix",
+	"NonArrayedIdentifierSuffix",
+	"ArrayedIdentifierSuffix",
+	"ArrayedIdentifierSuffix",
+	"OpenIdentifierSuffix",
+	"OpenIdentifierSuffix",
+	"IdentifierSuffix",
+	"IdentifierSuffix",
+	"IdentifierSuffix",
+	"BlankInstantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"Instantiation",
+	"BlankInstantiationSource",
+	"SingleInitInstantiationSource",
+	"MultiInitInstantiationSource",
+	"SingleFlowInitInstantiationSource",
+	"MultiFlowInitInstantiationSource",
+	"CopyInstantiationSource",
+	"CopyInstantiationSource",
+	"CloneInstantiationSource",
+	"ArrayAccess",
+	"ArrayAccess",
+	"PrimOpNode",
+	"PrimOpNode",
+	"PrimOpNode",
+	"PrimOpNode",
+	"PrefixOp",
+	"PrefixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"InfixOp",
+	"MultiOp",
+	"MultiOp",
+	"PostfixOp",
+	"PostfixOp",
+	"PrefixOrMultiOp",
+	"PrefixOrMultiOp",
+	"InfixOrMultiOp",
+	"InfixOrMultiOp",
+	"PrimLiteral",
+	"PrimLiteral",
+	"PrimLiteral",
+	"PrimLiteral",
+	"Filter",
+	"Filter",
+	"ExplicitFilter",
+	"FilterHeader",
+	"FilterHeader",
+	"FilterHeader",
+	"NonRetFilterHeader",
+	"RetFilterHeader",
+	"ParamList",
+	"ParamList",
+	"RetList",
+	"RetList",
+	"ExplicitRetList",
+	"Param",
+	"Param",
+	"Type",
+	"Type",
+	"Type",
+	"Type",
+	"Type",
+	"Type",
+	"TypeSuffix",
+	"TypeSuffix",
+	"TypeSuffix",
+	"TypeSuffix",
+	"TypeSuffix",
+	"BlankInstantiationTypeSuffix",
+	"BlankInstantiationTypeSuffix",
+	"BlankInstantiationTypeSuffix",
+	"MultiInitInstantiationTypeSuffix",
+	"ListTypeSuffix",
+	"ListTypeSuffix",
+	"StreamTypeSuffix",
+	"StreamTypeSuffix",
+	"ArrayTypeSuffix",
+	"ArrayTypeSuffix",
+	"PoolTypeSuffix",
+	"PoolTypeSuffix",
+	"FilterType",
+	"FilterType",
+	"FilterType",
+	"ObjectType",
+	"ObjectType",
+	"ObjectTypeList",
+	"ObjectTypeList",
+	"ObjectTypeList",
+	"ObjectTypeList",
+	"ObjectTypeList",
+	"ObjectTypeList",
+	"InstructorType",
+	"InstructorType",
+	"OutstructorType",
+	"MemberType",
+	"TypeList",
+	"TypeList",
+	"Block",
+	"Object",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"ObjectPipes",
+	"Instructor",
+	"Instructor",
+	"Instructor",
+	"Instructor",
+	"LastInstructor",
+	"LastInstructor",
+	"Outstructor",
+	"Outstructor",
+	"SingleAccess",
+	"MultiAccess",
+	"SingleAccessor",
+	"MultiAccessor",
+	"MultiAccessor",
+	"Compound",
+	"Pack",
+	"Unpack",
+	"Link",
+	"Loopback",
+	"Send",
+	"Swap",
+	"Return",
+};
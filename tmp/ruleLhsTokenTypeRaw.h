@@ -0,0 +1,265 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+static const unsigned char ruleLhsTokenType[NUM_RULES] = {
+	0,
+	TOKEN_Program,
+	TOKEN_Pipes,
+	TOKEN_Pipes,
+	TOKEN_Pipes,
+	TOKEN_Pipes,
+	TOKEN_NonEmptyPipes,
+	TOKEN_NonEmptyPipes,
+	TOKEN_NonEmptyPipes,
+	TOKEN_Pipe,
+	TOKEN_Pipe,
+	TOKEN_LastPipe,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_Declaration,
+	TOKEN_ImportIdentifier,
+	TOKEN_ImportIdentifier,
+	TOKEN_ImportIdentifier,
+	TOKEN_NonEmptyTerms,
+	TOKEN_Terms,
+	TOKEN_Terms,
+	TOKEN_Term,
+	TOKEN_Term,
+	TOKEN_Term,
+	TOKEN_ClosedTerm,
+	TOKEN_ClosedTerm,
+	TOKEN_OpenTerm,
+	TOKEN_OpenTerm,
+	TOKEN_SimpleCondTerm,
+	TOKEN_ClosedCondTerm,
+	TOKEN_OpenCondTerm,
+	TOKEN_SimpleTerm,
+	TOKEN_SimpleTerm,
+	TOKEN_StaticTerm,
+	TOKEN_StaticTerm,
+	TOKEN_StaticTerm,
+	TOKEN_SingleStaticTerm,
+	TOKEN_SingleStaticTerm,
+	TOKEN_SwitchTerm,
+	TOKEN_LabeledTerms,
+	TOKEN_LabeledTerms,
+	TOKEN_LabeledTerm,
+	TOKEN_LabeledTerm,
+	TOKEN_LastLabeledTerm,
+	TOKEN_LastLabeledTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_DynamicTerm,
+	TOKEN_TypedStaticTerm,
+	TOKEN_TypedStaticTerm,
+	TOKEN_BracketedExp,
+	TOKEN_BracketedExp,
+	TOKEN_CurlyBracketedExpList,
+	TOKEN_CurlyBracketedExpList,
+	TOKEN_CurlyBracketedExp,
+	TOKEN_CurlyBracketedExp,
+	TOKEN_ExpList,
+	TOKEN_ExpList,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Exp,
+	TOKEN_Primary,
+	TOKEN_Primary,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_PrimaryBase,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_Node,
+	TOKEN_NonArrayedIdentifier,
+	TOKEN_NonArrayedIdentifier,
+	TOKEN_ArrayedIdentifier,
+	TOKEN_ArrayedIdentifier,
+	TOKEN_OpenIdentifier,
+	TOKEN_OpenIdentifier,
+	TOKEN_NonArrayedIdentifierSuffix,
+	TOKEN_NonArrayedIdentifierSuffix,
+	TOKEN_ArrayedIdentifierSuffix,
+	TOKEN_ArrayedIdentifierSuffix,
+	TOKEN_OpenIdentifierSuffix,
+	TOKEN_OpenIdentifierSuffix,
+	TOKEN_IdentifierSuffix,
+	TOKEN_IdentifierSuffix,
+	TOKEN_IdentifierSuffix,
+	TOKEN_BlankInstantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_Instantiation,
+	TOKEN_BlankInstantiationSource,
+	TOKEN_SingleInitInstantiationSource,
+	TOKEN_MultiInitInstantiationSource,
+	TOKEN_SingleFlowInitInstantiationSource,
+	TOKEN_MultiFlowInitInstantiationSource,
+	TOKEN_CopyInstantiationSource,
+	TOKEN_CopyInstantiationSource,
+	TOKEN_CloneInstantiationSource,
+	TOKEN_ArrayAccess,
+	TOKEN_ArrayAccess,
+	TOKEN_PrimOpNode,
+	TOKEN_PrimOpNode,
+	TOKEN_PrimOpNode,
+	TOKEN_PrimOpNode,
+	TOKEN_PrefixOp,
+	TOKEN_PrefixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_InfixOp,
+	TOKEN_MultiOp,
+	TOKEN_MultiOp,
+	TOKEN_PostfixOp,
+	TOKEN_PostfixOp,
+	TOKEN_PrefixOrMultiOp,
+	TOKEN_PrefixOrMultiOp,
+	TOKEN_InfixOrMultiOp,
+	TOKEN_InfixOrMultiOp,
+	TOKEN_PrimLiteral,
+	TOKEN_PrimLiteral,
+	TOKEN_PrimLiteral,
+	TOKEN_PrimLiteral,
+	TOKEN_Filter,
+	TOKEN_Filter,
+	TOKEN_ExplicitFilter,
+	TOKEN_FilterHeader,
+	TOKEN_FilterHeader,
+	TOKEN_FilterHeader,
+	TOKEN_NonRetFilterHeader,
+	TOKEN_RetFilterHeader,
+	TOKEN_ParamList,
+	TOKEN_ParamList,
+	TOKEN_RetList,
+	TOKEN_RetList,
+	TOKEN_ExplicitRetList,
+	TOKEN_Param,
+	TOKEN_Param,
+	TOKEN_Type,
+	TOKEN_Type,
+	TOKEN_Type,
+	TOKEN_Type,
+	TOKEN_Type,
+	TOKEN_Type,
+	TOKEN_TypeSuffix,
+	TOKEN_TypeSuffix,
+	TOKEN_TypeSuffix,
+	TOKEN_TypeSuffix,
+	TOKEN_TypeSuffix,
+	TOKEN_BlankInstantiationTypeSuffix,
+	TOKEN_BlankInstantiationTypeSuffix,
+	TOKEN_BlankInstantiationTypeSuffix,
+	TOKEN_MultiInitInstantiationTypeSuffix,
+	TOKEN_ListTypeSuffix,
+	TOKEN_ListTypeSuffix,
+	TOKEN_StreamTypeSuffix,
+	TOKEN_StreamTypeSuffix,
+	TOKEN_ArrayTypeSuffix,
+	TOKEN_ArrayTypeSuffix,
+	TOKEN_PoolTypeSuffix,
+	TOKEN_PoolTypeSuffix,
+	TOKEN_FilterType,
+	TOKEN_FilterType,
+	TOKEN_FilterType,
+	TOKEN_ObjectType,
+	TOKEN_ObjectType,
+	TOKEN_ObjectTypeList,
+	TOKEN_ObjectTypeList,
+	TOKEN_ObjectTypeList,
+	TOKEN_ObjectTypeList,
+	TOKEN_ObjectTypeList,
+	TOKEN_ObjectTypeList,
+	TOKEN_InstructorType,
+	TOKEN_InstructorType,
+	TOKEN_OutstructorType,
+	TOKEN_MemberType,
+	TOKEN_TypeList,
+	TOKEN_TypeList,
+	TOKEN_Block,
+	TOKEN_Object,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_ObjectPipes,
+	TOKEN_Instructor,
+	TOKEN_Instructor,
+	TOKEN_Instructor,
+	TOKEN_Instructor,
+	TOKEN_LastInstructor,
+	TOKEN_LastInstructor,
+	TOKEN_Outstructor,
+	TOKEN_Outstructor,
+	TOKEN_SingleAccess,
+	TOKEN_MultiAccess,
+	TOKEN_SingleAccessor,
+	TOKEN_MultiAccessor,
+	TOKEN_MultiAccessor,
+	TOKEN_Compound,
+	TOKEN_Pack,
+	TOKEN_Unpack,
+	TOKEN_Link,
+	TOKEN_Loopback,
+	TOKEN_Send,
+	TOKEN_Swap,
+	TOKEN_Return,
+};
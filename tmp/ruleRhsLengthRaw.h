@@ -0,0 +1,265 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+static const unsigned char ruleRhsLength[NUM_RULES] = {
+	1,
+	1,
+	0,
+	1,
+	1,
+	2,
+	1,
+	1,
+	2,
+	1,
+	2,
+	1,
+	3,
+	4,
+	3,
+	4,
+	2,
+	3,
+	4,
+	5,
+	1,
+	1,
+	1,
+	2,
+	0,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	4,
+	4,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	4,
+	1,
+	2,
+	3,
+	4,
+	2,
+	3,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	3,
+	1,
+	3,
+	3,
+	3,
+	1,
+	3,
+	1,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	1,
+	2,
+	1,
+	1,
+	2,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	0,
+	3,
+	3,
+	3,
+	2,
+	3,
+	0,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	3,
+	4,
+	3,
+	3,
+	3,
+	3,
+	2,
+	1,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	3,
+	5,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	2,
+	3,
+	4,
+	3,
+	3,
+	3,
+	1,
+	3,
+	2,
+	2,
+	2,
+	2,
+	2,
+	1,
+	1,
+	1,
+	2,
+	2,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	3,
+	1,
+	2,
+	3,
+	4,
+	4,
+	5,
+	3,
+	4,
+	3,
+	2,
+	3,
+	1,
+	3,
+	1,
+	3,
+	1,
+	3,
+	1,
+	4,
+	5,
+	3,
+	1,
+	3,
+	3,
+	5,
+	1,
+	1,
+	2,
+	1,
+	2,
+	1,
+	1,
+	2,
+	2,
+	3,
+	3,
+	4,
+	1,
+	2,
+	3,
+	4,
+	2,
+	2,
+	1,
+	1,
+	2,
+	2,
+	1,
+	1,
+	2,
+	1,
+	2,
+	2,
+	1,
+};
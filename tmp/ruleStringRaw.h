@@ -0,0 +1,265 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+static const char *const ruleString[NUM_RULES] = {
+	"$accept -> Program",
+	"Program -> Pipes",
+	"Pipes ->",
+	"Pipes -> LastPipe",
+	"Pipes -> Pipe",
+	"Pipes -> Pipe NonEmptyPipes",
+	"NonEmptyPipes -> LastPipe",
+	"NonEmptyPipes -> Pipe",
+	"NonEmptyPipes -> Pipe NonEmptyPipes",
+	"Pipe -> Declaration",
+	"Pipe -> NonEmptyTerms SEMICOLON",
+	"LastPipe -> NonEmptyTerms",
+	"Declaration -> ID EQUALS TypedStaticTerm",
+	"Declaration -> ID EQUALS TypedStaticTerm SEMICOLON",
+	"Declaration -> ID EQUALS BlankInstantiation",
+	"Declaration -> ID EQUALS BlankInstantiation SEMICOLON",
+	"Declaration -> AT ImportIdentifier",
+	"Declaration -> AT ImportIdentifier SEMICOLON",
+	"Declaration -> AT LSQUARE ImportIdentifier RSQUARE",
+	"Declaration -> AT LSQUARE ImportIdentifier RSQUARE SEMICOLON",
+	"ImportIdentifier -> NonArrayedIdentifier",
+	"ImportIdentifier -> ArrayedIdentifier",
+	"ImportIdentifier -> OpenIdentifier",
+	"NonEmptyTerms -> Term Terms",
+	"Terms ->",
+	"Terms -> Term Terms",
+	"Term -> ClosedTerm",
+	"Term -> OpenTerm",
+	"Term -> DynamicTerm",
+	"ClosedTerm -> SimpleTerm",
+	"ClosedTerm -> ClosedCondTerm",
+	"OpenTerm -> SimpleCondTerm",
+	"OpenTerm -> OpenCondTerm",
+	"SimpleCondTerm -> QUESTION Term",
+	"ClosedCondTerm -> QUESTION ClosedTerm COLON ClosedTerm",
+	"OpenCondTerm -> QUESTION ClosedTerm COLON OpenTerm",
+	"SimpleTerm -> StaticTerm",
+	"SimpleTerm -> SwitchTerm",
+	"StaticTerm -> TypedStaticTerm",
+	"StaticTerm -> SingleAccess",
+	"StaticTerm -> MultiAccess",
+	"SingleStaticTerm -> TypedStaticTerm",
+	"SingleStaticTerm -> SingleAccess",
+	"SwitchTerm -> DQUESTION LCURLY LabeledTerms RCURLY",
+	"LabeledTerms -> LastLabeledTerm",
+	"LabeledTerms -> LabeledTerm LabeledTerms",
+	"LabeledTerm -> TypedStaticTerm COLON SimpleTerm",
+	"LabeledTerm -> TypedStaticTerm COLON SimpleTerm SEMICOLON",
+	"LastLabeledTerm -> COLON SimpleTerm",
+	"LastLabeledTerm -> COLON SimpleTerm SEMICOLON",
+	"DynamicTerm -> Compound",
+	"DynamicTerm -> Pack",
+	"DynamicTerm -> Unpack",
+	"DynamicTerm -> Link",
+	"DynamicTerm -> Loopback",
+	"DynamicTerm -> Send",
+	"DynamicTerm -> Swap",
+	"DynamicTerm -> Return",
+	"TypedStaticTerm -> Node",
+	"TypedStaticTerm -> BracketedExp",
+	"BracketedExp -> LBRACKET RBRACKET",
+	"BracketedExp -> LBRACKET ExpList RBRACKET",
+	"CurlyBracketedExpList -> CurlyBracketedExp",
+	"CurlyBracketedExpList -> CurlyBracketedExp COMMA CurlyBracketedExpList",
+	"CurlyBracketedExp -> LCURLY ExpList RCURLY",
+	"CurlyBracketedExp -> LCURLY CurlyBracketedExpList RCURLY",
+	"ExpList -> Exp",
+	"ExpList -> Exp COMMA ExpList",
+	"Exp -> Primary",
+	"Exp -> Exp DOR Exp",
+	"Exp -> Exp DAND Exp",
+	"Exp -> Exp OR Exp",
+	"Exp -> Exp XOR Exp",
+	"Exp -> Exp AND Exp",
+	"Exp -> Exp DEQUALS Exp",
+	"Exp -> Exp NEQUALS Exp",
+	"Exp -> Exp LT Exp",
+	"Exp -> Exp GT Exp",
+	"Exp -> Exp LE Exp",
+	"Exp -> Exp GE Exp",
+	"Exp -> Exp LS Exp",
+	"Exp -> Exp RS Exp",
+	"Exp -> Exp TIMES Exp",
+	"Exp -> Exp DIVIDE Exp",
+	"Exp -> Exp MOD Exp",
+	"Exp -> Exp PLUS Exp",
+	"Exp -> Exp MINUS Exp",
+	"Primary -> PrimaryBase",
+	"Primary -> PrefixOrMultiOp Primary",
+	"PrimaryBase -> NonArrayedIdentifier",
+	"PrimaryBase -> ArrayedIdentifier",
+	"PrimaryBase -> SingleAccessor NonArrayedIdentifier",
+	"PrimaryBase -> SingleAccessor ArrayedIdentifier",
+	"PrimaryBase -> Instantiation",
+	"PrimaryBase -> ExplicitFilter",
+	"PrimaryBase -> Object",
+	"PrimaryBase -> PrimLiteral",
+	"PrimaryBase -> BracketedExp",
+	"PrimaryBase -> PrimaryBase PostfixOp",
+	"Node -> NonArrayedIdentifier",
+	"Node -> ArrayedIdentifier",
+	"Node -> Instantiation",
+	"Node -> Filter",
+	"Node -> Object",
+	"Node -> PrimOpNode",
+	"Node -> PrimLiteral",
+	"NonArrayedIdentifier -> ID NonArrayedIdentifierSuffix",
+	"NonArrayedIdentifier -> DPERIOD NonArrayedIdentifierSuffix",
+	"ArrayedIdentifier -> ID ArrayedIdentifierSuffix",
+	"ArrayedIdentifier -> DPERIOD ArrayedIdentifierSuffix",
+	"OpenIdentifier -> ID OpenIdentifierSuffix",
+	"OpenIdentifier -> DPERIOD OpenIdentifierSuffix",
+	"NonArrayedIdentifierSuffix ->",
+	"NonArrayedIdentifierSuffix -> PERIOD ID NonArrayedIdentifierSuffix",
+	"ArrayedIdentifierSuffix -> PERIOD ID ArrayedIdentifierSuffix",
+	"ArrayedIdentifierSuffix -> PERIOD ArrayAccess IdentifierSuffix",
+	"OpenIdentifierSuffix -> PERIOD TIMES",
+	"OpenIdentifierSuffix -> PERIOD ID OpenIdentifierSuffix",
+	"IdentifierSuffix ->",
+	"IdentifierSuffix -> PERIOD ID IdentifierSuffix",
+	"IdentifierSuffix -> PERIOD ArrayAccess IdentifierSuffix",
+	"BlankInstantiation -> LSQUARE BlankInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE SingleInitInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE SingleInitInstantiationSource RSQUARE BracketedExp",
+	"Instantiation -> LSQUARE SingleInitInstantiationSource RSQUARE CurlyBracketedExp",
+	"Instantiation -> LSQUARE MultiInitInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE MultiInitInstantiationSource RSQUARE BracketedExp",
+	"Instantiation -> LSQUARE SingleFlowInitInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE MultiFlowInitInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE CopyInstantiationSource RSQUARE",
+	"Instantiation -> LSQUARE CloneInstantiationSource RSQUARE",
+	"BlankInstantiationSource -> NonArrayedIdentifier BlankInstantiationTypeSuffix",
+	"SingleInitInstantiationSource -> NonArrayedIdentifier",
+	"MultiInitInstantiationSource -> NonArrayedIdentifier MultiInitInstantiationTypeSuffix",
+	"SingleFlowInitInstantiationSource -> RARROW SingleInitInstantiationSource",
+	"MultiFlowInitInstantiationSource -> RARROW MultiInitInstantiationSource",
+	"CopyInstantiationSource -> SingleAccessor NonArrayedIdentifier",
+	"CopyInstantiationSource -> SingleAccessor ArrayedIdentifier",
+	"CloneInstantiationSource -> RARROW SingleAccessor",
+	"ArrayAccess -> LSQUARE Exp RSQUARE",
+	"ArrayAccess -> LSQUARE Exp COLON Exp RSQUARE",
+	"PrimOpNode -> PrefixOp",
+	"PrimOpNode -> InfixOp",
+	"PrimOpNode -> MultiOp",
+	"PrimOpNode -> PostfixOp",
+	"PrefixOp -> NOT",
+	"PrefixOp -> COMPLEMENT",
+	"InfixOp -> DOR",
+	"InfixOp -> DAND",
+	"InfixOp -> OR",
+	"InfixOp -> XOR",
+	"InfixOp -> AND",
+	"InfixOp -> DEQUALS",
+	"InfixOp -> NEQUALS",
+	"InfixOp -> LT",
+	"InfixOp -> GT",
+	"InfixOp -> LE",
+	"InfixOp -> GE",
+	"InfixOp -> LS",
+	"InfixOp -> RS",
+	"InfixOp -> TIMES",
+	"InfixOp -> DIVIDE",
+	"InfixOp -> MOD",
+	"MultiOp -> PLUS",
+	"MultiOp -> MINUS",
+	"PostfixOp -> DPLUS",
+	"PostfixOp -> DMINUS",
+	"PrefixOrMultiOp -> PrefixOp",
+	"PrefixOrMultiOp -> MultiOp",
+	"InfixOrMultiOp -> InfixOp",
+	"InfixOrMultiOp -> MultiOp",
+	"PrimLiteral -> INUM",
+	"PrimLiteral -> FNUM",
+	"PrimLiteral -> CQUOTE",
+	"PrimLiteral -> SQUOTE",
+	"Filter -> Block",
+	"Filter -> FilterHeader Block",
+	"ExplicitFilter -> FilterHeader Block",
+	"FilterHeader -> LSQUARE ParamList RSQUARE",
+	"FilterHeader -> LSQUARE ParamList RetList RSQUARE",
+	"FilterHeader -> LSQUARE RetList RSQUARE",
+	"NonRetFilterHeader -> LSQUARE ParamList RSQUARE",
+	"RetFilterHeader -> LSQUARE RetList RSQUARE",
+	"ParamList -> Param",
+	"ParamList -> Param COMMA ParamList",
+	"RetList -> DRARROW TypeList",
+	"RetList -> DRARROW QUESTION",
+	"ExplicitRetList -> DRARROW TypeList",
+	"Param -> Type ID",
+	"Param -> QUESTION ID",
+	"Type -> NonArrayedIdentifier",
+	"Type -> FilterType",
+	"Type -> ObjectType",
+	"Type -> NonArrayedIdentifier TypeSuffix",
+	"Type -> FilterType TypeSuffix",
+	"Type -> ObjectType TypeSuffix",
+	"TypeSuffix -> SLASH",
+	"TypeSuffix -> ListTypeSuffix",
+	"TypeSuffix -> StreamTypeSuffix",
+	"TypeSuffix -> ArrayTypeSuffix",
+	"TypeSuffix -> PoolTypeSuffix",
+	"BlankInstantiationTypeSuffix -> SLASH",
+	"BlankInstantiationTypeSuffix -> StreamTypeSuffix",
+	"BlankInstantiationTypeSuffix -> PoolTypeSuffix",
+	"MultiInitInstantiationTypeSuffix -> ArrayTypeSuffix",
+	"ListTypeSuffix -> LSQUARE RSQUARE",
+	"ListTypeSuffix -> LSQUARE RSQUARE ListTypeSuffix",
+	"StreamTypeSuffix -> DSLASH",
+	"StreamTypeSuffix -> DSLASH StreamTypeSuffix",
+	"ArrayTypeSuffix -> LSQUARE Exp RSQUARE",
+	"ArrayTypeSuffix -> LSQUARE Exp RSQUARE ArrayTypeSuffix",
+	"PoolTypeSuffix -> SLASH LSQUARE Exp RSQUARE",
+	"PoolTypeSuffix -> SLASH LSQUARE Exp RSQUARE ArrayTypeSuffix",
+	"FilterType -> LSQUARE TypeList RSQUARE",
+	"FilterType -> LSQUARE TypeList ExplicitRetList RSQUARE",
+	"FilterType -> LSQUARE ExplicitRetList RSQUARE",
+	"ObjectType -> LCURLY RCURLY",
+	"ObjectType -> LCURLY ObjectTypeList RCURLY",
+	"ObjectTypeList -> InstructorType",
+	"ObjectTypeList -> InstructorType COMMA ObjectTypeList",
+	"ObjectTypeList -> OutstructorType",
+	"ObjectTypeList -> OutstructorType COMMA ObjectTypeList",
+	"ObjectTypeList -> MemberType",
+	"ObjectTypeList -> MemberType COMMA ObjectTypeList",
+	"InstructorType -> EQUALS",
+	"InstructorType -> EQUALS LSQUARE TypeList RSQUARE",
+	"OutstructorType -> EQUALS LSQUARE DRARROW TypeList RSQUARE",
+	"MemberType -> ID EQUALS Type",
+	"TypeList -> Type",
+	"TypeList -> Type COMMA TypeList",
+	"Block -> LCURLY Pipes RCURLY",
+	"Object -> LSQUARE RSQUARE LCURLY ObjectPipes RCURLY",
+	"ObjectPipes -> LastInstructor",
+	"ObjectPipes -> Instructor",
+	"ObjectPipes -> Instructor ObjectPipes",
+	"ObjectPipes -> Outstructor",
+	"ObjectPipes -> Outstructor ObjectPipes",
+	"ObjectPipes -> LastPipe",
+	"ObjectPipes -> Pipe",
+	"ObjectPipes -> Pipe ObjectPipes",
+	"Instructor -> EQUALS SEMICOLON",
+	"Instructor -> EQUALS Block SEMICOLON",
+	"Instructor -> EQUALS NonRetFilterHeader Block",
+	"Instructor -> EQUALS NonRetFilterHeader Block SEMICOLON",
+	"LastInstructor -> EQUALS",
+	"LastInstructor -> EQUALS Block",
+	"Outstructor -> EQUALS RetFilterHeader Block",
+	"Outstructor -> EQUALS RetFilterHeader Block SEMICOLON",
+	"SingleAccess -> SingleAccessor Node",
+	"MultiAccess -> MultiAccessor Node",
+	"SingleAccessor -> SLASH",
+	"MultiAccessor -> DSLASH",
+	"MultiAccessor -> LSQUARE RSQUARE",
+	"Compound -> COMMA SingleStaticTerm",
+	"Pack -> RFLAG",
+	"Unpack -> LFLAG",
+	"Link -> DCOLON StaticTerm",
+	"Loopback -> LARROW",
+	"Send -> RARROW Node",
+	"Swap -> LRARROW Node",
+	"Return -> DRARROW",
+};